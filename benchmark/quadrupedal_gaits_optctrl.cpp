@@ -101,4 +101,33 @@ int main(int argc, char* argv[]) {
   max_duration = duration.maxCoeff();
   std::cout << "  ShootingProblem.calcDiff [ms]: " << avrg_duration << " ("
             << min_duration << "-" << max_duration << ")" << std::endl;
+
+  // Replanning the walking problem
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    gait.createWalkingProblem(x0, stepLength, stepHeight, timeStep, stepKnots,
+                              supportKnots);
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "  SimpleQuadrupedGaitProblem.createWalkingProblem [ms]: "
+            << avrg_duration << " (" << min_duration << "-" << max_duration
+            << ")" << std::endl;
+
+  for (unsigned int i = 0; i < T; ++i) {
+    crocoddyl::Timer timer;
+    gait.updateWalkingProblem(problem, x0, stepLength, stepHeight, timeStep,
+                              stepKnots, supportKnots);
+    duration[i] = timer.get_duration();
+  }
+
+  avrg_duration = duration.sum() / T;
+  min_duration = duration.minCoeff();
+  max_duration = duration.maxCoeff();
+  std::cout << "  SimpleQuadrupedGaitProblem.updateWalkingProblem [ms]: "
+            << avrg_duration << " (" << min_duration << "-" << max_duration
+            << ")" << std::endl;
 }
@@ -16,6 +16,71 @@
 namespace crocoddyl {
 namespace python {
 
+typedef ActionModelAbstract::MatrixXsRowMajor RowMatrixXd;
+
+// The batch evaluations release the GIL, as they do not call Python unless
+// there are Python-derived models
+
+void ActionModel_calcBatch(ActionModelAbstract& self,
+                           const std::shared_ptr<ActionBatchData>& data,
+                           const Eigen::Ref<const RowMatrixXd>& xs,
+                           const Eigen::Ref<const RowMatrixXd>& us) {
+  if (PythonDerived::alive()) {
+    // Python-derived models cannot be evaluated by the threads of the batch
+    // data, so the samples run one at a time in this thread
+    const std::size_t nthreads = data->nthreads;
+    data->nthreads = 1;
+    try {
+      self.calcBatch(data, xs, us);
+    } catch (...) {
+      data->nthreads = nthreads;
+      throw;
+    }
+    data->nthreads = nthreads;
+  } else {
+    ScopedGILRelease nogil;
+    self.calcBatch(data, xs, us);
+  }
+}
+
+void ActionModel_calcBatch_x(ActionModelAbstract& self,
+                             const std::shared_ptr<ActionBatchData>& data,
+                             const Eigen::Ref<const RowMatrixXd>& xs) {
+  ActionModel_calcBatch(self, data, xs, RowMatrixXd());
+}
+
+void ActionModel_calcDiffBatch(ActionModelAbstract& self,
+                               const std::shared_ptr<ActionBatchData>& data,
+                               const Eigen::Ref<const RowMatrixXd>& xs,
+                               const Eigen::Ref<const RowMatrixXd>& us) {
+  if (PythonDerived::alive()) {
+    // Python-derived models cannot be evaluated by the threads of the batch
+    // data, so the samples run one at a time in this thread
+    const std::size_t nthreads = data->nthreads;
+    data->nthreads = 1;
+    try {
+      self.calcDiffBatch(data, xs, us);
+    } catch (...) {
+      data->nthreads = nthreads;
+      throw;
+    }
+    data->nthreads = nthreads;
+  } else {
+    ScopedGILRelease nogil;
+    self.calcDiffBatch(data, xs, us);
+  }
+}
+
+void ActionModel_calcDiffBatch_x(ActionModelAbstract& self,
+                                 const std::shared_ptr<ActionBatchData>& data,
+                                 const Eigen::Ref<const RowMatrixXd>& xs) {
+  ActionModel_calcDiffBatch(self, data, xs, RowMatrixXd());
+}
+
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(ActionModel_createBatchData_wraps,
+                                       ActionModelAbstract::createBatchData, 1,
+                                       2)
+
 void exposeActionAbstract() {
   // Register custom converters between std::vector and Python list
   typedef std::shared_ptr<ActionModelAbstract> ActionModelPtr;
@@ -97,6 +162,30 @@ void exposeActionAbstract() {
           "problem.\n"
           ":param data: action data\n"
           ":param x: state point (dim. state.nx)")
+      .def<void (ActionModelAbstract::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcAndDiff", &ActionModelAbstract::calcAndDiff,
+          bp::args("self", "data", "x", "u"),
+          "Compute the next state, cost value and their derivatives.\n\n"
+          "It is equivalent to run calc followed by calcDiff, but it allows "
+          "action\n"
+          "models to share computations between both stages.\n"
+          ":param data: action data\n"
+          ":param x: state point (dim. state.nx)\n"
+          ":param u: control input (dim. nu)")
+      .def<void (ActionModelAbstract::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcAndDiff", &ActionModelAbstract::calcAndDiff,
+          bp::args("self", "data", "x"),
+          "Compute the total cost value and its derivatives for nodes that "
+          "depends only on the state.\n\n"
+          "This function is used in the terminal nodes of an optimal control "
+          "problem.\n"
+          ":param data: action data\n"
+          ":param x: state point (dim. state.nx)")
       .def("createData", &ActionModelAbstract_wrap::createData,
            &ActionModelAbstract_wrap::default_createData, bp::args("self"),
            "Create the action data.\n\n"
@@ -104,6 +193,50 @@ void exposeActionAbstract() {
            "allocated.\n"
            "This function returns the allocated data for a predefined AM.\n"
            ":return AM data.")
+      .def("createBatchData", &ActionModelAbstract::createBatchData,
+           ActionModel_createBatchData_wraps(
+               bp::args("self", "N", "nthreads"),
+               "Create the data of a batch evaluation.\n\n"
+               ":param N: number of samples\n"
+               ":param nthreads: number of threads (default is the number of "
+               "threads of the\n"
+               "multithreading support)\n"
+               ":return batch data."))
+      .def("calcBatch", &ActionModel_calcBatch,
+           bp::args("self", "data", "xs", "us"),
+           "Compute the next states and cost values of a batch of samples.\n\n"
+           "The samples are distributed over the threads of the batch data, "
+           "and each thread\n"
+           "runs calc with its own data. The GIL is released during the "
+           "evaluation.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)\n"
+           ":param us: controls (dim. N x nu)")
+      .def("calcBatch", &ActionModel_calcBatch_x,
+           bp::args("self", "data", "xs"),
+           "Compute the cost values of a batch of samples that depend only "
+           "on the state.\n\n"
+           "This function is used to evaluate terminal nodes.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)")
+      .def("calcDiffBatch", &ActionModel_calcDiffBatch,
+           bp::args("self", "data", "xs", "us"),
+           "Compute the next states, cost values and their derivatives of a "
+           "batch of samples.\n\n"
+           "Each thread runs calc and calcDiff with its own data, so there is "
+           "no need to run\n"
+           "calcBatch first. The GIL is released during the evaluation.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)\n"
+           ":param us: controls (dim. N x nu)")
+      .def("calcDiffBatch", &ActionModel_calcDiffBatch_x,
+           bp::args("self", "data", "xs"),
+           "Compute the cost values and their derivatives of a batch of "
+           "samples that depend\n"
+           "only on the state.\n\n"
+           "This function is used to evaluate terminal nodes.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)")
       .def("quasiStatic", &ActionModelAbstract_wrap::quasiStatic_x,
            ActionModel_quasiStatic_wraps(
                bp::args("self", "data", "x", "maxiter", "tol"),
@@ -268,6 +401,68 @@ void exposeActionAbstract() {
                     bp::make_setter(&ActionDataAbstract::Hu),
                     "Jacobian of the equality constraint w.r.t. the control")
       .def(CopyableVisitor<ActionDataAbstract>());
+
+  bp::register_ptr_to_python<std::shared_ptr<ActionBatchData> >();
+
+  bp::class_<ActionBatchData>(
+      "ActionBatchData",
+      "Data of a batch evaluation.\n\n"
+      "It contains the action data of each thread and the outputs of "
+      "the samples, one\n"
+      "sample per row. The matrices of a sample are flattened in row-major "
+      "order, e.g.,\n"
+      "data.Fx.reshape(N, state.ndx, state.ndx) returns the Jacobians "
+      "without copying them.",
+      bp::init<ActionModelAbstract*, std::size_t, std::size_t>(
+          bp::args("self", "model", "N", "nthreads"),
+          "Create the data of a batch evaluation.\n\n"
+          ":param model: action model\n"
+          ":param N: number of samples\n"
+          ":param nthreads: number of threads (0 for the number of threads "
+          "of the\n"
+          "multithreading support)"))
+      .def_readonly("nthreads", &ActionBatchData::nthreads, "number of threads")
+      .add_property(
+          "datas",
+          bp::make_getter(&ActionBatchData::datas,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "action data of each thread")
+      .add_property("xnext",
+                    bp::make_getter(&ActionBatchData::xnext,
+                                    bp::return_internal_reference<>()),
+                    "next states")
+      .add_property("cost",
+                    bp::make_getter(&ActionBatchData::cost,
+                                    bp::return_internal_reference<>()),
+                    "cost values")
+      .add_property("Fx",
+                    bp::make_getter(&ActionBatchData::Fx,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the dynamics w.r.t. the state")
+      .add_property("Fu",
+                    bp::make_getter(&ActionBatchData::Fu,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the dynamics w.r.t. the control")
+      .add_property("Lx",
+                    bp::make_getter(&ActionBatchData::Lx,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the cost w.r.t. the state")
+      .add_property("Lu",
+                    bp::make_getter(&ActionBatchData::Lu,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the cost w.r.t. the control")
+      .add_property("Lxx",
+                    bp::make_getter(&ActionBatchData::Lxx,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the state")
+      .add_property("Lxu",
+                    bp::make_getter(&ActionBatchData::Lxu,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the state and control")
+      .add_property("Luu",
+                    bp::make_getter(&ActionBatchData::Luu,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the control");
 }
 
 }  // namespace python
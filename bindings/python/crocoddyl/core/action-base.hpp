@@ -13,12 +13,14 @@
 #include "crocoddyl/core/action-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ActionModelAbstract_wrap : public ActionModelAbstract,
-                                 public bp::wrapper<ActionModelAbstract> {
+                                 public bp::wrapper<ActionModelAbstract>,
+                                 public PythonDerived {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using ActionModelAbstract::ng_;
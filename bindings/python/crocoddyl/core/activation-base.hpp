@@ -12,13 +12,15 @@
 #include "crocoddyl/core/activation-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ActivationModelAbstract_wrap
     : public ActivationModelAbstract,
-      public bp::wrapper<ActivationModelAbstract> {
+      public bp::wrapper<ActivationModelAbstract>,
+      public PythonDerived {
  public:
   explicit ActivationModelAbstract_wrap(const std::size_t nr)
       : ActivationModelAbstract(nr), bp::wrapper<ActivationModelAbstract>() {}
@@ -18,6 +18,12 @@ namespace python {
 void exposeActuationAbstract() {
   bp::register_ptr_to_python<std::shared_ptr<ActuationModelAbstract> >();
 
+  bp::enum_<ActuationStructure>("ActuationStructure")
+      .value("ActuationIdentity", ActuationIdentity)
+      .value("ActuationSelection", ActuationSelection)
+      .value("ActuationDense", ActuationDense)
+      .export_values();
+
   bp::class_<ActuationModelAbstract_wrap, boost::noncopyable>(
       "ActuationModelAbstract",
       "Abstract class for actuation-mapping models.\n\n"
@@ -99,6 +105,11 @@ void exposeActuationAbstract() {
       .add_property("nu",
                     bp::make_function(&ActuationModelAbstract_wrap::get_nu),
                     "dimension of joint-torque vector")
+      .add_property(
+          "structure",
+          bp::make_function(&ActuationModelAbstract_wrap::get_structure),
+          "structure of the actuation Jacobians (identity and selection "
+          "mappings use block copies in the dynamics)")
       .add_property(
           "state",
           bp::make_function(&ActuationModelAbstract_wrap::get_state,
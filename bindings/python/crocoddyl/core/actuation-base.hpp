@@ -13,12 +13,14 @@
 #include "crocoddyl/core/actuation-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ActuationModelAbstract_wrap : public ActuationModelAbstract,
-                                    public bp::wrapper<ActuationModelAbstract> {
+                                    public bp::wrapper<ActuationModelAbstract>,
+                                    public PythonDerived {
  public:
   ActuationModelAbstract_wrap(std::shared_ptr<StateAbstract> state,
                               const std::size_t nu)
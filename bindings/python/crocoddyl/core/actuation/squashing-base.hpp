@@ -12,12 +12,14 @@
 #include "crocoddyl/core/actuation/squashing-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class SquashingModelAbstract_wrap : public SquashingModelAbstract,
-                                    public bp::wrapper<SquashingModelAbstract> {
+                                    public bp::wrapper<SquashingModelAbstract>,
+                                    public PythonDerived {
  public:
   SquashingModelAbstract_wrap(const std::size_t ns)
       : SquashingModelAbstract(ns), bp::wrapper<SquashingModelAbstract>() {}
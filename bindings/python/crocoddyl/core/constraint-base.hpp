@@ -12,13 +12,15 @@
 #include "crocoddyl/core/constraint-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ConstraintModelAbstract_wrap
     : public ConstraintModelAbstract,
-      public bp::wrapper<ConstraintModelAbstract> {
+      public bp::wrapper<ConstraintModelAbstract>,
+      public PythonDerived {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using ConstraintModelAbstract::nu_;
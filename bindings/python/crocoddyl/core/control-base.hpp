@@ -13,6 +13,7 @@
 #include "crocoddyl/core/control-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
@@ -26,7 +27,8 @@ BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(
 
 class ControlParametrizationModelAbstract_wrap
     : public ControlParametrizationModelAbstract,
-      public bp::wrapper<ControlParametrizationModelAbstract> {
+      public bp::wrapper<ControlParametrizationModelAbstract>,
+      public PythonDerived {
  public:
   ControlParametrizationModelAbstract_wrap(std::size_t nw, std::size_t nu)
       : ControlParametrizationModelAbstract(nw, nu),
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/controls/bspline.hpp"
+
+#include "python/crocoddyl/core/control-base.hpp"
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/copyable.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeControlParametrizationBSpline() {
+  bp::register_ptr_to_python<
+      std::shared_ptr<ControlParametrizationModelBSpline> >();
+
+  bp::class_<ControlParametrizationModelBSpline,
+             bp::bases<ControlParametrizationModelAbstract> >(
+      "ControlParametrizationModelBSpline",
+      "Clamped uniform B-spline control.\n\n"
+      "The control is a B-spline of the normalized time, whose control points "
+      "are stacked in the parameter vector. The model evaluates the spline "
+      "time t0 + t * (t1 - t0), so that consecutive windows of the same "
+      "spline can span several integration steps.",
+      bp::init<std::size_t, std::size_t,
+               bp::optional<std::size_t, double, double> >(
+          bp::args("self", "nw", "ncp", "degree", "t0", "t1"),
+          "Initialize the control dimensions.\n\n"
+          ":param nw: dimension of differential control space\n"
+          ":param ncp: number of control points (greater than the degree)\n"
+          ":param degree: degree of the spline (default 3)\n"
+          ":param t0: spline time at the beginning of the window (default 0)\n"
+          ":param t1: spline time at the end of the window (default 1)"))
+      .def<void (ControlParametrizationModelBSpline::*)(
+          const std::shared_ptr<ControlParametrizationDataAbstract>&, double,
+          const Eigen::Ref<const Eigen::VectorXd>&) const>(
+          "calc", &ControlParametrizationModelBSpline::calc,
+          bp::args("self", "data", "t", "u"),
+          "Compute the control value.\n\n"
+          ":param data: control-parametrization data\n"
+          ":param t: normalized time in [0, 1]\n"
+          ":param u: control parameters (dim control.nu)")
+      .def<void (ControlParametrizationModelBSpline::*)(
+          const std::shared_ptr<ControlParametrizationDataAbstract>&, double,
+          const Eigen::Ref<const Eigen::VectorXd>&) const>(
+          "calcDiff", &ControlParametrizationModelBSpline::calcDiff,
+          bp::args("self", "data", "t", "u"),
+          "Compute the Jacobian of the control value with respect to the "
+          "control parameters.\n"
+          "It assumes that calc has been run first.\n\n"
+          ":param data: control-parametrization data\n"
+          ":param t: normalized time in [0, 1]\n"
+          ":param u: control parameters (dim control.nu)")
+      .def("createData", &ControlParametrizationModelBSpline::createData,
+           bp::args("self"), "Create the B-spline data.")
+      .def<void (ControlParametrizationModelBSpline::*)(
+          const std::shared_ptr<ControlParametrizationDataAbstract>&, double,
+          const Eigen::Ref<const Eigen::VectorXd>&) const>(
+          "params", &ControlParametrizationModelBSpline::params,
+          bp::args("self", "data", "t", "w"),
+          "Compute the control parameters.\n\n"
+          ":param data: control-parametrization data\n"
+          ":param t: normalized time in [0, 1]\n"
+          ":param w: control value (dim control.nw)")
+      .def("convertBounds", &ControlParametrizationModelBSpline::convertBounds,
+           bp::args("self", "w_lb", "w_ub"),
+           "Convert the bounds on the control to bounds on the control "
+           "parameters.\n\n"
+           ":param w_lb: lower bounds on u (dim control.nw).\n"
+           ":param w_ub: upper bounds on u (dim control.nw).\n"
+           ":return p_lb, p_ub: lower and upper bounds on the control "
+           "parameters (dim control.nu).")
+      .def("multiplyByJacobian",
+           &ControlParametrizationModelBSpline::multiplyByJacobian_J,
+           ControlParametrizationModelAbstract_multiplyByJacobian_J_wrap(
+               bp::args("self", "data", "A", "op"),
+               "Compute the product between the given matrix A and the "
+               "derivative of the control with respect to the parameters.\n\n"
+               "It assumes that calc has been run first.\n"
+               ":param data: control-parametrization data\n"
+               ":param A: matrix to multiply (dim na x control.nw)\n"
+               ":op assignment operator which sets, adds, or removes the given "
+               "results\n"
+               ":return Product between A and the partial derivative of the "
+               "value function (dim na x control.nu)"))
+      .def(
+          "multiplyJacobianTransposeBy",
+          &ControlParametrizationModelBSpline::multiplyJacobianTransposeBy_J,
+          ControlParametrizationModelAbstract_multiplyJacobianTransposeBy_J_wrap(
+              bp::args("self", "data", "A", "op"),
+              "Compute the product between the transpose of the derivative of "
+              "the control with respect to the parameters\n"
+              "and a given matrix A.\n\n"
+              "It assumes that calc has been run first.\n"
+              ":param data: control-parametrization data\n"
+              ":param A: matrix to multiply (dim control.nw x na)\n"
+              ":op assignment operator which sets, adds, or removes the given "
+              "results\n"
+              ":return Product between the partial derivative of the value "
+              "function (transposed) and A (dim control.nu x na)"))
+      .add_property("ncp", &ControlParametrizationModelBSpline::get_ncp,
+                    "number of control points")
+      .add_property("degree", &ControlParametrizationModelBSpline::get_degree,
+                    "degree of the spline")
+      .add_property(
+          "t0",
+          bp::make_function(&ControlParametrizationModelBSpline::get_t0,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "spline time at the beginning of the window")
+      .add_property(
+          "t1",
+          bp::make_function(&ControlParametrizationModelBSpline::get_t1,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "spline time at the end of the window")
+      .add_property(
+          "knots",
+          bp::make_function(&ControlParametrizationModelBSpline::get_knots,
+                            bp::return_internal_reference<>()),
+          "clamped uniform knot vector")
+      .def(CopyableVisitor<ControlParametrizationModelBSpline>());
+
+  boost::python::register_ptr_to_python<
+      std::shared_ptr<ControlParametrizationDataBSpline> >();
+
+  bp::class_<ControlParametrizationDataBSpline,
+             bp::bases<ControlParametrizationDataAbstract> >(
+      "ControlParametrizationDataBSpline",
+      "Control-parametrization data for the B-spline control.",
+      bp::init<ControlParametrizationModelBSpline*>(
+          bp::args("self", "model"),
+          "Create control-parametrization data.\n\n"
+          ":param model: B-spline control model"))
+      .add_property("b",
+                    bp::make_getter(&ControlParametrizationDataBSpline::b,
+                                    bp::return_internal_reference<>()),
+                    "basis functions of the control points")
+      .add_property("span",
+                    bp::make_getter(&ControlParametrizationDataBSpline::span),
+                    "knot span of the spline time")
+      .def(CopyableVisitor<ControlParametrizationDataBSpline>());
+}
+
+}  // namespace python
+}  // namespace crocoddyl
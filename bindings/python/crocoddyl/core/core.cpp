@@ -28,6 +28,8 @@ void exposeCore() {
   exposeDataCollectorActuation();
   exposeDataCollectorJoint();
   exposeIntegratedActionEuler();
+  exposeIntegratedActionImplicitEuler();
+  exposeIntegratedActionMultiStep();
   exposeIntegratedActionRK();
   exposeIntegratedActionRK4();
   exposeCostAbstract();
@@ -49,6 +51,7 @@ void exposeCore() {
   exposeControlParametrizationPolyZero();
   exposeControlParametrizationPolyOne();
   exposeControlParametrizationPolyTwoRK();
+  exposeControlParametrizationBSpline();
   exposeActionUnicycle();
   exposeActionLQR();
   exposeDifferentialActionLQR();
@@ -68,12 +71,17 @@ void exposeCore() {
   exposeSolverBoxDDP();
   exposeSolverBoxFDDP();
   exposeSolverIntro();
+  exposeSolverMPPI();
 #ifdef CROCODDYL_WITH_IPOPT
   exposeSolverIpopt();
 #endif
   exposeCallbacks();
   exposeException();
   exposeStopWatch();
+  exposeSolverPool();
+  exposeSnapshot();
+  exposeProblemParameters();
+  exposeSolutionSensitivity();
 }
 
 }  // namespace python
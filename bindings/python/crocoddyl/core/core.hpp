@@ -30,6 +30,8 @@ void exposeActuationSquashing();
 void exposeDataCollectorActuation();
 void exposeDataCollectorJoint();
 void exposeIntegratedActionEuler();
+void exposeIntegratedActionImplicitEuler();
+void exposeIntegratedActionMultiStep();
 void exposeIntegratedActionRK();
 void exposeIntegratedActionRK4();
 void exposeCostAbstract();
@@ -51,6 +53,7 @@ void exposeStateEuclidean();
 void exposeControlParametrizationPolyZero();
 void exposeControlParametrizationPolyOne();
 void exposeControlParametrizationPolyTwoRK();
+void exposeControlParametrizationBSpline();
 void exposeActionUnicycle();
 void exposeActionLQR();
 void exposeDifferentialActionLQR();
@@ -70,12 +73,17 @@ void exposeSolverBoxQP();
 void exposeSolverBoxDDP();
 void exposeSolverBoxFDDP();
 void exposeSolverIntro();
+void exposeSolverMPPI();
 #ifdef CROCODDYL_WITH_IPOPT
 void exposeSolverIpopt();
 #endif
 void exposeCallbacks();
 void exposeException();
 void exposeStopWatch();
+void exposeSolverPool();
+void exposeSnapshot();
+void exposeProblemParameters();
+void exposeSolutionSensitivity();
 
 void exposeCore();
 
@@ -13,12 +13,14 @@
 #include "crocoddyl/core/cost-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class CostModelAbstract_wrap : public CostModelAbstract,
-                               public bp::wrapper<CostModelAbstract> {
+                               public bp::wrapper<CostModelAbstract>,
+                               public PythonDerived {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using CostModelAbstract::nu_;
@@ -17,6 +17,75 @@
 namespace crocoddyl {
 namespace python {
 
+typedef DifferentialActionModelAbstract::MatrixXsRowMajor RowMatrixXd;
+
+// The batch evaluations release the GIL, as they do not call Python unless
+// there are Python-derived models
+
+void DifferentialActionModel_calcBatch(
+    DifferentialActionModelAbstract& self,
+    const std::shared_ptr<DifferentialActionBatchData>& data,
+    const Eigen::Ref<const RowMatrixXd>& xs,
+    const Eigen::Ref<const RowMatrixXd>& us) {
+  if (PythonDerived::alive()) {
+    // Python-derived models cannot be evaluated by the threads of the batch
+    // data, so the samples run one at a time in this thread
+    const std::size_t nthreads = data->nthreads;
+    data->nthreads = 1;
+    try {
+      self.calcBatch(data, xs, us);
+    } catch (...) {
+      data->nthreads = nthreads;
+      throw;
+    }
+    data->nthreads = nthreads;
+  } else {
+    ScopedGILRelease nogil;
+    self.calcBatch(data, xs, us);
+  }
+}
+
+void DifferentialActionModel_calcBatch_x(
+    DifferentialActionModelAbstract& self,
+    const std::shared_ptr<DifferentialActionBatchData>& data,
+    const Eigen::Ref<const RowMatrixXd>& xs) {
+  DifferentialActionModel_calcBatch(self, data, xs, RowMatrixXd());
+}
+
+void DifferentialActionModel_calcDiffBatch(
+    DifferentialActionModelAbstract& self,
+    const std::shared_ptr<DifferentialActionBatchData>& data,
+    const Eigen::Ref<const RowMatrixXd>& xs,
+    const Eigen::Ref<const RowMatrixXd>& us) {
+  if (PythonDerived::alive()) {
+    // Python-derived models cannot be evaluated by the threads of the batch
+    // data, so the samples run one at a time in this thread
+    const std::size_t nthreads = data->nthreads;
+    data->nthreads = 1;
+    try {
+      self.calcDiffBatch(data, xs, us);
+    } catch (...) {
+      data->nthreads = nthreads;
+      throw;
+    }
+    data->nthreads = nthreads;
+  } else {
+    ScopedGILRelease nogil;
+    self.calcDiffBatch(data, xs, us);
+  }
+}
+
+void DifferentialActionModel_calcDiffBatch_x(
+    DifferentialActionModelAbstract& self,
+    const std::shared_ptr<DifferentialActionBatchData>& data,
+    const Eigen::Ref<const RowMatrixXd>& xs) {
+  DifferentialActionModel_calcDiffBatch(self, data, xs, RowMatrixXd());
+}
+
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(
+    DifferentialActionModel_createBatchData_wraps,
+    DifferentialActionModelAbstract::createBatchData, 1, 2)
+
 void exposeDifferentialActionAbstract() {
   // Register custom converters between std::vector and Python list
   typedef std::shared_ptr<DifferentialActionModelAbstract>
@@ -102,6 +171,31 @@ void exposeDifferentialActionAbstract() {
           "problem.\n"
           ":param data: action data\n"
           ":param x: state point (dim. state.nx)")
+      .def<void (DifferentialActionModelAbstract::*)(
+          const std::shared_ptr<DifferentialActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcAndDiff", &DifferentialActionModelAbstract::calcAndDiff,
+          bp::args("self", "data", "x", "u"),
+          "Compute the system acceleration, cost value and their "
+          "derivatives.\n\n"
+          "It is equivalent to run calc followed by calcDiff, but it allows "
+          "differential\n"
+          "action models to share computations between both stages.\n"
+          ":param data: differential action data\n"
+          ":param x: state point (dim. state.nx)\n"
+          ":param u: control input (dim. nu)")
+      .def<void (DifferentialActionModelAbstract::*)(
+          const std::shared_ptr<DifferentialActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcAndDiff", &DifferentialActionModelAbstract::calcAndDiff,
+          bp::args("self", "data", "x"),
+          "Compute the total cost value and its derivatives for nodes that "
+          "depends only on the state.\n\n"
+          "This function is used in the terminal nodes of an optimal control "
+          "problem.\n"
+          ":param data: differential action data\n"
+          ":param x: state point (dim. state.nx)")
       .def("createData", &DifferentialActionModelAbstract_wrap::createData,
            &DifferentialActionModelAbstract_wrap::default_createData,
            bp::args("self"),
@@ -111,6 +205,52 @@ void exposeDifferentialActionAbstract() {
            "predefined\n"
            "DAM.\n"
            ":return DAM data.")
+      .def("createBatchData", &DifferentialActionModelAbstract::createBatchData,
+           DifferentialActionModel_createBatchData_wraps(
+               bp::args("self", "N", "nthreads"),
+               "Create the data of a batch evaluation.\n\n"
+               ":param N: number of samples\n"
+               ":param nthreads: number of threads (default is the number of "
+               "threads of the\n"
+               "multithreading support)\n"
+               ":return batch data."))
+      .def("calcBatch", &DifferentialActionModel_calcBatch,
+           bp::args("self", "data", "xs", "us"),
+           "Compute the system accelerations and cost values of a batch of "
+           "samples.\n\n"
+           "The samples are distributed over the threads of the batch data, "
+           "and each thread\n"
+           "runs calc with its own data. The GIL is released during the "
+           "evaluation.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)\n"
+           ":param us: controls (dim. N x nu)")
+      .def("calcBatch", &DifferentialActionModel_calcBatch_x,
+           bp::args("self", "data", "xs"),
+           "Compute the cost values of a batch of samples that depend only "
+           "on the state.\n\n"
+           "This function is used to evaluate terminal nodes.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)")
+      .def("calcDiffBatch", &DifferentialActionModel_calcDiffBatch,
+           bp::args("self", "data", "xs", "us"),
+           "Compute the system accelerations, cost values and their "
+           "derivatives of a batch\n"
+           "of samples.\n\n"
+           "Each thread runs calc and calcDiff with its own data, so there is "
+           "no need to run\n"
+           "calcBatch first. The GIL is released during the evaluation.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)\n"
+           ":param us: controls (dim. N x nu)")
+      .def("calcDiffBatch", &DifferentialActionModel_calcDiffBatch_x,
+           bp::args("self", "data", "xs"),
+           "Compute the cost values and their derivatives of a batch of "
+           "samples that depend\n"
+           "only on the state.\n\n"
+           "This function is used to evaluate terminal nodes.\n"
+           ":param data: batch data\n"
+           ":param xs: states (dim. N x state.nx, one sample per row)")
       .def("quasiStatic", &DifferentialActionModelAbstract_wrap::quasiStatic_x,
            DifferentialActionModel_quasiStatic_wraps(
                bp::args("self", "data", "x", "maxiter", "tol"),
@@ -286,6 +426,70 @@ void exposeDifferentialActionAbstract() {
                     bp::make_setter(&DifferentialActionDataAbstract::Hu),
                     "Jacobian of the equality constraint w.r.t. the control")
       .def(CopyableVisitor<DifferentialActionDataAbstract>());
+
+  bp::register_ptr_to_python<std::shared_ptr<DifferentialActionBatchData> >();
+
+  bp::class_<DifferentialActionBatchData>(
+      "DifferentialActionBatchData",
+      "Data of a batch evaluation.\n\n"
+      "It contains the differential action data of each thread and the "
+      "outputs of the\n"
+      "samples, one sample per row. The matrices of a sample are flattened "
+      "in row-major\n"
+      "order, e.g.,\n"
+      "data.Fx.reshape(N, state.nv, state.ndx) returns the Jacobians "
+      "without copying them.",
+      bp::init<DifferentialActionModelAbstract*, std::size_t, std::size_t>(
+          bp::args("self", "model", "N", "nthreads"),
+          "Create the data of a batch evaluation.\n\n"
+          ":param model: differential action model\n"
+          ":param N: number of samples\n"
+          ":param nthreads: number of threads (0 for the number of threads "
+          "of the\n"
+          "multithreading support)"))
+      .def_readonly("nthreads", &DifferentialActionBatchData::nthreads,
+                    "number of threads")
+      .add_property(
+          "datas",
+          bp::make_getter(&DifferentialActionBatchData::datas,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "differential action data of each thread")
+      .add_property("xout",
+                    bp::make_getter(&DifferentialActionBatchData::xout,
+                                    bp::return_internal_reference<>()),
+                    "system accelerations")
+      .add_property("cost",
+                    bp::make_getter(&DifferentialActionBatchData::cost,
+                                    bp::return_internal_reference<>()),
+                    "cost values")
+      .add_property("Fx",
+                    bp::make_getter(&DifferentialActionBatchData::Fx,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the dynamics w.r.t. the state")
+      .add_property("Fu",
+                    bp::make_getter(&DifferentialActionBatchData::Fu,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the dynamics w.r.t. the control")
+      .add_property("Lx",
+                    bp::make_getter(&DifferentialActionBatchData::Lx,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the cost w.r.t. the state")
+      .add_property("Lu",
+                    bp::make_getter(&DifferentialActionBatchData::Lu,
+                                    bp::return_internal_reference<>()),
+                    "Jacobians of the cost w.r.t. the control")
+      .add_property("Lxx",
+                    bp::make_getter(&DifferentialActionBatchData::Lxx,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the state")
+      .add_property("Lxu",
+                    bp::make_getter(&DifferentialActionBatchData::Lxu,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the state and control")
+      .add_property("Luu",
+                    bp::make_getter(&DifferentialActionBatchData::Luu,
+                                    bp::return_internal_reference<>()),
+                    "Hessians of the cost w.r.t. the control");
 }
 
 }  // namespace python
@@ -13,13 +13,15 @@
 #include "crocoddyl/core/diff-action-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class DifferentialActionModelAbstract_wrap
     : public DifferentialActionModelAbstract,
-      public bp::wrapper<DifferentialActionModelAbstract> {
+      public bp::wrapper<DifferentialActionModelAbstract>,
+      public PythonDerived {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using DifferentialActionModelAbstract::unone_;
@@ -12,13 +12,15 @@
 #include "crocoddyl/core/integ-action-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class IntegratedActionModelAbstract_wrap
     : public IntegratedActionModelAbstract,
-      public bp::wrapper<IntegratedActionModelAbstract> {
+      public bp::wrapper<IntegratedActionModelAbstract>,
+      public PythonDerived {
  public:
   IntegratedActionModelAbstract_wrap(
       std::shared_ptr<DifferentialActionModelAbstract> model,
@@ -82,6 +84,26 @@ class IntegratedActionModelAbstract_wrap
   }
 };
 
+// Integrate the differential model releasing the GIL, which is kept if there
+// are Python-derived models
+template <class Model>
+void IntegratedActionModel_calc(
+    Model& self, const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& u) {
+  ScopedGILRelease nogil;
+  self.calc(data, x, u);
+}
+
+template <class Model>
+void IntegratedActionModel_calcDiff(
+    Model& self, const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& u) {
+  ScopedGILRelease nogil;
+  self.calcDiff(data, x, u);
+}
+
 }  // namespace python
 }  // namespace crocoddyl
 
@@ -47,36 +47,29 @@ void exposeIntegratedActionEuler() {
           ":param stepTime: step time (default 1e-3)\n"
           ":param withCostResidual: includes the cost residuals and "
           "derivatives (default True)."))
-      .def<void (IntegratedActionModelEuler::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calc", &IntegratedActionModelEuler::calc,
-          bp::args("self", "data", "x", "u"),
-          "Compute the time-discrete evolution of a differential action "
-          "model.\n\n"
-          "It describes the time-discrete evolution of action model.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calc", &IntegratedActionModel_calc<IntegratedActionModelEuler>,
+           bp::args("self", "data", "x", "u"),
+           "Compute the time-discrete evolution of a differential action "
+           "model.\n\n"
+           "It describes the time-discrete evolution of action model.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelEuler::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
           "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
-      .def<void (IntegratedActionModelEuler::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calcDiff", &IntegratedActionModelEuler::calcDiff,
-          bp::args("self", "data", "x", "u"),
-          "Computes the derivatives of the integrated action model wrt state "
-          "and control. \n\n"
-          "This function builds a quadratic approximation of the\n"
-          "action model (i.e. dynamical system and cost function).\n"
-          "It assumes that calc has been run first.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calcDiff",
+           &IntegratedActionModel_calcDiff<IntegratedActionModelEuler>,
+           bp::args("self", "data", "x", "u"),
+           "Computes the derivatives of the integrated action model wrt state "
+           "and control. \n\n"
+           "This function builds a quadratic approximation of the\n"
+           "action model (i.e. dynamical system and cost function).\n"
+           "It assumes that calc has been run first.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelEuler::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/integrator/implicit-euler.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/integ-action-base.hpp"
+#include "python/crocoddyl/utils/copyable.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeIntegratedActionImplicitEuler() {
+  bp::register_ptr_to_python<
+      std::shared_ptr<IntegratedActionModelImplicitEuler> >();
+
+  bp::enum_<ImplicitEulerType>("ImplicitEulerType")
+      .value("Implicit", Implicit)
+      .value("SemiImplicit", SemiImplicit)
+      .export_values();
+
+  bp::class_<IntegratedActionModelImplicitEuler,
+             bp::bases<IntegratedActionModelAbstract, ActionModelAbstract> >(
+      "IntegratedActionModelImplicitEuler",
+      "Implicit Euler integrator for differential action models.\n\n"
+      "This class implements the backward Euler (Implicit) and the\n"
+      "velocity-implicit Euler (SemiImplicit) integrators, i.e.:\n"
+      "  dx = [v_z, a(z, w)] * dt,  x+ = State.integrate(x, dx),\n"
+      "where z = State.integrate(x, dx) for Implicit and z = [q, v + dv] for\n"
+      "SemiImplicit. The step is solved with Newton iterations, and its\n"
+      "derivatives are computed through the implicit function theorem.",
+      bp::init<std::shared_ptr<DifferentialActionModelAbstract>,
+               ImplicitEulerType, bp::optional<double, bool> >(
+          bp::args("self", "diffModel", "type", "stepTime",
+                   "withCostResidual"),
+          "Initialize the implicit Euler integrator.\n\n"
+          ":param diffModel: differential action model\n"
+          ":param type: type of implicit Euler integrator (options are "
+          "Implicit and SemiImplicit)\n"
+          ":param stepTime: step time (default 1e-3)\n"
+          ":param withCostResidual: includes the cost residuals and "
+          "derivatives (default True)."))
+      .def(bp::init<std::shared_ptr<DifferentialActionModelAbstract>,
+                    std::shared_ptr<ControlParametrizationModelAbstract>,
+                    ImplicitEulerType, bp::optional<double, bool> >(
+          bp::args("self", "diffModel", "control", "type", "stepTime",
+                   "withCostResidual"),
+          "Initialize the implicit Euler integrator.\n\n"
+          ":param diffModel: differential action model\n"
+          ":param control: the control parametrization\n"
+          ":param type: type of implicit Euler integrator (options are "
+          "Implicit and SemiImplicit)\n"
+          ":param stepTime: step time (default 1e-3)\n"
+          ":param withCostResidual: includes the cost residuals and "
+          "derivatives (default True)."))
+      .def("calc",
+           &IntegratedActionModel_calc<IntegratedActionModelImplicitEuler>,
+           bp::args("self", "data", "x", "u"),
+           "Compute the time-discrete evolution of a differential action "
+           "model.\n\n"
+           "It describes the time-discrete evolution of action model.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
+      .def<void (IntegratedActionModelImplicitEuler::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
+      .def("calcDiff",
+           &IntegratedActionModel_calcDiff<IntegratedActionModelImplicitEuler>,
+           bp::args("self", "data", "x", "u"),
+           "Computes the derivatives of the integrated action model wrt state "
+           "and control. \n\n"
+           "This function builds a quadratic approximation of the\n"
+           "action model (i.e. dynamical system and cost function).\n"
+           "It assumes that calc has been run first.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
+      .def<void (IntegratedActionModelImplicitEuler::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &ActionModelAbstract::calcDiff,
+          bp::args("self", "data", "x"))
+      .def("createData", &IntegratedActionModelImplicitEuler::createData,
+           bp::args("self"), "Create the implicit Euler integrator data.")
+      .add_property("type", &IntegratedActionModelImplicitEuler::get_type,
+                    "type of implicit Euler integrator")
+      .add_property("maxiter", &IntegratedActionModelImplicitEuler::get_maxiter,
+                    &IntegratedActionModelImplicitEuler::set_maxiter,
+                    "maximum number of Newton iterations")
+      .add_property("tol", &IntegratedActionModelImplicitEuler::get_tol,
+                    &IntegratedActionModelImplicitEuler::set_tol,
+                    "tolerance on the infinity norm of the residual")
+      .def(CopyableVisitor<IntegratedActionModelImplicitEuler>());
+
+  bp::register_ptr_to_python<
+      std::shared_ptr<IntegratedActionDataImplicitEuler> >();
+
+  bp::class_<IntegratedActionDataImplicitEuler,
+             bp::bases<IntegratedActionDataAbstract> >(
+      "IntegratedActionDataImplicitEuler", "Implicit Euler integrator data.",
+      bp::init<IntegratedActionModelImplicitEuler*>(
+          bp::args("self", "model"),
+          "Create implicit Euler integrator data.\n\n"
+          ":param model: implicit Euler integrator model"))
+      .add_property(
+          "differential",
+          bp::make_getter(&IntegratedActionDataImplicitEuler::differential,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "differential action data at the current state")
+      .add_property(
+          "differential_z",
+          bp::make_getter(&IntegratedActionDataImplicitEuler::differential_z,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "differential action data at the implicit point")
+      .add_property(
+          "control",
+          bp::make_getter(&IntegratedActionDataImplicitEuler::control,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "control parametrization data")
+      .add_property("dx",
+                    bp::make_getter(&IntegratedActionDataImplicitEuler::dx,
+                                    bp::return_internal_reference<>()),
+                    "state increment")
+      .add_property("z",
+                    bp::make_getter(&IntegratedActionDataImplicitEuler::z,
+                                    bp::return_internal_reference<>()),
+                    "implicit point")
+      .add_property("res",
+                    bp::make_getter(&IntegratedActionDataImplicitEuler::res,
+                                    bp::return_internal_reference<>()),
+                    "residual of the implicit step")
+      .add_property("Lwu",
+                    bp::make_getter(&IntegratedActionDataImplicitEuler::Lwu,
+                                    bp::return_internal_reference<>()),
+                    "Hessian of the cost wrt the differential control (w) and "
+                    "the control parameters (u).")
+      .def_readonly("iter", &IntegratedActionDataImplicitEuler::iter,
+                    "number of Newton iterations of the last step")
+      .def(CopyableVisitor<IntegratedActionDataImplicitEuler>());
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/integrator/multi-step.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/integ-action-base.hpp"
+#include "python/crocoddyl/utils/copyable.hpp"
+#include "python/crocoddyl/utils/vector-converter.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeIntegratedActionMultiStep() {
+  // Register custom converters between std::vector and Python list
+  typedef std::shared_ptr<IntegratedActionModelAbstract>
+      IntegratedActionModelPtr;
+  StdVectorPythonVisitor<std::vector<IntegratedActionModelPtr>, true>::expose(
+      "StdVec_IntegratedActionModel");
+
+  bp::register_ptr_to_python<
+      std::shared_ptr<IntegratedActionModelMultiStep> >();
+
+  bp::class_<IntegratedActionModelMultiStep,
+             bp::bases<IntegratedActionModelAbstract, ActionModelAbstract> >(
+      "IntegratedActionModelMultiStep",
+      "Multi-step integrator for differential action models.\n\n"
+      "It chains integrated action models (sub-steps) that share the same "
+      "control parameters. When the sub-steps use consecutive windows of a "
+      "B-spline control, a single spline spans all of them, which reduces the "
+      "number of control parameters per second of motion.",
+      bp::init<std::vector<IntegratedActionModelPtr>,
+               std::shared_ptr<ControlParametrizationModelAbstract>,
+               bp::optional<bool> >(
+          bp::args("self", "steps", "control", "withCostResidual"),
+          "Initialize the multi-step integrator from its sub-steps.\n\n"
+          ":param steps: integrated action models of the sub-steps\n"
+          ":param control: control parametrization of the node\n"
+          ":param withCostResidual: includes the cost residuals and "
+          "derivatives (default True)."))
+      .def(bp::init<std::shared_ptr<DifferentialActionModelAbstract>,
+                    std::size_t, std::size_t,
+                    bp::optional<std::size_t, double, bool> >(
+          bp::args("self", "diffModel", "nsteps", "ncp", "degree", "stepTime",
+                   "withCostResidual"),
+          "Initialize the multi-step integrator with a B-spline control.\n\n"
+          "It creates nsteps Euler sub-steps whose controls are consecutive "
+          "windows of the same B-spline.\n"
+          ":param diffModel: differential action model\n"
+          ":param nsteps: number of sub-steps\n"
+          ":param ncp: number of control points of the spline\n"
+          ":param degree: degree of the spline (default 3)\n"
+          ":param stepTime: duration of the node (default 1e-2)\n"
+          ":param withCostResidual: includes the cost residuals and "
+          "derivatives (default True)."))
+      .def("calc", &IntegratedActionModel_calc<IntegratedActionModelMultiStep>,
+           bp::args("self", "data", "x", "u"),
+           "Compute the time-discrete evolution through the sub-steps.\n\n"
+           ":param data: multi-step data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
+      .def<void (IntegratedActionModelMultiStep::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
+      .def("calcDiff",
+           &IntegratedActionModel_calcDiff<IntegratedActionModelMultiStep>,
+           bp::args("self", "data", "x", "u"),
+           "Computes the derivatives of the multi-step integrator wrt state "
+           "and control.\n\n"
+           "The derivatives of the sub-steps are chained, and the cost "
+           "Hessians use the Gauss-Newton approximation.\n"
+           "It assumes that calc has been run first.\n"
+           ":param data: multi-step data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
+      .def<void (IntegratedActionModelMultiStep::*)(
+          const std::shared_ptr<ActionDataAbstract>&,
+          const Eigen::Ref<const Eigen::VectorXd>&)>(
+          "calcDiff", &ActionModelAbstract::calcDiff,
+          bp::args("self", "data", "x"))
+      .def("createData", &IntegratedActionModelMultiStep::createData,
+           bp::args("self"), "Create the multi-step integrator data.")
+      .add_property(
+          "steps",
+          bp::make_function(&IntegratedActionModelMultiStep::get_steps,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "integrated action models of the sub-steps")
+      .def(CopyableVisitor<IntegratedActionModelMultiStep>());
+
+  bp::register_ptr_to_python<std::shared_ptr<IntegratedActionDataMultiStep> >();
+
+  bp::class_<IntegratedActionDataMultiStep,
+             bp::bases<IntegratedActionDataAbstract> >(
+      "IntegratedActionDataMultiStep", "Multi-step integrator data.",
+      bp::init<IntegratedActionModelMultiStep*>(
+          bp::args("self", "model"),
+          "Create multi-step integrator data.\n\n"
+          ":param model: multi-step integrator model"))
+      .add_property(
+          "steps",
+          bp::make_getter(&IntegratedActionDataMultiStep::steps,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "data of the sub-steps")
+      .add_property("Jx",
+                    bp::make_getter(&IntegratedActionDataMultiStep::Jx,
+                                    bp::return_internal_reference<>()),
+                    "Jacobian of the sub-step state wrt the state")
+      .add_property("Ju",
+                    bp::make_getter(&IntegratedActionDataMultiStep::Ju,
+                                    bp::return_internal_reference<>()),
+                    "Jacobian of the sub-step state wrt the control")
+      .def(CopyableVisitor<IntegratedActionDataMultiStep>());
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -55,36 +55,28 @@ void exposeIntegratedActionRK() {
           ":param stepTime: step time (default 1e-3)\n"
           ":param withCostResidual: includes the cost residuals and "
           "derivatives (default True)."))
-      .def<void (IntegratedActionModelRK::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calc", &IntegratedActionModelRK::calc,
-          bp::args("self", "data", "x", "u"),
-          "Compute the time-discrete evolution of a differential action "
-          "model.\n\n"
-          "It describes the time-discrete evolution of action model.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calc", &IntegratedActionModel_calc<IntegratedActionModelRK>,
+           bp::args("self", "data", "x", "u"),
+           "Compute the time-discrete evolution of a differential action "
+           "model.\n\n"
+           "It describes the time-discrete evolution of action model.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelRK::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
           "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
-      .def<void (IntegratedActionModelRK::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calcDiff", &IntegratedActionModelRK::calcDiff,
-          bp::args("self", "data", "x", "u"),
-          "Computes the derivatives of the integrated action model wrt state "
-          "and control. \n\n"
-          "This function builds a quadratic approximation of the\n"
-          "action model (i.e. dynamical system and cost function).\n"
-          "It assumes that calc has been run first.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calcDiff", &IntegratedActionModel_calcDiff<IntegratedActionModelRK>,
+           bp::args("self", "data", "x", "u"),
+           "Computes the derivatives of the integrated action model wrt state "
+           "and control. \n\n"
+           "This function builds a quadratic approximation of the\n"
+           "action model (i.e. dynamical system and cost function).\n"
+           "It assumes that calc has been run first.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelRK::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
@@ -97,6 +89,11 @@ void exposeIntegratedActionRK() {
           bp::make_function(&IntegratedActionModelRK::get_ni,
                             bp::return_value_policy<bp::return_by_value>()),
           "number of nodes to be integrated")
+      .add_property(
+          "nthreads", bp::make_function(&IntegratedActionModelRK::get_nthreads),
+          bp::make_function(&IntegratedActionModelRK::set_nthreads),
+          "number of threads used to compute the stage derivatives (if you "
+          "set nthreads <= 1, then they are computed sequentially)")
       .def(CopyableVisitor<IntegratedActionModelRK>());
 
   bp::register_ptr_to_python<std::shared_ptr<IntegratedActionDataRK> >();
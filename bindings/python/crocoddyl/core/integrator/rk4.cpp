@@ -52,36 +52,29 @@ void exposeIntegratedActionRK4() {
           ":param stepTime: step time (default 1e-3)\n"
           ":param withCostResidual: includes the cost residuals and "
           "derivatives (default True)."))
-      .def<void (IntegratedActionModelRK4::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calc", &IntegratedActionModelRK4::calc,
-          bp::args("self", "data", "x", "u"),
-          "Compute the time-discrete evolution of a differential action "
-          "model.\n\n"
-          "It describes the time-discrete evolution of action model.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calc", &IntegratedActionModel_calc<IntegratedActionModelRK4>,
+           bp::args("self", "data", "x", "u"),
+           "Compute the time-discrete evolution of a differential action "
+           "model.\n\n"
+           "It describes the time-discrete evolution of action model.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelRK4::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
           "calc", &ActionModelAbstract::calc, bp::args("self", "data", "x"))
-      .def<void (IntegratedActionModelRK4::*)(
-          const std::shared_ptr<ActionDataAbstract>&,
-          const Eigen::Ref<const Eigen::VectorXd>&,
-          const Eigen::Ref<const Eigen::VectorXd>&)>(
-          "calcDiff", &IntegratedActionModelRK4::calcDiff,
-          bp::args("self", "data", "x", "u"),
-          "Computes the derivatives of the integrated action model wrt state "
-          "and control. \n\n"
-          "This function builds a quadratic approximation of the\n"
-          "action model (i.e. dynamical system and cost function).\n"
-          "It assumes that calc has been run first.\n"
-          ":param data: action data\n"
-          ":param x: state point (dim. state.nx)\n"
-          ":param u: control input (dim. nu)")
+      .def("calcDiff",
+           &IntegratedActionModel_calcDiff<IntegratedActionModelRK4>,
+           bp::args("self", "data", "x", "u"),
+           "Computes the derivatives of the integrated action model wrt state "
+           "and control. \n\n"
+           "This function builds a quadratic approximation of the\n"
+           "action model (i.e. dynamical system and cost function).\n"
+           "It assumes that calc has been run first.\n"
+           ":param data: action data\n"
+           ":param x: state point (dim. state.nx)\n"
+           ":param u: control input (dim. nu)")
       .def<void (IntegratedActionModelRK4::*)(
           const std::shared_ptr<ActionDataAbstract>&,
           const Eigen::Ref<const Eigen::VectorXd>&)>(
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "python/crocoddyl/core/mpc/parameters.hpp"
+
+#include "crocoddyl/core/residuals/control.hpp"
+#include "crocoddyl/core/residuals/joint-acceleration.hpp"
+#include "crocoddyl/core/residuals/joint-effort.hpp"
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+typedef ProblemParameters::MatrixXdRowMajor RowMatrixXd;
+
+std::vector<ParameterReferenceBinder>& getParameterReferenceBinders() {
+  static std::vector<ParameterReferenceBinder> binders;
+  return binders;
+}
+
+// Python functions are Python-derived objects, so the GIL is kept while they
+// are bound
+struct ParameterBindingPython : PythonDerived {
+  explicit ParameterBindingPython(bp::object function) : function(function) {}
+
+  void operator()(const std::shared_ptr<ShootingProblem>& problem,
+                  const std::size_t t,
+                  const Eigen::Ref<const Eigen::VectorXd>& value) const {
+    function(problem, t, Eigen::VectorXd(value));
+  }
+
+  bp::object function;
+};
+
+void ProblemParameters_bind(ProblemParameters& self, const std::string& name,
+                            const std::size_t t, bp::object function) {
+  if (!PyCallable_Check(function.ptr())) {
+    PyErr_SetString(PyExc_TypeError, "function has to be callable");
+    bp::throw_error_already_set();
+  }
+  self.bind(name, t, ParameterBindingPython(function));
+}
+
+void ProblemParameters_bindReference(ProblemParameters& self,
+                                     const std::string& name,
+                                     const std::size_t t, bp::object residual) {
+  const std::vector<ParameterReferenceBinder>& binders =
+      getParameterReferenceBinders();
+  for (std::size_t i = 0; i < binders.size(); ++i) {
+    if (binders[i](self, name, t, residual)) {
+      return;
+    }
+  }
+  PyErr_SetString(PyExc_TypeError,
+                  "the reference of this residual model cannot be bound");
+  bp::throw_error_already_set();
+}
+
+void ProblemParameters_set(ProblemParameters& self, const std::string& name,
+                           const Eigen::Ref<const RowMatrixXd>& values) {
+  self.set(name, values);
+}
+
+void ProblemParameters_set_node(
+    ProblemParameters& self, const std::string& name, const std::size_t t,
+    const Eigen::Ref<const Eigen::VectorXd>& value) {
+  self.set(name, t, value);
+}
+
+void ProblemParameters_set_values(ProblemParameters& self,
+                                  const Eigen::Ref<const RowMatrixXd>& values) {
+  self.set_values(values);
+}
+
+void ProblemParameters_set_values_node(
+    ProblemParameters& self, const std::size_t t,
+    const Eigen::Ref<const Eigen::VectorXd>& value) {
+  self.set_values(t, value);
+}
+
+void ProblemParameters_update(ProblemParameters& self) {
+  ScopedGILRelease nogil;
+  self.update();
+}
+
+void ProblemParameters_updateAll(ProblemParameters& self) {
+  ScopedGILRelease nogil;
+  self.updateAll();
+}
+
+RowMatrixXd ProblemParameters_get(const ProblemParameters& self,
+                                  const std::string& name) {
+  return self.get(name);
+}
+
+RowMatrixXd ProblemParameters_values(const ProblemParameters& self) {
+  return self.get_values();
+}
+
+bp::list ProblemParameters_names(const ProblemParameters& self) {
+  bp::list names;
+  for (std::size_t i = 0; i < self.get_names().size(); ++i) {
+    names.append(self.get_names()[i]);
+  }
+  return names;
+}
+
+void exposeProblemParameters() {
+  registerParameterReference<ResidualModelControl>();
+  registerParameterReference<ResidualModelJointEffort>();
+  registerParameterReference<ResidualModelJointAcceleration>();
+
+  bp::class_<ProblemParameters, boost::noncopyable>(
+      "ProblemParameters",
+      "Named parameters of a shooting problem.\n\n"
+      "Each parameter occupies a fixed range of columns of a contiguous "
+      "(T+1) x np table,\n"
+      "i.e., a row per node. The parameters are bound once to the residual "
+      "references,\n"
+      "environment vectors or functions of the nodes. Then, set() modifies "
+      "the values of a\n"
+      "parameter over the whole horizon, and update() writes the modified "
+      "nodes into their\n"
+      "models.",
+      bp::init<std::shared_ptr<ShootingProblem> >(
+          bp::args("self", "problem"),
+          "Initialize the parameters of a shooting problem.\n\n"
+          ":param problem: shooting problem"))
+      .def("addParameter", &ProblemParameters::addParameter,
+           bp::args("self", "name", "value"),
+           "Register a parameter.\n\n"
+           ":param name: name of the parameter\n"
+           ":param value: initial value of the parameter in all the nodes\n"
+           ":returns the index of the first column of the parameter.")
+      .def("bind", &ProblemParameters_bind,
+           bp::args("self", "name", "t", "function"),
+           "Bind a parameter of a node to a function.\n\n"
+           "The function receives the problem, the index of the node and the "
+           "value of the\n"
+           "parameter.\n"
+           ":param name: name of the parameter\n"
+           ":param t: index of the node (0 <= t <= T)\n"
+           ":param function: callable that writes the value into the node")
+      .def("bindReference", &ProblemParameters_bindReference,
+           bp::args("self", "name", "t", "residual"),
+           "Bind a parameter of a node to the reference of a residual "
+           "model.\n\n"
+           ":param name: name of the parameter\n"
+           ":param t: index of the node (0 <= t <= T)\n"
+           ":param residual: residual model of the node")
+      .def("set", &ProblemParameters_set, bp::args("self", "name", "values"),
+           "Modify the value of a parameter in all the nodes.\n\n"
+           ":param name: name of the parameter\n"
+           ":param values: values of the parameter, one node per row ((T+1) "
+           "x n), or a single\n"
+           "value for all the nodes (1 x n)")
+      .def("set", &ProblemParameters_set_node,
+           bp::args("self", "name", "t", "value"),
+           "Modify the value of a parameter in a node.\n\n"
+           ":param name: name of the parameter\n"
+           ":param t: index of the node (0 <= t <= T)\n"
+           ":param value: value of the parameter")
+      .def("set_values", &ProblemParameters_set_values,
+           bp::args("self", "values"),
+           "Modify the values of all the parameters.\n\n"
+           ":param values: table of values ((T+1) x np)")
+      .def("set_values", &ProblemParameters_set_values_node,
+           bp::args("self", "t", "value"),
+           "Modify the values of all the parameters in a node.\n\n"
+           ":param t: index of the node (0 <= t <= T)\n"
+           ":param value: row of values (np)")
+      .def("update", &ProblemParameters_update, bp::args("self"),
+           "Write the modified values into the models of the nodes.")
+      .def("updateAll", &ProblemParameters_updateAll, bp::args("self"),
+           "Write the values of all the nodes into their models.")
+      .def("get", &ProblemParameters_get, bp::args("self", "name"),
+           "Return the values of a parameter, one node per row.\n\n"
+           ":param name: name of the parameter")
+      .def("offset", &ProblemParameters::get_offset, bp::args("self", "name"),
+           "Return the index of the first column of a parameter.\n\n"
+           ":param name: name of the parameter")
+      .def("dim", &ProblemParameters::get_dim, bp::args("self", "name"),
+           "Return the dimension of a parameter.\n\n"
+           ":param name: name of the parameter")
+      .add_property("values", &ProblemParameters_values, "table of values")
+      .add_property("names", &ProblemParameters_names,
+                    "names of the parameters in their column order")
+      .add_property("nparams", &ProblemParameters::get_nparams,
+                    "total dimension of the parameters")
+      .add_property("nbindings", &ProblemParameters::get_nbindings,
+                    "number of bindings")
+      .add_property(
+          "problem",
+          bp::make_function(&ProblemParameters::get_problem,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "shooting problem");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
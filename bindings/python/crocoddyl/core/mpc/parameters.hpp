@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef BINDINGS_PYTHON_CROCODDYL_CORE_MPC_PARAMETERS_HPP_
+#define BINDINGS_PYTHON_CROCODDYL_CORE_MPC_PARAMETERS_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "crocoddyl/core/mpc/parameters.hpp"
+#include "python/crocoddyl/fwd.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+typedef std::function<bool(ProblemParameters&, const std::string&,
+                           const std::size_t, bp::object)>
+    ParameterReferenceBinder;
+
+/**
+ * @brief Return the binders of the residual references exposed to Python
+ *
+ * Each binder returns false if the residual model is not of its type.
+ */
+std::vector<ParameterReferenceBinder>& getParameterReferenceBinders();
+
+/**
+ * @brief Register a residual model whose reference can be bound from Python
+ */
+template <class Residual>
+void registerParameterReference() {
+  getParameterReferenceBinders().push_back(
+      [](ProblemParameters& self, const std::string& name, const std::size_t t,
+         bp::object residual) {
+        bp::extract<std::shared_ptr<Residual> > extractor(residual);
+        if (!extractor.check()) {
+          return false;
+        }
+        self.bindReference(name, t, extractor());
+        return true;
+      });
+}
+
+}  // namespace python
+}  // namespace crocoddyl
+
+#endif  // BINDINGS_PYTHON_CROCODDYL_CORE_MPC_PARAMETERS_HPP_
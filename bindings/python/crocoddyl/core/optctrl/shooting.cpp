@@ -9,16 +9,100 @@
 
 #include "crocoddyl/core/optctrl/shooting.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "python/crocoddyl/core/core.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 #include "python/crocoddyl/utils/deprecate.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 #include "python/crocoddyl/utils/printable.hpp"
 
 namespace crocoddyl {
 namespace python {
 
+// The problem evaluations release the GIL, as they do not call Python unless
+// there are Python-derived models
+
+double ShootingProblem_calc(ShootingProblem& self,
+                            const std::vector<Eigen::VectorXd>& xs,
+                            const std::vector<Eigen::VectorXd>& us) {
+  ScopedGILRelease nogil;
+  return self.calc(xs, us);
+}
+
+double ShootingProblem_calcDiff(ShootingProblem& self,
+                                const std::vector<Eigen::VectorXd>& xs,
+                                const std::vector<Eigen::VectorXd>& us) {
+  ScopedGILRelease nogil;
+  return self.calcDiff(xs, us);
+}
+
+double ShootingProblem_calcAndDiff(ShootingProblem& self,
+                                   const std::vector<Eigen::VectorXd>& xs,
+                                   const std::vector<Eigen::VectorXd>& us) {
+  ScopedGILRelease nogil;
+  return self.calcAndDiff(xs, us);
+}
+
+std::vector<Eigen::VectorXd> ShootingProblem_rollout(
+    ShootingProblem& self, const std::vector<Eigen::VectorXd>& us) {
+  ScopedGILRelease nogil;
+  return self.rollout_us(us);
+}
+
+bp::tuple ShootingProblem_rollouts(ShootingProblem& self, const bp::list& uss,
+                                   const bp::list& x0s = bp::list()) {
+  const std::size_t nus = static_cast<std::size_t>(bp::len(uss));
+  const std::size_t nx0s = static_cast<std::size_t>(bp::len(x0s));
+  std::vector<std::vector<Eigen::VectorXd> > uss_(nus);
+  std::vector<Eigen::VectorXd> x0s_(nx0s);
+  for (std::size_t k = 0; k < nus; ++k) {
+    uss_[k] = bp::extract<std::vector<Eigen::VectorXd> >(uss[k])();
+  }
+  for (std::size_t k = 0; k < nx0s; ++k) {
+    x0s_[k] = bp::extract<Eigen::VectorXd>(x0s[k])();
+  }
+  std::vector<std::vector<Eigen::VectorXd> > xss;
+  std::vector<double> costs;
+  const std::size_t K = std::max(nus, nx0s);
+  if (PythonDerived::alive() && (nus == 1 || nus == K) &&
+      (nx0s <= 1 || nx0s == K)) {
+    // Python-derived models cannot be evaluated by the worker threads, so the
+    // rollouts run one at a time in this thread
+    std::vector<std::vector<Eigen::VectorXd> > uss_k(1), xss_k;
+    std::vector<Eigen::VectorXd> x0s_k(nx0s == 0 ? 0 : 1);
+    std::vector<double> costs_k;
+    xss.resize(K);
+    costs.resize(K);
+    for (std::size_t k = 0; k < K; ++k) {
+      uss_k[0] = uss_[nus == 1 ? 0 : k];
+      if (nx0s != 0) {
+        x0s_k[0] = x0s_[nx0s == 1 ? 0 : k];
+      }
+      self.rollouts(uss_k, x0s_k, xss_k, costs_k);
+      xss[k] = xss_k[0];
+      costs[k] = costs_k[0];
+    }
+  } else {
+    // The models and datas replaced since the last rollouts are released
+    // before the worker threads run without the GIL
+    self.allocateRolloutData(
+        std::max<std::size_t>(std::min(self.get_nthreads(), K), 1));
+    ScopedGILRelease nogil;
+    self.rollouts(uss_, x0s_, xss, costs);
+  }
+  bp::list xss_, costs_;
+  for (std::size_t k = 0; k < xss.size(); ++k) {
+    xss_.append(xss[k]);
+    costs_.append(costs[k]);
+  }
+  return bp::make_tuple(xss_, costs_);
+}
+
+BOOST_PYTHON_FUNCTION_OVERLOADS(ShootingProblem_rollouts_overloads,
+                                ShootingProblem_rollouts, 2, 3)
+
 void exposeShootingProblem() {
 // TODO: Remove once the deprecated update call has been removed in a future
 // release
@@ -60,7 +144,7 @@ void exposeShootingProblem() {
           ":param terminalModel: terminal action model\n"
           ":param runningDatas: running action datas  (size T)\n"
           ":param terminalData: terminal action data"))
-      .def("calc", &ShootingProblem::calc, bp::args("self", "xs", "us"),
+      .def("calc", &ShootingProblem_calc, bp::args("self", "xs", "us"),
            "Compute the cost and the next states.\n\n"
            "For each node k, and along the state xs and control us "
            "trajectories, it computes the next state x_{k+1}\n"
@@ -68,7 +152,7 @@ void exposeShootingProblem() {
            ":param xs: time-discrete state trajectory (size T+1)\n"
            ":param us: time-discrete control sequence (size T)\n"
            ":returns the total cost value")
-      .def("calcDiff", &ShootingProblem::calcDiff, bp::args("self", "xs", "us"),
+      .def("calcDiff", &ShootingProblem_calcDiff, bp::args("self", "xs", "us"),
            "Compute the derivatives of the cost and dynamics.\n\n"
            "For each node k, and along the state x_s and control u_s "
            "trajectories, it computes the derivatives of\n"
@@ -76,10 +160,31 @@ void exposeShootingProblem() {
            ":param xs: time-discrete state trajectory (size T+1)\n"
            ":param us: time-discrete control sequence (size T)\n"
            ":returns the total cost value")
-      .def("rollout", &ShootingProblem::rollout_us, bp::args("self", "us"),
+      .def("calcAndDiff", &ShootingProblem_calcAndDiff,
+           bp::args("self", "xs", "us"),
+           "Compute the cost, next states and their derivatives.\n\n"
+           "It is equivalent to run calc followed by calcDiff, but each node "
+           "is visited once.\n"
+           ":param xs: time-discrete state trajectory (size T+1)\n"
+           ":param us: time-discrete control sequence (size T)\n"
+           ":returns the total cost value")
+      .def("rollout", &ShootingProblem_rollout, bp::args("self", "us"),
            "Integrate the dynamics given a control sequence.\n\n"
            "Rollout the dynamics give a sequence of control commands\n"
            ":param us: time-discrete control sequence (size T)")
+      .def("rollouts", &ShootingProblem_rollouts,
+           ShootingProblem_rollouts_overloads(
+               bp::args("self", "uss", "x0s"),
+               "Integrate the dynamics of a batch of control sequences and "
+               "initial states.\n\n"
+               "The rollouts are simulated in parallel, each thread using its "
+               "own data, and\n"
+               "the batch size K is the largest size of uss and x0s.\n"
+               ":param uss: control sequences (size 1 or K, each of size T)\n"
+               ":param x0s: initial states (size 0, 1 or K; default [], i.e., "
+               "the initial state of the problem)\n"
+               ":return the state trajectories and total costs of the "
+               "rollouts (size K)"))
       .def("quasiStatic", &ShootingProblem::quasiStatic_xs,
            bp::args("self", "xs"),
            "Compute the quasi static commands given a state trajectory.\n\n"
@@ -103,6 +208,12 @@ void exposeShootingProblem() {
           "removed as in a circular buffer.\n"
           "Note that this method allocates new data for the end running node.\n"
           ":param model: new model")
+      .def("shift", &ShootingProblem::shift, bp::args("self", "n"),
+           "Shift the running nodes by n positions.\n\n"
+           "The first n running models and datas are moved onto the end of "
+           "the horizon\n"
+           "as in a circular buffer, without allocating new data.\n"
+           ":param n: number of shifted nodes (0 <= n <= T)")
       .def("updateNode", &ShootingProblem::updateNode,
            bp::args("self", "i", "model", "data"),
            "Update the model and data for a specific node.\n\n"
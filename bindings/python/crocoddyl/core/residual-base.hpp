@@ -12,12 +12,14 @@
 #include "crocoddyl/core/residual-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ResidualModelAbstract_wrap : public ResidualModelAbstract,
-                                   public bp::wrapper<ResidualModelAbstract> {
+                                   public bp::wrapper<ResidualModelAbstract>,
+                                   public PythonDerived {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   using ResidualModelAbstract::nu_;
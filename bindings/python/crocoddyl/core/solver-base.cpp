@@ -16,6 +16,49 @@
 namespace crocoddyl {
 namespace python {
 
+bp::list SolverIterationStats_trial_times(const SolverIterationStats& stats) {
+  bp::list trial_times;
+  for (std::size_t i = 0; i < stats.trial_times.size(); ++i) {
+    trial_times.append(stats.trial_times[i]);
+  }
+  return trial_times;
+}
+
+bp::list SolverAbstract_stats(const SolverAbstract& solver) {
+  bp::list stats;
+  for (std::size_t i = 0; i < solver.get_nstats(); ++i) {
+    stats.append(solver.get_stats(i));
+  }
+  return stats;
+}
+
+bp::object SolverAbstract_xsArray(const SolverAbstract& self) {
+  return stackTrajectory(self.get_xs(), "xs");
+}
+
+// The warm starts go through setCandidate, which resets the feasibility flag
+void SolverAbstract_set_xsArray(SolverAbstract& self,
+                                const Eigen::MatrixXd& xs) {
+  std::vector<Eigen::VectorXd> xs_warm = self.get_xs();
+  unstackTrajectory(xs, xs_warm, "xsArray");
+  self.setCandidate(xs_warm, self.get_us(), false);
+}
+
+bp::object SolverAbstract_usArray(const SolverAbstract& self) {
+  return stackTrajectory(self.get_us(), "us");
+}
+
+void SolverAbstract_set_usArray(SolverAbstract& self,
+                                const Eigen::MatrixXd& us) {
+  std::vector<Eigen::VectorXd> us_warm = self.get_us();
+  unstackTrajectory(us, us_warm, "usArray");
+  self.setCandidate(self.get_xs(), us_warm, false);
+}
+
+bp::object SolverAbstract_fsArray(const SolverAbstract& self) {
+  return stackTrajectory(self.get_fs(), "fs");
+}
+
 void exposeSolverAbstract() {
   // Register custom converters between std::vector and Python list
   typedef std::shared_ptr<CallbackAbstract> CallbackAbstractPtr;
@@ -27,6 +70,70 @@ void exposeSolverAbstract() {
       .value("L1", L1)
       .export_values();
 
+  bp::enum_<ShiftPolicy>("ShiftPolicy")
+      .value("RepeatLast", RepeatLast)
+      .value("QuasiStatic", QuasiStatic)
+      .value("TerminalRollout", TerminalRollout)
+      .export_values();
+
+  bp::enum_<DeadlineStatus>("DeadlineStatus")
+      .value("DeadlineNone", DeadlineNone)
+      .value("DeadlineIteration", DeadlineIteration)
+      .value("DeadlineBackwardPass", DeadlineBackwardPass)
+      .value("DeadlineLineSearch", DeadlineLineSearch)
+      .export_values();
+
+  bp::class_<SolverIterationStats>(
+      "SolverIterationStats",
+      "Statistics of a solver iteration.\n\n"
+      "The wall times are measured in seconds with the clock used to check "
+      "the time\n"
+      "budget. Only the phases run in the iteration are timed.",
+      bp::init<>(bp::args("self"), "Initialize the iteration statistics."))
+      .def_readonly("solve", &SolverIterationStats::solve, "index of the solve")
+      .def_readonly("iter", &SolverIterationStats::iter,
+                    "index of the iteration within the solve")
+      .def_readonly("start_time", &SolverIterationStats::start_time,
+                    "start of the iteration since the solve started")
+      .def_readonly("iteration_time", &SolverIterationStats::iteration_time,
+                    "duration of the iteration")
+      .def_readonly("calc_time", &SolverIterationStats::calc_time,
+                    "duration of the derivatives computation")
+      .def_readonly("backward_time", &SolverIterationStats::backward_time,
+                    "duration of the backward passes")
+      .add_property("trial_times",
+                    bp::make_function(&SolverIterationStats_trial_times),
+                    "duration of each forward pass of the line search")
+      .def_readonly("cost", &SolverIterationStats::cost,
+                    "cost after the iteration")
+      .def_readonly("merit", &SolverIterationStats::merit,
+                    "merit after the iteration")
+      .def_readonly("stop", &SolverIterationStats::stop,
+                    "stopping criteria after the iteration")
+      .def_readonly("stepLength", &SolverIterationStats::steplength,
+                    "last step length tried by the line search")
+      .def_readonly("dV", &SolverIterationStats::dV,
+                    "cost reduction of the last step length")
+      .def_readonly("dVexp", &SolverIterationStats::dVexp,
+                    "expected cost reduction of the last step length")
+      .def_readonly("preg", &SolverIterationStats::preg,
+                    "primal-variable regularization of the backward pass")
+      .def_readonly("dreg", &SolverIterationStats::dreg,
+                    "dual-variable regularization of the backward pass")
+      .def_readonly("feas", &SolverIterationStats::feas,
+                    "total feasibility after the iteration")
+      .def_readonly("ffeas", &SolverIterationStats::ffeas,
+                    "dynamic feasibility after the iteration")
+      .def_readonly("gfeas", &SolverIterationStats::gfeas,
+                    "inequality feasibility after the iteration")
+      .def_readonly("hfeas", &SolverIterationStats::hfeas,
+                    "equality feasibility after the iteration")
+      .def_readonly("isFeasible", &SolverIterationStats::is_feasible,
+                    "true if the iterate is dynamically feasible")
+      .def_readonly("deadline_status", &SolverIterationStats::deadline_status,
+                    "phase stopped by the time budget")
+      .def(CopyableVisitor<SolverIterationStats>());
+
   bp::class_<SolverAbstract_wrap, boost::noncopyable>(
       "SolverAbstract",
       "Abstract class for optimal control solvers.\n\n"
@@ -129,6 +236,20 @@ void exposeSolverAbstract() {
                ":param isFeasible: true if the xs are obtained from "
                "integrating the\n"
                "us (rollout)."))
+      .def("shift", &SolverAbstract_wrap::shift,
+           shift_overloads(
+               bp::args("self", "n", "policy"),
+               "Shift the horizon by n nodes.\n\n"
+               "It shifts the running nodes of the shooting problem together "
+               "with the\n"
+               "current guess and the solver data of each node. The shift is "
+               "done in\n"
+               "place and the previous solution (e.g., the Riccati gains) is "
+               "kept to\n"
+               "warm-start the next solve.\n"
+               ":param n: number of shifted nodes (0 <= n <= T)\n"
+               ":param policy: initialization of the appended nodes (default "
+               "RepeatLast)"))
       .def("computeDynamicFeasibility",
            &SolverAbstract_wrap::computeDynamicFeasibility, bp::args("self"),
            "Compute the dynamic feasibility for the current guess.\n\n"
@@ -164,6 +285,8 @@ void exposeSolverAbstract() {
            bp::args("self"),
            "Return the list of callback functions using for diagnostic.\n\n"
            ":return set of callback functions.")
+      .def("clearStats", &SolverAbstract_wrap::clearStats, bp::args("self"),
+           "Remove the recorded iteration statistics.")
       .add_property("problem",
                     bp::make_function(
                         &SolverAbstract_wrap::get_problem,
@@ -172,6 +295,22 @@ void exposeSolverAbstract() {
       .def_readwrite("xs", &SolverAbstract_wrap::xs_, "state trajectory")
       .def_readwrite("us", &SolverAbstract_wrap::us_, "control sequence")
       .def_readwrite("fs", &SolverAbstract_wrap::fs_, "dynamics gaps")
+      .add_property("xsArray", &SolverAbstract_xsArray,
+                    &SolverAbstract_set_xsArray,
+                    "state trajectory stacked into a (T+1) x nx array.\n\n"
+                    "Each access copies the trajectory into a single "
+                    "read-only array, instead of a\n"
+                    "list of T+1 arrays, i.e., it is not a view of the "
+                    "solver's trajectory. Setting\n"
+                    "it warm-starts the solver through setCandidate, then "
+                    "the guess is not feasible.")
+      .add_property("usArray", &SolverAbstract_usArray,
+                    &SolverAbstract_set_usArray,
+                    "control sequence stacked into a T x nu array (all the "
+                    "nodes need to have the\n"
+                    "same control dimension). It behaves as xsArray.")
+      .add_property("fsArray", &SolverAbstract_fsArray,
+                    "dynamics gaps stacked into a read-only (T+1) x ndx array")
       .def_readwrite("isFeasible", &SolverAbstract_wrap::is_feasible_,
                      "feasible (xs,us)")
       .def_readwrite("cost", &SolverAbstract_wrap::cost_,
@@ -256,6 +395,24 @@ void exposeSolverAbstract() {
           "norm used to compute the dynamic and constraints feasibility")
       .def_readwrite("iter", &SolverAbstract_wrap::iter_,
                      "number of iterations runned in solve()")
+      .add_property("time_budget",
+                    bp::make_function(&SolverAbstract_wrap::get_time_budget),
+                    bp::make_function(&SolverAbstract_wrap::set_time_budget),
+                    "wall-clock time budget of a solve in seconds")
+      .add_property(
+          "deadline_status",
+          bp::make_function(&SolverAbstract_wrap::get_deadline_status),
+          "phase at which the time budget stopped the last solve")
+      .add_property(
+          "stats_capacity",
+          bp::make_function(&SolverAbstract_wrap::get_stats_capacity),
+          bp::make_function(&SolverAbstract_wrap::set_stats_capacity),
+          "number of iteration statistics kept by the solver (a zero "
+          "capacity\n"
+          "disables the recording)")
+      .add_property("stats", bp::make_function(&SolverAbstract_stats),
+                    "statistics of the recorded iterations, from the oldest "
+                    "to the latest")
       .def(CopyableVisitor<SolverAbstract_wrap>());
 
   bp::class_<CallbackAbstract_wrap, boost::noncopyable>(
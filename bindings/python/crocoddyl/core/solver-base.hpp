@@ -15,7 +15,9 @@
 #include <vector>
 
 #include "crocoddyl/core/solver-base.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
@@ -100,8 +102,74 @@ class CallbackAbstract_wrap : public CallbackAbstract,
   }
 };
 
+// Solve the problem releasing the GIL, which is kept if the solver or its
+// callbacks call Python overrides
+template <class Solver>
+bool Solver_solve(Solver& self,
+                  const std::vector<Eigen::VectorXd>& init_xs = DEFAULT_VECTOR,
+                  const std::vector<Eigen::VectorXd>& init_us = DEFAULT_VECTOR,
+                  const std::size_t maxiter = 100,
+                  const bool is_feasible = false,
+                  const double init_reg = NAN) {
+  ScopedGILRelease nogil(!isPythonDerived(&self) &&
+                         !isPythonDerived(self.getCallbacks()));
+  return self.solve(init_xs, init_us, maxiter, is_feasible, init_reg);
+}
+
+typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+    RowMatrixXd;
+
+// Stack a trajectory of vectors or row-major matrices into the rows of a single
+// array, which avoids creating a NumPy array per node. Matrices are flattened
+// in row-major order, so the array can be reshaped without copies. The array
+// is a copy of the trajectory (the solver stores a vector per node), so it is
+// read-only: in-place writes raise an error instead of being silently lost.
+template <typename Matrix>
+bp::object stackTrajectory(const std::vector<Matrix>& trajectory,
+                           const std::string& name) {
+  const std::size_t n = trajectory.size();
+  const Eigen::Index size = n == 0 ? 0 : trajectory[0].size();
+  RowMatrixXd array(n, size);
+  for (std::size_t i = 0; i < n; ++i) {
+    const Matrix& element = trajectory[i];
+    if (element.size() != size) {
+      throw_pretty("Invalid argument: "
+                   << name + " has elements of different dimensions, so it "
+                             "cannot be stacked into an array");
+    }
+    array.row(i) = Eigen::Map<const Eigen::RowVectorXd>(element.data(), size);
+  }
+  bp::object object(array);
+  object.attr("setflags")(false);
+  return object;
+}
+
+// Copy the rows of an array into the elements of a trajectory with the same
+// dimensions, without reallocating them
+inline void unstackTrajectory(const Eigen::MatrixXd& array,
+                              std::vector<Eigen::VectorXd>& trajectory,
+                              const std::string& name) {
+  const std::size_t n = trajectory.size();
+  if (static_cast<std::size_t>(array.rows()) != n) {
+    throw_pretty("Invalid argument: " << name + " has to have " +
+                                             std::to_string(n) + " rows");
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (array.cols() != trajectory[i].size()) {
+      throw_pretty("Invalid argument: "
+                   << name + " has wrong dimension (it should have " +
+                          std::to_string(trajectory[i].size()) + " columns)");
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    trajectory[i] = array.row(i).transpose();
+  }
+}
+
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(setCandidate_overloads,
                                        SolverAbstract::setCandidate, 0, 3)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(shift_overloads, SolverAbstract::shift,
+                                       1, 2)
 
 }  // namespace python
 }  // namespace crocoddyl
@@ -11,6 +11,7 @@
 
 #include "python/crocoddyl/core/core.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
+#include "python/crocoddyl/utils/deprecate.hpp"
 
 namespace crocoddyl {
 namespace python {
@@ -18,6 +19,10 @@ namespace python {
 void exposeSolverBoxDDP() {
   bp::register_ptr_to_python<std::shared_ptr<SolverBoxDDP> >();
 
+#pragma GCC diagnostic push  // TODO: Remove once the deprecated Quu_inv has
+                             // been removed in a future release
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
   bp::class_<SolverBoxDDP, bp::bases<SolverDDP> >(
       "SolverBoxDDP",
       "Box-constrained DDP solver.\n\n"
@@ -31,9 +36,13 @@ void exposeSolverBoxDDP() {
           "Quu_inv",
           make_function(
               &SolverBoxDDP::get_Quu_inv,
-              bp::return_value_policy<bp::reference_existing_object>()),
-          "inverse of the Quu computed by the box QP")
+              deprecated<
+                  bp::return_value_policy<bp::reference_existing_object> >(
+                  "Deprecated. The inverse of Quu is not computed anymore")),
+          "inverse of the Quu computed by the box QP (it raises an error)")
       .def(CopyableVisitor<SolverBoxDDP>());
+
+#pragma GCC diagnostic pop
 }
 
 }  // namespace python
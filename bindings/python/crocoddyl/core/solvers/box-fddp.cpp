@@ -10,6 +10,7 @@
 
 #include "python/crocoddyl/core/core.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
+#include "python/crocoddyl/utils/deprecate.hpp"
 
 namespace crocoddyl {
 namespace python {
@@ -17,6 +18,10 @@ namespace python {
 void exposeSolverBoxFDDP() {
   bp::register_ptr_to_python<std::shared_ptr<SolverBoxFDDP> >();
 
+#pragma GCC diagnostic push  // TODO: Remove once the deprecated Quu_inv has
+                             // been removed in a future release
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
   bp::class_<SolverBoxFDDP, bp::bases<SolverFDDP> >(
       "SolverBoxFDDP",
       "Box-constrained FDDP solver.\n\n"
@@ -30,9 +35,13 @@ void exposeSolverBoxFDDP() {
           "Quu_inv",
           make_function(
               &SolverBoxFDDP::get_Quu_inv,
-              bp::return_value_policy<bp::reference_existing_object>()),
-          "inverse of the Quu computed by the box QP")
+              deprecated<
+                  bp::return_value_policy<bp::reference_existing_object> >(
+                  "Deprecated. The inverse of Quu is not computed anymore")),
+          "inverse of the Quu computed by the box QP (it raises an error)")
       .def(CopyableVisitor<SolverBoxFDDP>());
+
+#pragma GCC diagnostic pop
 }
 
 }  // namespace python
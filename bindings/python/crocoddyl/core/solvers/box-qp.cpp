@@ -108,6 +108,9 @@ void exposeSolverBoxQP() {
                         bp::return_value_policy<bp::copy_const_reference>()),
                     bp::make_function(&BoxQP::set_alphas),
                     "list of step length (alpha) values")
+      .add_property("withInverse", bp::make_function(&BoxQP::get_with_inverse),
+                    bp::make_function(&BoxQP::set_with_inverse),
+                    "compute the inverse of the free Hessian (default True)")
       .def(CopyableVisitor<BoxQP>());
 }
 
@@ -10,18 +10,27 @@
 #include "crocoddyl/core/solvers/ddp.hpp"
 
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 #include "python/crocoddyl/utils/deprecate.hpp"
 
 namespace crocoddyl {
 namespace python {
 
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_solves, SolverDDP::solve, 0, 5)
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverDDP_solves, Solver_solve<SolverDDP>, 1, 6)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_computeDirections,
                                        SolverDDP::computeDirection, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverDDP_trySteps, SolverDDP::tryStep,
                                        0, 1)
 
+bp::object SolverDDP_KArray(const SolverDDP& self) {
+  return stackTrajectory(self.get_K(), "K");
+}
+
+bp::object SolverDDP_kArray(const SolverDDP& self) {
+  return stackTrajectory(self.get_k(), "k");
+}
+
 void exposeSolverDDP() {
   bp::register_ptr_to_python<std::shared_ptr<SolverDDP> >();
 
@@ -42,7 +51,7 @@ void exposeSolverDDP() {
           bp::args("self", "problem"),
           "Initialize the vector dimension.\n\n"
           ":param problem: shooting problem."))
-      .def("solve", &SolverDDP::solve,
+      .def("solve", &Solver_solve<SolverDDP>,
            SolverDDP_solves(
                bp::args("self", "init_xs", "init_us", "maxiter", "is_feasible",
                         "init_reg"),
@@ -176,13 +185,21 @@ void exposeSolverDDP() {
           make_function(
               &SolverDDP::get_K,
               bp::return_value_policy<bp::reference_existing_object>()),
-          "K")
+          bp::make_function(&SolverDDP::set_K), "K")
       .add_property(
           "k",
           make_function(
               &SolverDDP::get_k,
               bp::return_value_policy<bp::reference_existing_object>()),
-          "k")
+          bp::make_function(&SolverDDP::set_k), "k")
+      .add_property("KArray", &SolverDDP_KArray,
+                    "feedback gains stacked into a read-only T x (nu*ndx) "
+                    "array, whose rows are the\n"
+                    "gains in "
+                    "row-major order (i.e., KArray.reshape(T, nu, ndx) does "
+                    "not copy them)")
+      .add_property("kArray", &SolverDDP_kArray,
+                    "feedforward gains stacked into a read-only T x nu array")
       .add_property(
           "reg_incFactor", bp::make_function(&SolverDDP::get_reg_incfactor),
           bp::make_function(&SolverDDP::set_reg_incfactor),
@@ -10,13 +10,14 @@
 #include "crocoddyl/core/solvers/fddp.hpp"
 
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 
 namespace crocoddyl {
 namespace python {
 
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverFDDP_solves, SolverFDDP::solve, 0,
-                                       5)
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverFDDP_solves, Solver_solve<SolverFDDP>, 1,
+                                6)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverFDDP_computeDirections,
                                        SolverDDP::computeDirection, 0, 1)
 
@@ -40,7 +41,7 @@ void exposeSolverFDDP() {
           bp::args("self", "problem"),
           "Initialize the vector dimension.\n\n"
           ":param problem: shooting problem."))
-      .def("solve", &SolverFDDP::solve,
+      .def("solve", &Solver_solve<SolverFDDP>,
            SolverFDDP_solves(
                bp::args("self", "init_xs", "init_us", "maxiter", "is_feasible",
                         "init_reg"),
@@ -70,6 +71,23 @@ void exposeSolverFDDP() {
       .def("updateExpectedImprovement", &SolverFDDP::updateExpectedImprovement,
            bp::return_value_policy<bp::reference_existing_object>(),
            bp::args("self"), "Update the expected improvement model\n\n")
+      .def("prepareRTI", &SolverFDDP::prepareRTI, bp::args("self"),
+           "Run the preparation phase of a real-time iteration (RTI).\n\n"
+           "It computes the derivatives and runs the backward pass around the "
+           "current\n"
+           "guess, whose initial state is the predicted one. It runs before "
+           "the new\n"
+           "measurement arrives.\n"
+           ":returns false if the regularization reached its maximum value.")
+      .def("feedbackRTI", &SolverFDDP::feedbackRTI, bp::args("self", "x0"),
+           "Run the feedback phase of a real-time iteration (RTI).\n\n"
+           "It applies the gains computed by prepareRTI from the measured "
+           "initial state\n"
+           "and rolls out the dynamics with a full step. The rollout is "
+           "accepted as the\n"
+           "new guess, and its first control is the command to apply.\n"
+           ":param x0: measured initial state\n"
+           ":returns false if the rollout failed.")
       .add_property("th_acceptNegStep",
                     bp::make_function(&SolverFDDP::get_th_acceptnegstep),
                     bp::make_function(&SolverFDDP::set_th_acceptnegstep),
@@ -9,13 +9,14 @@
 #include "crocoddyl/core/solvers/intro.hpp"
 
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 
 namespace crocoddyl {
 namespace python {
 
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverIntro_solves, SolverIntro::solve,
-                                       0, 5)
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverIntro_solves, Solver_solve<SolverIntro>,
+                                1, 6)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverIntro_trySteps,
                                        SolverIntro::tryStep, 0, 1)
 
@@ -33,7 +34,7 @@ void exposeSolverIntro() {
                          bp::args("self", "problem"),
                          "Initialize the vector dimension.\n\n"
                          ":param problem: shooting problem."))
-      .def("solve", &SolverIntro::solve,
+      .def("solve", &Solver_solve<SolverIntro>,
            SolverIntro_solves(
                bp::args("self", "init_xs", "init_us", "maxiter", "is_feasible",
                         "init_reg"),
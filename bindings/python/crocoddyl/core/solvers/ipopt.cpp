@@ -3,13 +3,14 @@
 #include "crocoddyl/core/solvers/ipopt.hpp"
 
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 
 namespace crocoddyl {
 namespace python {
 
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverIpopt_solves, SolverIpopt::solve,
-                                       0, 5)
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverIpopt_solves, Solver_solve<SolverIpopt>,
+                                1, 6)
 
 void exposeSolverIpopt() {
   bp::register_ptr_to_python<std::shared_ptr<SolverIpopt>>();
@@ -17,7 +18,7 @@ void exposeSolverIpopt() {
       "SolverIpopt",
       bp::init<const std::shared_ptr<crocoddyl::ShootingProblem>&>(
           bp::args("self", "problem"), "Initialize solver"))
-      .def("solve", &SolverIpopt::solve,
+      .def("solve", &Solver_solve<SolverIpopt>,
            SolverIpopt_solves(
                bp::args("self", "init_xs", "init_us", "maxiter", "is_feasible",
                         "init_reg"),
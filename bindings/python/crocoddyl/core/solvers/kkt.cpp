@@ -9,12 +9,13 @@
 #include "crocoddyl/core/solvers/kkt.hpp"
 
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 
 namespace crocoddyl {
 namespace python {
 
-BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverKKT_solves, SolverKKT::solve, 0, 5)
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverKKT_solves, Solver_solve<SolverKKT>, 1, 6)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverKKT_computeDirections,
                                        SolverKKT::computeDirection, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverKKT_trySteps, SolverKKT::tryStep,
@@ -34,7 +35,7 @@ void exposeSolverKKT() {
           bp::args("self", "problem"),
           "Initialize the vector dimension.\n\n"
           ":param problem: shooting problem."))
-      .def("solve", &SolverKKT::solve,
+      .def("solve", &Solver_solve<SolverKKT>,
            SolverKKT_solves(
                bp::args("self", "init_xs", "init_us", "maxiter", "isFeasible",
                         "regInit"),
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/solvers/mppi.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/core/solver-base.hpp"
+#include "python/crocoddyl/utils/copyable.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+bp::list SolverMPPI_us_samples(const SolverMPPI& solver) {
+  const std::vector<std::vector<Eigen::VectorXd> >& samples =
+      solver.get_us_samples();
+  bp::list us_samples;
+  for (std::size_t k = 0; k < samples.size(); ++k) {
+    us_samples.append(samples[k]);
+  }
+  return us_samples;
+}
+
+bp::list SolverMPPI_xs_samples(const SolverMPPI& solver) {
+  const std::vector<std::vector<Eigen::VectorXd> >& samples =
+      solver.get_xs_samples();
+  bp::list xs_samples;
+  for (std::size_t k = 0; k < samples.size(); ++k) {
+    xs_samples.append(samples[k]);
+  }
+  return xs_samples;
+}
+
+bp::list SolverMPPI_costs(const SolverMPPI& solver) {
+  bp::list costs;
+  for (std::size_t k = 0; k < solver.get_costs().size(); ++k) {
+    costs.append(solver.get_costs()[k]);
+  }
+  return costs;
+}
+
+bp::list SolverMPPI_weights(const SolverMPPI& solver) {
+  bp::list weights;
+  for (std::size_t k = 0; k < solver.get_weights().size(); ++k) {
+    weights.append(solver.get_weights()[k]);
+  }
+  return weights;
+}
+
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverMPPI_solves, Solver_solve<SolverMPPI>, 1,
+                                6)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverMPPI_computeDirections,
+                                       SolverMPPI::computeDirection, 0, 1)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolverMPPI_trySteps,
+                                       SolverMPPI::tryStep, 0, 1)
+
+void exposeSolverMPPI() {
+  bp::register_ptr_to_python<std::shared_ptr<SolverMPPI> >();
+
+  bp::class_<SolverMPPI, bp::bases<SolverAbstract> >(
+      "SolverMPPI",
+      "Model Predictive Path Integral (MPPI) solver.\n\n"
+      "The MPPI solver samples control sequences around the nominal one, "
+      "rolls them out in\n"
+      "parallel, and moves the nominal control sequence along the average of "
+      "the perturbations\n"
+      "weighted by exp(-(S_k - S_min) / temperature), where S_k is the total "
+      "cost of a sample.\n"
+      "It only evaluates the dynamics and costs, and its solution can "
+      "warm-start a derivative-\n"
+      "based solver such as FDDP.",
+      bp::init<std::shared_ptr<ShootingProblem>,
+               bp::optional<std::size_t, double, double, unsigned int> >(
+          bp::args("self", "problem", "nsamples", "noise", "temperature",
+                   "seed"),
+          "Initialize the MPPI solver.\n\n"
+          ":param problem: shooting problem\n"
+          ":param nsamples: number of sampled control sequences (default "
+          "256)\n"
+          ":param noise: standard deviation of the control perturbations "
+          "(default 0.1)\n"
+          ":param temperature: temperature of the sample weights (default 1)\n"
+          ":param seed: seed of the random number generators (default 0)"))
+      .def("solve", &Solver_solve<SolverMPPI>,
+           SolverMPPI_solves(
+               bp::args("self", "init_xs", "init_us", "maxiter", "is_feasible",
+                        "init_reg"),
+               "Compute the optimal trajectory xopt, uopt as lists of T+1 and "
+               "T terms.\n\n"
+               "The state trajectory is obtained by rolling out the control "
+               "sequence, so init_xs,\n"
+               "is_feasible and init_reg are ignored.\n"
+               ":param init_xs: initial guess for state trajectory with T+1 "
+               "elements (default [])\n"
+               ":param init_us: initial guess for control trajectory with T "
+               "elements (default [])\n"
+               ":param maxiter: maximum allowed number of iterations (default "
+               "100)\n"
+               ":param is_feasible: unused (default False)\n"
+               ":param init_reg: unused (default None)\n"
+               ":returns a boolean that describes if convergence was reached."))
+      .def("computeDirection", &SolverMPPI::computeDirection,
+           SolverMPPI_computeDirections(
+               bp::args("self", "recalc"),
+               "Compute the search direction from the weighted samples.\n\n"
+               ":param recalc: unused, the samples are always drawn again."))
+      .def("tryStep", &SolverMPPI::tryStep,
+           SolverMPPI_trySteps(
+               bp::args("self", "stepLength"),
+               "Roll out the nominal control sequence moved along the search "
+               "direction.\n\n"
+               ":param stepLength: step length (default 1)\n"
+               ":returns the cost improvement."))
+      .def("stoppingCriteria", &SolverMPPI::stoppingCriteria, bp::args("self"),
+           "Return the squared norm of the search direction.")
+      .def("expectedImprovement", &SolverMPPI::expectedImprovement,
+           bp::return_value_policy<bp::reference_existing_object>(),
+           bp::args("self"),
+           "Return zero, as the search direction has no improvement model.")
+      .add_property("nsamples", &SolverMPPI::get_nsamples,
+                    &SolverMPPI::set_nsamples,
+                    "number of sampled control sequences")
+      .add_property("noise", &SolverMPPI::get_noise, &SolverMPPI::set_noise,
+                    "standard deviation of the control perturbations")
+      .add_property("temperature", &SolverMPPI::get_temperature,
+                    &SolverMPPI::set_temperature,
+                    "temperature of the sample weights")
+      .def("setSeed", &SolverMPPI::set_seed, bp::args("self", "seed"),
+           "Reset the random number generators with a new seed.\n\n"
+           ":param seed: seed of the random number generators")
+      .add_property(
+          "dus",
+          make_function(
+              &SolverMPPI::get_dus,
+              bp::return_value_policy<bp::reference_existing_object>()),
+          "search direction")
+      .add_property("us_samples", bp::make_function(&SolverMPPI_us_samples),
+                    "sampled control sequences of the last iteration")
+      .add_property("xs_samples", bp::make_function(&SolverMPPI_xs_samples),
+                    "state trajectories of the sampled control sequences")
+      .add_property("costs", bp::make_function(&SolverMPPI_costs),
+                    "total costs of the sampled control sequences")
+      .add_property("weights", bp::make_function(&SolverMPPI_weights),
+                    "normalized weights of the sampled control sequences")
+      .def(CopyableVisitor<SolverMPPI>());
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -15,12 +15,14 @@
 #include "crocoddyl/core/state-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 #include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class StateAbstract_wrap : public StateAbstract,
-                           public bp::wrapper<StateAbstract> {
+                           public bp::wrapper<StateAbstract>,
+                           public PythonDerived {
  public:
   using StateAbstract::lb_;
   using StateAbstract::ndx_;
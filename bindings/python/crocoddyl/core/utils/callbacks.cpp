@@ -9,6 +9,7 @@
 
 #include "crocoddyl/core/utils/callbacks.hpp"
 
+#include "crocoddyl/core/utils/binary-log.hpp"
 #include "python/crocoddyl/core/core.hpp"
 #include "python/crocoddyl/utils/copyable.hpp"
 
@@ -40,6 +41,107 @@ void exposeCallbacks() {
       .add_property("precision", &CallbackVerbose::get_precision,
                     &CallbackVerbose::set_precision, "precision")
       .def(CopyableVisitor<CallbackVerbose>());
+
+  bp::class_<CallbackBinaryLogger, bp::bases<CallbackAbstract>,
+             boost::noncopyable>(
+      "CallbackBinaryLogger",
+      "Callback function for logging the solver iterates in a binary file.\n\n"
+      "The iterates are copied into a preallocated queue, which is drained "
+      "into the\n"
+      "log by a background thread. If the queue is full, the iterate is "
+      "dropped\n"
+      "instead of blocking the solver. The records are appended to the log, "
+      "and\n"
+      "they can be read with BinaryLogReader.",
+      bp::init<std::string, bp::optional<std::size_t, bool> >(
+          bp::args("self", "filename", "capacity", "with_gains"),
+          "Initialize the binary logger.\n\n"
+          ":param filename: path of the binary log\n"
+          ":param capacity: number of records in the queue (default 64)\n"
+          ":param with_gains: log the feedback gains (default True)"))
+      .def("__call__", &CallbackBinaryLogger::operator(),
+           bp::args("self", "solver"),
+           "Run the callback function given a solver.\n\n"
+           ":param solver: solver to be logged")
+      .def("flush", &CallbackBinaryLogger::flush, bp::args("self"),
+           "Wait until the queued records are written in the log.")
+      .add_property("filename",
+                    bp::make_function(
+                        &CallbackBinaryLogger::get_filename,
+                        bp::return_value_policy<bp::copy_const_reference>()),
+                    "path of the binary log")
+      .add_property("capacity", &CallbackBinaryLogger::get_capacity,
+                    "number of records in the queue")
+      .add_property("nrecords", &CallbackBinaryLogger::get_nrecords,
+                    "number of records written in the log")
+      .add_property("ndropped", &CallbackBinaryLogger::get_ndropped,
+                    "number of records dropped because the queue was full")
+      .add_property("with_gains", &CallbackBinaryLogger::get_with_gains,
+                    &CallbackBinaryLogger::set_with_gains,
+                    "log the feedback gains");
+
+  bp::class_<BinaryLogRecord>(
+      "BinaryLogRecord", "Solver iterate read from a binary log.",
+      bp::init<>(bp::args("self"), "Initialize the record."))
+      .def_readonly("sequence", &BinaryLogRecord::sequence,
+                    "index of the record in its logger")
+      .def_readonly("time", &BinaryLogRecord::time,
+                    "wall-clock time since epoch [ns]")
+      .def_readonly("iter", &BinaryLogRecord::iter,
+                    "iteration index of the solver")
+      .def_readonly("cost", &BinaryLogRecord::cost, "cost")
+      .def_readonly("merit", &BinaryLogRecord::merit, "merit")
+      .def_readonly("stop", &BinaryLogRecord::stop, "stopping criteria")
+      .def_readonly("stepLength", &BinaryLogRecord::steplength,
+                    "applied step length")
+      .def_readonly("preg", &BinaryLogRecord::preg,
+                    "primal-variable regularization")
+      .def_readonly("dreg", &BinaryLogRecord::dreg,
+                    "dual-variable regularization")
+      .def_readonly("ffeas", &BinaryLogRecord::ffeas, "dynamic feasibility")
+      .def_readonly("gfeas", &BinaryLogRecord::gfeas,
+                    "inequality feasibility")
+      .def_readonly("hfeas", &BinaryLogRecord::hfeas, "equality feasibility")
+      .add_property(
+          "xs",
+          bp::make_getter(&BinaryLogRecord::xs,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "state trajectory")
+      .add_property(
+          "us",
+          bp::make_getter(&BinaryLogRecord::us,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "control trajectory")
+      .add_property(
+          "K",
+          bp::make_getter(&BinaryLogRecord::Ks,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "feedback gains (empty if they were not logged)");
+
+  bp::class_<BinaryLogReader, boost::noncopyable>(
+      "BinaryLogReader",
+      "Reader of binary logs.\n\n"
+      "It maps the log in memory and indexes its records, so they can be "
+      "read in any\n"
+      "order. A truncated record at the end of the log is ignored.",
+      bp::init<std::string>(bp::args("self", "filename"),
+                            "Open a binary log.\n\n"
+                            ":param filename: path of the binary log"))
+      .def("reload", &BinaryLogReader::reload, bp::args("self"),
+           "Map the binary log again to include the appended records.")
+      .def<BinaryLogRecord (BinaryLogReader::*)(const std::size_t) const>(
+          "read", &BinaryLogReader::read, bp::args("self", "i"),
+          "Read a record.\n\n"
+          ":param i: index of the record\n"
+          ":return the record")
+      .def("__len__", &BinaryLogReader::get_nrecords, bp::args("self"))
+      .add_property("filename",
+                    bp::make_function(
+                        &BinaryLogReader::get_filename,
+                        bp::return_value_policy<bp::copy_const_reference>()),
+                    "path of the binary log")
+      .add_property("nrecords", &BinaryLogReader::get_nrecords,
+                    "number of complete records");
 }
 
 }  // namespace python
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/sensitivity.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void SolutionSensitivity_compute(SolutionSensitivity& self,
+                                 const bool recalc = false) {
+  ScopedGILRelease nogil;
+  self.compute(recalc);
+}
+
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolutionSensitivity_computes,
+                                SolutionSensitivity_compute, 1, 2)
+
+void exposeSolutionSensitivity() {
+  bp::class_<SolutionSensitivity, boost::noncopyable>(
+      "SolutionSensitivity",
+      "Sensitivities of the solution of a DDP solver.\n\n"
+      "It computes the derivatives of the optimal trajectory with respect to "
+      "the initial\n"
+      "state and the registered parameters, without solving perturbed "
+      "problems. For this,\n"
+      "it reuses the last backward pass of the solver (K, Vxx and Quu, whose "
+      "Cholesky\n"
+      "decompositions are recomputed). The box and intro solvers are not "
+      "supported. The\n"
+      "derivatives of the node models with respect to the parameters are "
+      "computed by\n"
+      "finite differences, and a single extra sweep handles all the "
+      "parameters. The\n"
+      "derivatives of the states are expressed in their tangent spaces.",
+      bp::init<std::shared_ptr<SolverDDP>,
+               bp::optional<std::shared_ptr<ProblemParameters> > >(
+          bp::args("self", "solver", "params"),
+          "Initialize the sensitivities of a solver.\n\n"
+          ":param solver: DDP or FDDP solver\n"
+          ":param params: registered parameters of the solver's problem "
+          "(default None)"))
+      .def("compute", &SolutionSensitivity_compute,
+           SolutionSensitivity_computes(
+               bp::args("self", "recalc"),
+               "Compute the sensitivities of the current solution.\n\n"
+               "The problem's datas are evaluated at the solution. It raises "
+               "an error if a\n"
+               "Hessian Quu is not positive definite.\n"
+               ":param recalc: true for running a backward pass at the "
+               "solution (default\n"
+               "False)"))
+      .add_property(
+          "dxs_dx0",
+          bp::make_function(
+              &SolutionSensitivity::get_dxs_dx0,
+              bp::return_value_policy<bp::copy_const_reference>()),
+          "derivatives of the states w.r.t. the initial state")
+      .add_property(
+          "dus_dx0",
+          bp::make_function(
+              &SolutionSensitivity::get_dus_dx0,
+              bp::return_value_policy<bp::copy_const_reference>()),
+          "derivatives of the controls w.r.t. the initial state")
+      .add_property(
+          "dxs_dp",
+          bp::make_function(
+              &SolutionSensitivity::get_dxs_dp,
+              bp::return_value_policy<bp::copy_const_reference>()),
+          "derivatives of the states w.r.t. the parameters (a column per "
+          "column of the\n"
+          "parameter table)")
+      .add_property(
+          "dus_dp",
+          bp::make_function(
+              &SolutionSensitivity::get_dus_dp,
+              bp::return_value_policy<bp::copy_const_reference>()),
+          "derivatives of the controls w.r.t. the parameters")
+      .add_property(
+          "solver",
+          bp::make_function(&SolutionSensitivity::get_solver,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "DDP solver")
+      .add_property(
+          "params",
+          bp::make_function(&SolutionSensitivity::get_parameters,
+                            bp::return_value_policy<bp::return_by_value>()),
+          "registered parameters")
+      .add_property("disturbance", &SolutionSensitivity::get_disturbance,
+                    &SolutionSensitivity::set_disturbance,
+                    "disturbance used by the finite differences of the "
+                    "parameters");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
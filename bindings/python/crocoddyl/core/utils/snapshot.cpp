@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/snapshot.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+Eigen::VectorXd SnapshotReader_x0(const SnapshotReader& self) {
+  return self.get_x0();
+}
+
+bp::list SnapshotReader_xs(const SnapshotReader& self) {
+  bp::list xs;
+  for (std::size_t t = 0; t <= self.get_T(); ++t) {
+    xs.append(Eigen::VectorXd(self.get_x(t)));
+  }
+  return xs;
+}
+
+bp::list SnapshotReader_us(const SnapshotReader& self) {
+  bp::list us;
+  for (std::size_t t = 0; t < self.get_T(); ++t) {
+    us.append(Eigen::VectorXd(self.get_u(t)));
+  }
+  return us;
+}
+
+bp::list SnapshotReader_K(const SnapshotReader& self) {
+  bp::list K;
+  if (self.get_has_gains()) {
+    for (std::size_t t = 0; t < self.get_T(); ++t) {
+      K.append(Eigen::MatrixXd(self.get_K(t)));
+    }
+  }
+  return K;
+}
+
+bp::list SnapshotReader_k(const SnapshotReader& self) {
+  bp::list k;
+  if (self.get_has_gains()) {
+    for (std::size_t t = 0; t < self.get_T(); ++t) {
+      k.append(Eigen::VectorXd(self.get_k(t)));
+    }
+  }
+  return k;
+}
+
+std::size_t SnapshotReader_iter(const SnapshotReader& self) {
+  return static_cast<std::size_t>(self.get_header().iter);
+}
+
+double SnapshotReader_cost(const SnapshotReader& self) {
+  return self.get_header().cost;
+}
+
+double SnapshotReader_stop(const SnapshotReader& self) {
+  return self.get_header().stop;
+}
+
+void exposeSnapshot() {
+  bp::def("saveSnapshot", &saveSnapshot, bp::args("filename", "solver"),
+          "Save a snapshot of a solver.\n\n"
+          "It stores the initial state, the structure of the action models, "
+          "the trajectories, the\n"
+          "solver status and, for DDP-based solvers, the feedback gains. The "
+          "parameters of the\n"
+          "action models are not stored, so the snapshot is restored in a "
+          "problem built with\n"
+          "the same code.\n"
+          ":param filename: path of the snapshot\n"
+          ":param solver: solver");
+
+  bp::class_<SnapshotReader, boost::noncopyable>(
+      "SnapshotReader",
+      "Reader of snapshots.\n\n"
+      "It maps the snapshot in memory, so opening it does not depend on the "
+      "horizon length.",
+      bp::init<std::string>(bp::args("self", "filename"),
+                            "Open a snapshot.\n\n"
+                            ":param filename: path of the snapshot"))
+      .def("isCompatible", &SnapshotReader::is_compatible,
+           bp::args("self", "problem"),
+           "Check if the snapshot can be restored in a problem.\n\n"
+           ":param problem: shooting problem\n"
+           ":return True if both problems have the same horizon, and their "
+           "action models have\n"
+           "the same type and dimensions")
+      .def("restore", &SnapshotReader::restore, bp::args("self", "solver"),
+           "Restore the snapshot in a solver.\n\n"
+           "It sets the initial state of the solver's problem, the "
+           "trajectories, the regularization\n"
+           "values and, for DDP-based solvers, the feedback gains.\n"
+           ":param solver: solver whose problem is compatible with the "
+           "snapshot")
+      .add_property("filename",
+                    bp::make_function(
+                        &SnapshotReader::get_filename,
+                        bp::return_value_policy<bp::copy_const_reference>()),
+                    "path of the snapshot")
+      .add_property("T", &SnapshotReader::get_T, "number of running nodes")
+      .add_property("x0", &SnapshotReader_x0, "initial state")
+      .add_property("xs", &SnapshotReader_xs, "state trajectory")
+      .add_property("us", &SnapshotReader_us, "control trajectory")
+      .add_property("K", &SnapshotReader_K,
+                    "feedback gains (empty if they were not stored)")
+      .add_property("k", &SnapshotReader_k,
+                    "feed-forward terms (empty if they were not stored)")
+      .add_property("iter", &SnapshotReader_iter,
+                    "number of solver iterations")
+      .add_property("cost", &SnapshotReader_cost, "cost")
+      .add_property("stop", &SnapshotReader_stop, "stopping criteria")
+      .add_property("isFeasible", &SnapshotReader::get_is_feasible,
+                    "True if the state trajectory is feasible")
+      .add_property("hasGains", &SnapshotReader::get_has_gains,
+                    "True if the snapshot has the feedback gains");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
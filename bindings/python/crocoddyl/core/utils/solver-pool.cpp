@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/solver-pool.hpp"
+
+#include "python/crocoddyl/core/core.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+struct SolverFactoryPython {
+  explicit SolverFactoryPython(bp::object factory) : factory(factory) {}
+
+  std::shared_ptr<SolverAbstract> operator()(
+      std::shared_ptr<ShootingProblem> problem) const {
+    return bp::extract<std::shared_ptr<SolverAbstract> >(factory(problem))();
+  }
+
+  bp::object factory;
+};
+
+std::shared_ptr<SolverPool> SolverPool_init(bp::object factory,
+                                            const std::size_t nworkers = 0) {
+  if (!PyCallable_Check(factory.ptr())) {
+    PyErr_SetString(PyExc_TypeError, "factory has to be callable");
+    bp::throw_error_already_set();
+  }
+  return std::make_shared<SolverPool>(SolverFactoryPython(factory), nworkers);
+}
+
+std::shared_ptr<SolverPool> SolverPool_init_factory(bp::object factory) {
+  return SolverPool_init(factory);
+}
+
+bp::list SolverPool_results(const SolverPool& self) {
+  bp::list results;
+  for (std::size_t k = 0; k < self.get_results().size(); ++k) {
+    results.append(self.get_results()[k]);
+  }
+  return results;
+}
+
+bp::list SolverPool_solve(SolverPool& self, const bp::list& problems,
+                          const bp::list& init_xs = bp::list(),
+                          const bp::list& init_us = bp::list(),
+                          const std::size_t maxiter = 100,
+                          const bool is_feasible = false,
+                          const double init_reg = NAN) {
+  const std::size_t np = static_cast<std::size_t>(bp::len(problems));
+  const std::size_t nxs = static_cast<std::size_t>(bp::len(init_xs));
+  const std::size_t nus = static_cast<std::size_t>(bp::len(init_us));
+  std::vector<std::shared_ptr<ShootingProblem> > problems_(np);
+  std::vector<std::vector<Eigen::VectorXd> > init_xs_(nxs), init_us_(nus);
+  for (std::size_t k = 0; k < np; ++k) {
+    problems_[k] =
+        bp::extract<std::shared_ptr<ShootingProblem> >(problems[k])();
+  }
+  for (std::size_t k = 0; k < nxs; ++k) {
+    init_xs_[k] = bp::extract<std::vector<Eigen::VectorXd> >(init_xs[k])();
+  }
+  for (std::size_t k = 0; k < nus; ++k) {
+    init_us_[k] = bp::extract<std::vector<Eigen::VectorXd> >(init_us[k])();
+  }
+  // The factory runs in this thread with the GIL
+  self.allocate(problems_);
+  bool python_derived = PythonDerived::alive();
+  for (std::size_t w = 0; w < self.get_nworkers(); ++w) {
+    const std::vector<std::shared_ptr<SolverAbstract> >& solvers =
+        self.get_solvers(w);
+    for (std::size_t i = 0; i < solvers.size(); ++i) {
+      python_derived = python_derived || isPythonDerived(solvers[i].get()) ||
+                       isPythonDerived(solvers[i]->getCallbacks());
+    }
+  }
+  if (python_derived) {
+    // Python-derived objects cannot be evaluated by the worker threads, so the
+    // jobs run one at a time in this thread
+    const std::size_t nworkers = self.get_nworkers();
+    self.set_nworkers(1);
+    try {
+      self.solve(problems_, init_xs_, init_us_, maxiter, is_feasible,
+                 init_reg);
+    } catch (...) {
+      self.set_nworkers(nworkers);
+      throw;
+    }
+    self.set_nworkers(nworkers);
+  } else {
+    ScopedGILRelease nogil;
+    self.solve(problems_, init_xs_, init_us_, maxiter, is_feasible, init_reg);
+  }
+  return SolverPool_results(self);
+}
+
+BOOST_PYTHON_FUNCTION_OVERLOADS(SolverPool_solves, SolverPool_solve, 2, 7)
+
+void exposeSolverPool() {
+  bp::class_<SolverPoolResult>(
+      "SolverPoolResult", "Result of a solve run by the solver pool.",
+      bp::init<>(bp::args("self"), "Initialize the result."))
+      .def_readonly("converged", &SolverPoolResult::converged,
+                    "True if the solver converged")
+      .def_readonly("isFeasible", &SolverPoolResult::is_feasible,
+                    "True if the solution is feasible")
+      .def_readonly("iter", &SolverPoolResult::iter,
+                    "number of solver iterations")
+      .def_readonly("cost", &SolverPoolResult::cost,
+                    "total cost of the solution")
+      .def_readonly("stop", &SolverPoolResult::stop,
+                    "stopping criteria of the solution")
+      .def_readonly("ffeas", &SolverPoolResult::ffeas,
+                    "dynamic feasibility of the solution")
+      .def_readonly("time", &SolverPoolResult::time,
+                    "duration of the solve in seconds")
+      .def_readonly("worker", &SolverPoolResult::worker,
+                    "index of the worker that solved it")
+      .add_property(
+          "xs",
+          bp::make_getter(&SolverPoolResult::xs,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "state trajectory")
+      .add_property(
+          "us",
+          bp::make_getter(&SolverPoolResult::us,
+                          bp::return_value_policy<bp::return_by_value>()),
+          "control trajectory");
+
+  bp::class_<SolverPool, boost::noncopyable>(
+      "SolverPool",
+      "Pool of solvers for many independent shooting problems.\n\n"
+      "Whole solves are scheduled dynamically across the workers, and the "
+      "problems of the\n"
+      "workers run their nodes in a single thread. Each worker reuses its "
+      "problems and\n"
+      "solvers between jobs and batches. The solver factory is a callable "
+      "that receives a\n"
+      "shooting problem and returns a configured solver.",
+      bp::no_init)
+      .def("__init__",
+           bp::make_constructor(&SolverPool_init_factory,
+                                bp::default_call_policies(),
+                                bp::args("factory")),
+           "Initialize the solver pool.\n\n"
+           ":param factory: callable that creates a solver for a given "
+           "problem")
+      .def("__init__",
+           bp::make_constructor(&SolverPool_init, bp::default_call_policies(),
+                                bp::args("factory", "nworkers")),
+           "Initialize the solver pool.\n\n"
+           ":param factory: callable that creates a solver for a given "
+           "problem\n"
+           ":param nworkers: number of workers")
+      .def(bp::init<bp::optional<std::size_t> >(
+          bp::args("self", "nworkers"),
+          "Initialize the solver pool with FDDP solvers.\n\n"
+          ":param nworkers: number of workers (default is the number of "
+          "threads of the\n"
+          "multithreading support)"))
+      .def("solve", &SolverPool_solve,
+           SolverPool_solves(
+               bp::args("self", "problems", "init_xs", "init_us", "maxiter",
+                        "is_feasible", "init_reg"),
+               "Solve a batch of independent problems.\n\n"
+               "The number of jobs K is the largest size of problems, init_xs "
+               "and init_us. A single\n"
+               "problem or initial guess is shared by all the jobs, and empty "
+               "initial guesses use\n"
+               "the default ones of the solvers.\n"
+               ":param problems: shooting problems (size 1 or K)\n"
+               ":param init_xs: initial guesses of the state trajectories "
+               "(size 0, 1 or K)\n"
+               ":param init_us: initial guesses of the control trajectories "
+               "(size 0, 1 or K)\n"
+               ":param maxiter: maximum allowed number of iterations per job "
+               "(default 100)\n"
+               ":param is_feasible: true if the initial guesses are feasible "
+               "(default False)\n"
+               ":param init_reg: initial guess for the regularization value\n"
+               ":returns the results of the jobs."))
+      .add_property("results", bp::make_function(&SolverPool_results),
+                    "results of the last batch")
+      .add_property("nworkers", &SolverPool::get_nworkers,
+                    &SolverPool::set_nworkers, "number of workers")
+      .add_property("nsolvers", &SolverPool::get_nsolvers,
+                    "number of solvers allocated by the workers")
+      .add_property("time", &SolverPool::get_time,
+                    "duration of the last batch in seconds");
+}
+
+}  // namespace python
+}  // namespace crocoddyl
@@ -20,6 +20,14 @@ void enable_report() { getProfiler().enable_profiler(); }
 
 void disable_report() { getProfiler().disable_profiler(); }
 
+void enable_trace() { getProfiler().enable_trace(); }
+
+void enable_trace_with_capacity(const std::size_t capacity) {
+  getProfiler().enable_trace(capacity);
+}
+
+void disable_trace() { getProfiler().disable_trace(); }
+
 void stop_watch_report(int precision) { getProfiler().report_all(precision); }
 
 long double stop_watch_get_average_time(const std::string& perf_name) {
@@ -40,12 +48,32 @@ long double stop_watch_get_total_time(const std::string& perf_name) {
   return getProfiler().get_total_time(perf_name);
 }
 
+long double stop_watch_get_percentile_time(const std::string& perf_name,
+                                           const double percentile) {
+  return getProfiler().get_percentile_time(perf_name, percentile);
+}
+
+void stop_watch_export_trace(const std::string& filename) {
+  getProfiler().export_chrome_trace(filename);
+}
+
 void stop_watch_reset_all() { getProfiler().reset_all(); }
 
 void exposeStopWatch() {
   bp::def("enable_profiler", enable_report, "Enable the profiler report.");
 
-  bp::def("disable_profiler", enable_report, "Disable the profiler report.");
+  bp::def("disable_profiler", disable_report, "Disable the profiler report.");
+
+  bp::def("enable_profiler_trace", enable_trace,
+          "Enable the trace recording of the profiler.");
+
+  bp::def("enable_profiler_trace", enable_trace_with_capacity,
+          bp::args("capacity"),
+          "Enable the trace recording of the profiler.\n\n"
+          ":param capacity: number of events recorded per thread");
+
+  bp::def("disable_profiler_trace", disable_trace,
+          "Disable the trace recording of the profiler.");
 
   bp::def("stop_watch_report", stop_watch_report,
           "Report all the times measured by the shared stop-watch.");
@@ -66,6 +94,16 @@ void exposeStopWatch() {
           "Get the total time measured by the shared stop-watch for the "
           "specified task.");
 
+  bp::def("stop_watch_get_percentile_time", stop_watch_get_percentile_time,
+          bp::args("name", "percentile"),
+          "Get the estimated percentile (in [0, 100]) of the time measured by "
+          "the shared stop-watch for the specified task.");
+
+  bp::def("stop_watch_export_trace", stop_watch_export_trace,
+          bp::args("filename"),
+          "Export the trace recorded by the shared stop-watch in the "
+          "Chrome-trace JSON format.");
+
   bp::def("stop_watch_reset_all", stop_watch_reset_all,
           "Reset the shared stop-watch.");
 }
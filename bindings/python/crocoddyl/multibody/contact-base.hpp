@@ -13,12 +13,14 @@
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/multibody/contact-base.hpp"
 #include "python/crocoddyl/multibody/multibody.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ContactModelAbstract_wrap : public ContactModelAbstract,
-                                  public bp::wrapper<ContactModelAbstract> {
+                                  public bp::wrapper<ContactModelAbstract>,
+                                  public PythonDerived {
  public:
   ContactModelAbstract_wrap(std::shared_ptr<StateMultibody> state,
                             const pinocchio::ReferenceFrame type,
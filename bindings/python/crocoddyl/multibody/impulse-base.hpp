@@ -13,12 +13,14 @@
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/multibody/impulse-base.hpp"
 #include "python/crocoddyl/multibody/multibody.hpp"
+#include "python/crocoddyl/utils/gil.hpp"
 
 namespace crocoddyl {
 namespace python {
 
 class ImpulseModelAbstract_wrap : public ImpulseModelAbstract,
-                                  public bp::wrapper<ImpulseModelAbstract> {
+                                  public bp::wrapper<ImpulseModelAbstract>,
+                                  public PythonDerived {
  public:
   ImpulseModelAbstract_wrap(std::shared_ptr<StateMultibody> state,
                             const pinocchio::ReferenceFrame type,
@@ -58,6 +58,7 @@ void exposeMultibody() {
   exposeContact6D();
   exposeImpulse3D();
   exposeImpulse6D();
+  exposeParameterReferences();
 }
 
 }  // namespace python
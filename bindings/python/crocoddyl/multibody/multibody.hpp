@@ -63,6 +63,7 @@ void exposeContact3D();
 void exposeContact6D();
 void exposeImpulse3D();
 void exposeImpulse6D();
+void exposeParameterReferences();
 void exposeMultibody();
 
 }  // namespace python
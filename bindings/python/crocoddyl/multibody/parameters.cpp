@@ -0,0 +1,37 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/multibody/utils/parameters.hpp"
+
+#include "crocoddyl/multibody/residuals/centroidal-momentum.hpp"
+#include "crocoddyl/multibody/residuals/com-position.hpp"
+#include "crocoddyl/multibody/residuals/contact-force.hpp"
+#include "crocoddyl/multibody/residuals/frame-placement.hpp"
+#include "crocoddyl/multibody/residuals/frame-rotation.hpp"
+#include "crocoddyl/multibody/residuals/frame-translation.hpp"
+#include "crocoddyl/multibody/residuals/frame-velocity.hpp"
+#include "crocoddyl/multibody/residuals/state.hpp"
+#include "python/crocoddyl/core/mpc/parameters.hpp"
+#include "python/crocoddyl/multibody/multibody.hpp"
+
+namespace crocoddyl {
+namespace python {
+
+void exposeParameterReferences() {
+  registerParameterReference<ResidualModelState>();
+  registerParameterReference<ResidualModelFramePlacement>();
+  registerParameterReference<ResidualModelFrameTranslation>();
+  registerParameterReference<ResidualModelFrameRotation>();
+  registerParameterReference<ResidualModelFrameVelocity>();
+  registerParameterReference<ResidualModelCoMPosition>();
+  registerParameterReference<ResidualModelCentroidalMomentum>();
+  registerParameterReference<ResidualModelContactForce>();
+}
+
+}  // namespace python
+}  // namespace crocoddyl
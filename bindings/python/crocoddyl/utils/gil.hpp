@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef BINDINGS_PYTHON_CROCODDYL_UTILS_GIL_HPP_
+#define BINDINGS_PYTHON_CROCODDYL_UTILS_GIL_HPP_
+
+#include <atomic>
+#include <boost/python.hpp>
+#include <memory>
+#include <vector>
+
+namespace crocoddyl {
+namespace python {
+namespace bp = boost::python;
+
+///
+/// \brief Register the live objects whose virtual functions are overridden in
+/// Python.
+///
+/// The wrappers of the abstract models inherit from this class. While one of
+/// these objects is alive, a C++ evaluation could call back into Python, then
+/// the GIL cannot be released.
+///
+struct PythonDerived {
+  PythonDerived() { count().fetch_add(1, std::memory_order_relaxed); }
+  PythonDerived(const PythonDerived&) {
+    count().fetch_add(1, std::memory_order_relaxed);
+  }
+  ~PythonDerived() { count().fetch_sub(1, std::memory_order_relaxed); }
+
+  ///
+  /// \brief Indicate if there are live Python-derived objects.
+  ///
+  static bool alive() { return count().load(std::memory_order_relaxed) > 0; }
+
+ private:
+  static std::atomic<std::size_t>& count() {
+    static std::atomic<std::size_t> count(0);
+    return count;
+  }
+};
+
+///
+/// \brief Indicate if an object is an instance of a Python-derived class.
+///
+template <class T>
+inline bool isPythonDerived(const T* obj) {
+  return bp::detail::wrapper_base_::owner(obj) != NULL;
+}
+
+///
+/// \brief Indicate if any of the objects is an instance of a Python-derived
+/// class.
+///
+template <class T>
+inline bool isPythonDerived(const std::vector<std::shared_ptr<T> >& objs) {
+  for (std::size_t i = 0; i < objs.size(); ++i) {
+    if (isPythonDerived(objs[i].get())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+///
+/// \brief Release the GIL during the lifetime of this object.
+///
+/// Long-running C++ functions use it to let other Python threads run, e.g.,
+/// several solvers. The GIL is kept when Python-derived objects are alive, as
+/// the C++ function could call their Python overrides.
+///
+class ScopedGILRelease {
+ public:
+  explicit ScopedGILRelease(const bool release = true)
+      : state_(release && !PythonDerived::alive() ? PyEval_SaveThread()
+                                                  : NULL) {}
+  ~ScopedGILRelease() {
+    if (state_ != NULL) {
+      PyEval_RestoreThread(state_);
+    }
+  }
+
+ private:
+  ScopedGILRelease(const ScopedGILRelease&);
+  ScopedGILRelease& operator=(const ScopedGILRelease&);
+
+  PyThreadState* state_;
+};
+
+}  // namespace python
+}  // namespace crocoddyl
+
+#endif  // BINDINGS_PYTHON_CROCODDYL_UTILS_GIL_HPP_
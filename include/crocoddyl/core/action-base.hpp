@@ -13,6 +13,7 @@
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "crocoddyl/core/fwd.hpp"
 #include "crocoddyl/core/state-base.hpp"
@@ -101,6 +102,8 @@ class ActionModelAbstractTpl {
   typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
   typedef StateAbstractTpl<Scalar> StateAbstract;
   typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXsRowMajor MatrixXsRowMajor;
+  typedef ActionBatchDataTpl<Scalar> ActionBatchData;
 
   /**
    * @brief Initialize the action model
@@ -175,6 +178,36 @@ class ActionModelAbstractTpl {
   virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x);
 
+  /**
+   * @brief Compute the next state, cost value and their derivatives
+   *
+   * It runs the forward and derivative computations in a single call. Action
+   * models that share intermediate quantities between `calc()` and
+   * `calcDiff()` (e.g., rigid-body dynamics terms) can override this function
+   * to avoid computing them twice. By default, it calls `calc()` followed by
+   * `calcDiff()`.
+   *
+   * @param[in] data  Action data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the total cost value and its derivatives for nodes that
+   * depends only on the state
+   *
+   * By default, it calls `calc()` followed by `calcDiff()`. This function is
+   * used in the terminal nodes of an optimal control problem.
+   *
+   * @param[in] data  Action data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x);
+
   /**
    * @brief Create the action data
    *
@@ -187,6 +220,47 @@ class ActionModelAbstractTpl {
    */
   virtual bool checkData(const std::shared_ptr<ActionDataAbstract>& data);
 
+  /**
+   * @brief Create the data of a batch evaluation
+   *
+   * @param[in] N         Number of samples
+   * @param[in] nthreads  Number of threads (default is the number of threads
+   * of the multithreading support)
+   * @return the batch data
+   */
+  std::shared_ptr<ActionBatchData> createBatchData(
+      const std::size_t N, const std::size_t nthreads = 0);
+
+  /**
+   * @brief Compute the next states and cost values of a batch of samples
+   *
+   * The samples are distributed over the threads of the batch data, and each
+   * thread runs `calc()` with its own data. An empty matrix of controls
+   * evaluates the terminal model, i.e., `calc(data, x)`.
+   *
+   * @param[in] data  Batch data
+   * @param[in] xs    States (N x nx, one sample per row)
+   * @param[in] us    Controls (N x nu, or empty)
+   */
+  void calcBatch(const std::shared_ptr<ActionBatchData>& data,
+                 const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                 const Eigen::Ref<const MatrixXsRowMajor>& us);
+
+  /**
+   * @brief Compute the next states, cost values and their derivatives of a
+   * batch of samples
+   *
+   * Each thread runs `calc()` and `calcDiff()` with its own data, so there is
+   * no need to call `calcBatch()` beforehand.
+   *
+   * @param[in] data  Batch data
+   * @param[in] xs    States (N x nx, one sample per row)
+   * @param[in] us    Controls (N x nu, or empty)
+   */
+  void calcDiffBatch(const std::shared_ptr<ActionBatchData>& data,
+                     const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                     const Eigen::Ref<const MatrixXsRowMajor>& us);
+
   /**
    * @brief Computes the quasic static commands
    *
@@ -339,6 +413,14 @@ class ActionModelAbstractTpl {
 
   template <class Scalar>
   friend class ConstraintModelManagerTpl;
+
+ private:
+  /**
+   * @brief Check the dimensions of a batch evaluation
+   */
+  void checkBatch(const ActionBatchData& data,
+                  const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                  const Eigen::Ref<const MatrixXsRowMajor>& us) const;
 };
 
 template <typename _Scalar>
@@ -420,6 +502,71 @@ struct ActionDataAbstractTpl {
                  //!< \f$\mathbf{u}\f$
 };
 
+/**
+ * @brief Data of a batch evaluation
+ *
+ * It contains the action data of each thread and the outputs of the samples,
+ * one sample per row. The matrices of a sample are flattened in row-major
+ * order, e.g., the row \f$k\f$ of `Fx` is the Jacobian of the sample \f$k\f$,
+ * so the outputs can be reshaped without copying them.
+ */
+template <typename _Scalar>
+struct ActionBatchDataTpl {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXsRowMajor MatrixXsRowMajor;
+
+  template <template <typename Scalar> class Model>
+  ActionBatchDataTpl(Model<Scalar>* const model, const std::size_t N,
+                     const std::size_t nthreads)
+      : nthreads(1),
+        xnext(N, model->get_state()->get_nx()),
+        cost(N),
+        Fx(N, model->get_state()->get_ndx() * model->get_state()->get_ndx()),
+        Fu(N, model->get_state()->get_ndx() * model->get_nu()),
+        Lx(N, model->get_state()->get_ndx()),
+        Lu(N, model->get_nu()),
+        Lxx(N, model->get_state()->get_ndx() * model->get_state()->get_ndx()),
+        Lxu(N, model->get_state()->get_ndx() * model->get_nu()),
+        Luu(N, model->get_nu() * model->get_nu()) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    this->nthreads = nthreads == 0 ? CROCODDYL_WITH_NTHREADS : nthreads;
+#else
+    (void)nthreads;
+#endif
+    for (std::size_t i = 0; i < this->nthreads; ++i) {
+      datas.push_back(model->createData());
+    }
+    xnext.setZero();
+    cost.setZero();
+    Fx.setZero();
+    Fu.setZero();
+    Lx.setZero();
+    Lu.setZero();
+    Lxx.setZero();
+    Lxu.setZero();
+    Luu.setZero();
+  }
+  virtual ~ActionBatchDataTpl() {}
+
+  std::size_t nthreads;  //!< Number of threads
+  std::vector<std::shared_ptr<ActionDataAbstract> >
+      datas;               //!< Action data of each thread
+  MatrixXsRowMajor xnext;  //!< Next states
+  VectorXs cost;           //!< Cost values
+  MatrixXsRowMajor Fx;     //!< Jacobians of the dynamics w.r.t. the state
+  MatrixXsRowMajor Fu;     //!< Jacobians of the dynamics w.r.t. the control
+  MatrixXsRowMajor Lx;     //!< Jacobians of the cost w.r.t. the state
+  MatrixXsRowMajor Lu;     //!< Jacobians of the cost w.r.t. the control
+  MatrixXsRowMajor Lxx;    //!< Hessians of the cost w.r.t. the state
+  MatrixXsRowMajor Lxu;    //!< Hessians of the cost w.r.t. the state/control
+  MatrixXsRowMajor Luu;    //!< Hessians of the cost w.r.t. the control
+};
+
 }  // namespace crocoddyl
 
 /* --- Details -------------------------------------------------------------- */
@@ -7,7 +7,12 @@
 // All rights reserved.
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#include <omp.h>
+#endif  // CROCODDYL_WITH_MULTITHREADING
+
 #include <boost/core/demangle.hpp>
+#include <exception>
 #include <iostream>
 #include <typeinfo>
 
@@ -55,6 +60,22 @@ void ActionModelAbstractTpl<Scalar>::calcDiff(
   calcDiff(data, x, unone_);
 }
 
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  calc(data, x, u);
+  calcDiff(data, x, u);
+}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  calc(data, x);
+  calcDiff(data, x);
+}
+
 template <typename Scalar>
 void ActionModelAbstractTpl<Scalar>::quasiStatic(
     const std::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
@@ -109,6 +130,134 @@ ActionModelAbstractTpl<Scalar>::createData() {
       Eigen::aligned_allocator<ActionDataAbstract>(), this);
 }
 
+template <typename Scalar>
+std::shared_ptr<ActionBatchDataTpl<Scalar> >
+ActionModelAbstractTpl<Scalar>::createBatchData(const std::size_t N,
+                                                const std::size_t nthreads) {
+  return std::allocate_shared<ActionBatchData>(
+      Eigen::aligned_allocator<ActionBatchData>(), this, N, nthreads);
+}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::calcBatch(
+    const std::shared_ptr<ActionBatchData>& data,
+    const Eigen::Ref<const MatrixXsRowMajor>& xs,
+    const Eigen::Ref<const MatrixXsRowMajor>& us) {
+  checkBatch(*data, xs, us);
+  const bool terminal = us.rows() == 0;
+  const std::size_t N = static_cast<std::size_t>(xs.rows());
+  std::exception_ptr error;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(data->nthreads) schedule(static)
+#endif
+  for (std::size_t k = 0; k < N; ++k) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    const std::size_t w = static_cast<std::size_t>(omp_get_thread_num());
+#else
+    const std::size_t w = 0;
+#endif
+    const std::shared_ptr<ActionDataAbstract>& d = data->datas[w];
+    try {
+      if (terminal) {
+        calc(d, xs.row(k).transpose());
+      } else {
+        calc(d, xs.row(k).transpose(), us.row(k).transpose());
+      }
+    } catch (...) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp critical(crocoddyl_action_batch)
+#endif
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    data->xnext.row(k) = d->xnext.transpose();
+    data->cost[k] = d->cost;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::calcDiffBatch(
+    const std::shared_ptr<ActionBatchData>& data,
+    const Eigen::Ref<const MatrixXsRowMajor>& xs,
+    const Eigen::Ref<const MatrixXsRowMajor>& us) {
+  checkBatch(*data, xs, us);
+  const bool terminal = us.rows() == 0;
+  const std::size_t N = static_cast<std::size_t>(xs.rows());
+  const Eigen::Index ndx = static_cast<Eigen::Index>(state_->get_ndx());
+  const Eigen::Index nu = static_cast<Eigen::Index>(nu_);
+  std::exception_ptr error;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(data->nthreads) schedule(static)
+#endif
+  for (std::size_t k = 0; k < N; ++k) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    const std::size_t w = static_cast<std::size_t>(omp_get_thread_num());
+#else
+    const std::size_t w = 0;
+#endif
+    const std::shared_ptr<ActionDataAbstract>& d = data->datas[w];
+    try {
+      if (terminal) {
+        calc(d, xs.row(k).transpose());
+        calcDiff(d, xs.row(k).transpose());
+      } else {
+        calc(d, xs.row(k).transpose(), us.row(k).transpose());
+        calcDiff(d, xs.row(k).transpose(), us.row(k).transpose());
+      }
+    } catch (...) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp critical(crocoddyl_action_batch)
+#endif
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    data->xnext.row(k) = d->xnext.transpose();
+    data->cost[k] = d->cost;
+    Eigen::Map<MatrixXsRowMajor>(data->Fx.row(k).data(), ndx, ndx) = d->Fx;
+    Eigen::Map<MatrixXsRowMajor>(data->Fu.row(k).data(), ndx, nu) = d->Fu;
+    data->Lx.row(k) = d->Lx.transpose();
+    data->Lu.row(k) = d->Lu.transpose();
+    Eigen::Map<MatrixXsRowMajor>(data->Lxx.row(k).data(), ndx, ndx) = d->Lxx;
+    Eigen::Map<MatrixXsRowMajor>(data->Lxu.row(k).data(), ndx, nu) = d->Lxu;
+    Eigen::Map<MatrixXsRowMajor>(data->Luu.row(k).data(), nu, nu) = d->Luu;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <typename Scalar>
+void ActionModelAbstractTpl<Scalar>::checkBatch(
+    const ActionBatchData& data, const Eigen::Ref<const MatrixXsRowMajor>& xs,
+    const Eigen::Ref<const MatrixXsRowMajor>& us) const {
+  const Eigen::Index N = data.cost.size();
+  if (xs.rows() != N ||
+      static_cast<std::size_t>(xs.cols()) != state_->get_nx()) {
+    throw_pretty("Invalid argument: "
+                 << "xs has wrong dimension (it should be " +
+                        std::to_string(N) + "x" +
+                        std::to_string(state_->get_nx()) + ")");
+  }
+  if (us.rows() != 0 &&
+      (us.rows() != N || static_cast<std::size_t>(us.cols()) != nu_)) {
+    throw_pretty("Invalid argument: "
+                 << "us has wrong dimension (it should be empty or " +
+                        std::to_string(N) + "x" + std::to_string(nu_) + ")");
+  }
+  if (data.datas.size() < data.nthreads ||
+      data.Fx.cols() !=
+          static_cast<Eigen::Index>(state_->get_ndx() * state_->get_ndx()) ||
+      data.Luu.cols() != static_cast<Eigen::Index>(nu_ * nu_)) {
+    throw_pretty("Invalid argument: "
+                 << "the batch data does not belong to this model");
+  }
+}
+
 template <typename Scalar>
 bool ActionModelAbstractTpl<Scalar>::checkData(
     const std::shared_ptr<ActionDataAbstract>&) {
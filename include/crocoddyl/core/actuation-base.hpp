@@ -21,6 +21,21 @@
 
 namespace crocoddyl {
 
+/**
+ * @brief Structure of the actuation Jacobians
+ *
+ * `ActuationIdentity` and `ActuationSelection` describe a constant actuation
+ * mapping \f$\boldsymbol{\tau}=[\mathbf{0};\mathbf{I}]\mathbf{u}\f$, i.e.,
+ * the last `nu` joints are directly actuated (all of them for the identity)
+ * and \f$\frac{\partial\boldsymbol{\tau}}{\partial\mathbf{x}}=\mathbf{0}\f$.
+ * `ActuationDense` describes any other actuation mapping.
+ */
+enum ActuationStructure {
+  ActuationIdentity = 0,
+  ActuationSelection,
+  ActuationDense
+};
+
 /**
  * @brief Abstract class for the actuation-mapping model
  *
@@ -39,6 +54,11 @@ namespace crocoddyl {
  * \f$\frac{\partial\boldsymbol{\tau}}{\partial\mathbf{u}}\f$. Note that
  * `calcDiff()` requires to run `calc()` first.
  *
+ * Actuation models with a constant selection of the actuated joints advertise
+ * it through `get_structure()`. Then, `multiplyByStateJacobian()` and
+ * `multiplyByControlJacobian()` replace the products with the actuation
+ * Jacobians by block copies.
+ *
  * \sa `calc()`, `calcDiff()`, `createData()`
  */
 template <typename _Scalar>
@@ -137,6 +157,44 @@ class ActuationModelAbstractTpl {
   virtual void torqueTransform(
       const std::shared_ptr<ActuationDataAbstract>& data,
       const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the product between the given matrix A and the Jacobian of
+   * the actuation function with respect to the state (i.e., A*dtau_dx)
+   *
+   * It assumes that `calcDiff()` has been run first. This product is zero for
+   * the structured actuation models.
+   *
+   * @param[in]  data  Actuation data
+   * @param[in]  A     A matrix to multiply times the Jacobian
+   * @param[out] out   Product between the matrix A and the Jacobian
+   * @param[in]  op    Assignment operator which sets, adds, or removes the
+   * given results
+   */
+  void multiplyByStateJacobian(
+      const std::shared_ptr<ActuationDataAbstract>& data,
+      const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+      const AssignmentOp op = setto) const;
+
+  /**
+   * @brief Compute the product between the given matrix A and the Jacobian of
+   * the actuation function with respect to the joint-torque input (i.e.,
+   * A*dtau_du)
+   *
+   * It assumes that `calcDiff()` has been run first. This product is a block
+   * copy of A for the structured actuation models.
+   *
+   * @param[in]  data  Actuation data
+   * @param[in]  A     A matrix to multiply times the Jacobian
+   * @param[out] out   Product between the matrix A and the Jacobian
+   * @param[in]  op    Assignment operator which sets, adds, or removes the
+   * given results
+   */
+  void multiplyByControlJacobian(
+      const std::shared_ptr<ActuationDataAbstract>& data,
+      const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+      const AssignmentOp op = setto) const;
+
   /**
    * @brief Create the actuation data
    *
@@ -149,6 +207,11 @@ class ActuationModelAbstractTpl {
    */
   std::size_t get_nu() const;
 
+  /**
+   * @brief Return the structure of the actuation Jacobians
+   */
+  ActuationStructure get_structure() const;
+
   /**
    * @brief Return the state
    */
@@ -171,6 +234,7 @@ class ActuationModelAbstractTpl {
  protected:
   std::size_t nu_;                        //!< Dimension of joint torque inputs
   std::shared_ptr<StateAbstract> state_;  //!< Model of the state
+  ActuationStructure structure_;  //!< Structure of the actuation Jacobians
 };
 
 template <typename _Scalar>
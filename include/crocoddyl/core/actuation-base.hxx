@@ -16,7 +16,7 @@ namespace crocoddyl {
 template <typename Scalar>
 ActuationModelAbstractTpl<Scalar>::ActuationModelAbstractTpl(
     std::shared_ptr<StateAbstract> state, const std::size_t nu)
-    : nu_(nu), state_(state) {}
+    : nu_(nu), state_(state), structure_(ActuationDense) {}
 
 template <typename Scalar>
 ActuationModelAbstractTpl<Scalar>::~ActuationModelAbstractTpl() {}
@@ -57,11 +57,107 @@ void ActuationModelAbstractTpl<Scalar>::torqueTransform(
   data->Mtau = pseudoInverse(data->dtau_du);
 }
 
+template <typename Scalar>
+void ActuationModelAbstractTpl<Scalar>::multiplyByStateJacobian(
+    const std::shared_ptr<ActuationDataAbstract>& data,
+    const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+    const AssignmentOp op) const {
+  assert_pretty(is_a_AssignmentOp(op),
+                ("op must be one of the AssignmentOp {settop, addto, rmfrom}"));
+  if (A.rows() != out.rows() ||
+      static_cast<std::size_t>(A.cols()) != state_->get_nv() ||
+      static_cast<std::size_t>(out.cols()) != state_->get_ndx()) {
+    throw_pretty("Invalid argument: " << "A and out have wrong dimensions (" +
+                                             std::to_string(A.rows()) + "," +
+                                             std::to_string(A.cols()) +
+                                             " and " +
+                                             std::to_string(out.rows()) + "," +
+                                             std::to_string(out.cols()) + ")");
+  }
+  if (structure_ != ActuationDense) {
+    if (op == setto) {
+      out.setZero();
+    }
+    return;
+  }
+  switch (op) {
+    case setto:
+      out.noalias() = A * data->dtau_dx;
+      break;
+    case addto:
+      out.noalias() += A * data->dtau_dx;
+      break;
+    case rmfrom:
+      out.noalias() -= A * data->dtau_dx;
+      break;
+    default:
+      throw_pretty("Invalid argument: allowed operators: setto, addto, rmfrom");
+      break;
+  }
+}
+
+template <typename Scalar>
+void ActuationModelAbstractTpl<Scalar>::multiplyByControlJacobian(
+    const std::shared_ptr<ActuationDataAbstract>& data,
+    const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+    const AssignmentOp op) const {
+  assert_pretty(is_a_AssignmentOp(op),
+                ("op must be one of the AssignmentOp {settop, addto, rmfrom}"));
+  if (A.rows() != out.rows() ||
+      static_cast<std::size_t>(A.cols()) != state_->get_nv() ||
+      static_cast<std::size_t>(out.cols()) != nu_) {
+    throw_pretty("Invalid argument: " << "A and out have wrong dimensions (" +
+                                             std::to_string(A.rows()) + "," +
+                                             std::to_string(A.cols()) +
+                                             " and " +
+                                             std::to_string(out.rows()) + "," +
+                                             std::to_string(out.cols()) + ")");
+  }
+  if (structure_ != ActuationDense) {
+    // The actuated joints are the last nu ones, i.e., A*[0; I] = A.rightCols()
+    switch (op) {
+      case setto:
+        out = A.rightCols(nu_);
+        break;
+      case addto:
+        out += A.rightCols(nu_);
+        break;
+      case rmfrom:
+        out -= A.rightCols(nu_);
+        break;
+      default:
+        throw_pretty(
+            "Invalid argument: allowed operators: setto, addto, rmfrom");
+        break;
+    }
+    return;
+  }
+  switch (op) {
+    case setto:
+      out.noalias() = A * data->dtau_du;
+      break;
+    case addto:
+      out.noalias() += A * data->dtau_du;
+      break;
+    case rmfrom:
+      out.noalias() -= A * data->dtau_du;
+      break;
+    default:
+      throw_pretty("Invalid argument: allowed operators: setto, addto, rmfrom");
+      break;
+  }
+}
+
 template <typename Scalar>
 std::size_t ActuationModelAbstractTpl<Scalar>::get_nu() const {
   return nu_;
 }
 
+template <typename Scalar>
+ActuationStructure ActuationModelAbstractTpl<Scalar>::get_structure() const {
+  return structure_;
+}
+
 template <typename Scalar>
 const std::shared_ptr<StateAbstractTpl<Scalar> >&
 ActuationModelAbstractTpl<Scalar>::get_state() const {
@@ -236,6 +236,9 @@ class ActionModelCodeGenTpl : public ActionModelAbstractTpl<_Scalar> {
   /// \brief Dimension of the input vector
   Eigen::DenseIndex getInputDimension() const { return ad_X.size(); }
 
+  /// \brief Dimension of the environment vector
+  std::size_t get_nenv() const { return n_env; }
+
  protected:
   using Base::has_control_limits_;  //!< Indicates whether any of the control
                                     //!< limits
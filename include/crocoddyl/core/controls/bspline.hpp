@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_CONTROLS_BSPLINE_HPP_
+#define CROCODDYL_CORE_CONTROLS_BSPLINE_HPP_
+
+#include "crocoddyl/core/control-base.hpp"
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief A clamped uniform B-spline function of time
+ *
+ * The control input is defined as
+ * \f$\mathbf{w}(t)=\sum_{i=0}^{n-1}B_{i,p}(\tau)\mathbf{P}_i\f$, where
+ * \f$B_{i,p}\f$ are the B-spline basis functions of degree \f$p\f$ defined on
+ * a clamped uniform knot vector over \f$[0,1]\f$, and
+ * \f$\mathbf{P}_i\in\mathbb{R}^{nw}\f$ are the \f$n\f$ control points stacked
+ * in \f$\mathbf{u}\in\mathbb{R}^{n\,nw}\f$. The spline time is
+ * \f$\tau=t_0+t(t_1-t_0)\f$, where \f$[t_0,t_1]\subseteq[0,1]\f$ is the
+ * window covered by the model. In consequence, a single spline can span
+ * several integration steps by assigning consecutive windows to them (see
+ * `IntegratedActionModelMultiStepTpl`). This reduces the number of decision
+ * variables per second of motion, as the number of control points is
+ * independent of the number of integration steps.
+ *
+ * The Jacobian of the control input is
+ * \f$\frac{\partial\mathbf{w}}{\partial\mathbf{P}_i}=B_{i,p}(\tau)\mathbf{I}\f$,
+ * where at most \f$p+1\f$ basis functions are nonzero at any time. Finally, the
+ * spline lies in the convex hull of its control points, then the bounds of the
+ * control input are imposed on each control point.
+ *
+ * \sa `ControlParametrizationAbstractTpl`, `calc()`, `calcDiff()`,
+ * `createData()`, `params`, `multiplyByJacobian`, `multiplyJacobianTransposeBy`
+ */
+template <typename _Scalar>
+class ControlParametrizationModelBSplineTpl
+    : public ControlParametrizationModelAbstractTpl<_Scalar> {
+ public:
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ControlParametrizationDataAbstractTpl<Scalar>
+      ControlParametrizationDataAbstract;
+  typedef ControlParametrizationModelAbstractTpl<Scalar> Base;
+  typedef ControlParametrizationDataBSplineTpl<Scalar> Data;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  /**
+   * @brief Initialize the B-spline control parametrization
+   *
+   * @param[in] nw      Dimension of control vector
+   * @param[in] ncp     Number of control points (greater than the degree)
+   * @param[in] degree  Degree of the spline (default 3)
+   * @param[in] t0      Spline time at the beginning of the window (default 0)
+   * @param[in] t1      Spline time at the end of the window (default 1)
+   */
+  ControlParametrizationModelBSplineTpl(const std::size_t nw,
+                                        const std::size_t ncp,
+                                        const std::size_t degree = 3,
+                                        const Scalar t0 = Scalar(0.),
+                                        const Scalar t1 = Scalar(1.));
+  virtual ~ControlParametrizationModelBSplineTpl();
+
+  /**
+   * @brief Get the value of the control at the specified time
+   *
+   * @param[in]  data   Control-parametrization data
+   * @param[in]  t      Time in [0,1]
+   * @param[in]  u      Control parameters
+   */
+  virtual void calc(
+      const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+      const Scalar t, const Eigen::Ref<const VectorXs>& u) const;
+
+  /**
+   * @brief Get the value of the Jacobian of the control with respect to the
+   * parameters
+   *
+   * It assumes that `calc()` has been run first
+   *
+   * @param[in]  data   Control-parametrization data
+   * @param[in]  t      Time in [0,1]
+   * @param[in]  u      Control parameters
+   */
+  virtual void calcDiff(
+      const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+      const Scalar t, const Eigen::Ref<const VectorXs>& u) const;
+
+  /**
+   * @brief Create the control-parametrization data
+   *
+   * @return the control-parametrization data
+   */
+  virtual std::shared_ptr<ControlParametrizationDataAbstract> createData();
+
+  /**
+   * @brief Get a value of the control parameters such that the control at the
+   * specified time t is equal to the specified value w
+   *
+   * All the control points are set to w, i.e., the spline is constant.
+   *
+   * @param[in]  data   Control-parametrization data
+   * @param[in]  t      Time in [0,1]
+   * @param[in]  w      Control values
+   */
+  virtual void params(
+      const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+      const Scalar t, const Eigen::Ref<const VectorXs>& w) const;
+
+  /**
+   * @brief Map the specified bounds from the control space to the parameter
+   * space
+   *
+   * @param[in]  w_lb   Control lower bound
+   * @param[in]  w_ub   Control lower bound
+   * @param[out] u_lb   Control parameters lower bound
+   * @param[out] u_ub   Control parameters upper bound
+   */
+  virtual void convertBounds(const Eigen::Ref<const VectorXs>& w_lb,
+                             const Eigen::Ref<const VectorXs>& w_ub,
+                             Eigen::Ref<VectorXs> u_lb,
+                             Eigen::Ref<VectorXs> u_ub) const;
+
+  /**
+   * @brief Compute the product between a specified matrix and the Jacobian of
+   * the control (with respect to the parameters)
+   *
+   * It assumes that `calc()` has been run first
+   *
+   * @param[in]  data   Control-parametrization data
+   * @param[in]  A      A matrix to multiply times the Jacobian
+   * @param[out] out    Product between the matrix A and the Jacobian of the
+   * control with respect to the parameters
+   * @param[in] op      Assignment operator which sets, adds, or removes the
+   * given results
+   */
+  virtual void multiplyByJacobian(
+      const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+      const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+      const AssignmentOp op = setto) const;
+
+  /**
+   * @brief Compute the product between the transposed Jacobian of the control
+   * (with respect to the parameters) and a specified matrix
+   *
+   * It assumes that `calc()` has been run first
+   *
+   * @param[in]  data   Control-parametrization data
+   * @param[in]  A      A matrix to multiply times the Jacobian
+   * @param[out] out    Product between the transposed Jacobian of the control
+   * with respect to the parameters and the matrix A
+   * @param[in] op      Assignment operator which sets, adds, or removes the
+   * given results
+   */
+  virtual void multiplyJacobianTransposeBy(
+      const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+      const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+      const AssignmentOp op = setto) const;
+
+  /**
+   * @brief Return the number of control points
+   */
+  std::size_t get_ncp() const;
+
+  /**
+   * @brief Return the degree of the spline
+   */
+  std::size_t get_degree() const;
+
+  /**
+   * @brief Return the spline time at the beginning of the window
+   */
+  const Scalar get_t0() const;
+
+  /**
+   * @brief Return the spline time at the end of the window
+   */
+  const Scalar get_t1() const;
+
+  /**
+   * @brief Return the knot vector
+   */
+  const VectorXs& get_knots() const;
+
+ protected:
+  using Base::nu_;
+  using Base::nw_;
+
+ private:
+  /**
+   * @brief Compute the nonzero basis functions at the specified time
+   *
+   * It uses the Cox-de Boor recursion and stores the basis functions of all
+   * the control points in the data.
+   */
+  void computeBasis(Data* d, const Scalar t) const;
+
+  std::size_t ncp_;     //!< Number of control points
+  std::size_t degree_;  //!< Degree of the spline
+  Scalar t0_;           //!< Spline time at the beginning of the window
+  Scalar t1_;           //!< Spline time at the end of the window
+  VectorXs knots_;      //!< Clamped uniform knot vector
+};
+
+template <typename _Scalar>
+struct ControlParametrizationDataBSplineTpl
+    : public ControlParametrizationDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef ControlParametrizationDataAbstractTpl<Scalar> Base;
+  typedef typename MathBase::VectorXs VectorXs;
+
+  template <template <typename Scalar> class Model>
+  explicit ControlParametrizationDataBSplineTpl(Model<Scalar>* const model)
+      : Base(model),
+        b(model->get_ncp()),
+        N(model->get_degree() + 1),
+        left(model->get_degree() + 1),
+        right(model->get_degree() + 1),
+        span(model->get_degree()) {
+    b.setZero();
+    N.setZero();
+    left.setZero();
+    right.setZero();
+  }
+
+  virtual ~ControlParametrizationDataBSplineTpl() {}
+
+  VectorXs b;        //!< Basis functions of the control points
+  VectorXs N;        //!< Nonzero basis functions
+  VectorXs left;     //!< Cox-de Boor left differences
+  VectorXs right;    //!< Cox-de Boor right differences
+  std::size_t span;  //!< Knot span of the spline time
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/controls/bspline.hxx"
+
+#endif  // CROCODDYL_CORE_CONTROLS_BSPLINE_HPP_
@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace crocoddyl {
+
+template <typename Scalar>
+ControlParametrizationModelBSplineTpl<Scalar>::
+    ControlParametrizationModelBSplineTpl(const std::size_t nw,
+                                          const std::size_t ncp,
+                                          const std::size_t degree,
+                                          const Scalar t0, const Scalar t1)
+    : Base(nw, ncp * nw),
+      ncp_(ncp),
+      degree_(degree),
+      t0_(t0),
+      t1_(t1),
+      knots_(ncp + degree + 1) {
+  if (ncp <= degree) {
+    throw_pretty(
+        "Invalid argument: " << "ncp should be greater than degree (" +
+                                    std::to_string(degree) + ")");
+  }
+  if (t0 < Scalar(0.) || t1 > Scalar(1.) || t1 < t0) {
+    throw_pretty("Invalid argument: "
+                 << "the window [t0, t1] should be contained in [0, 1]");
+  }
+  // Clamped uniform knots, i.e., the spline interpolates the first and last
+  // control points
+  const std::size_t nspans = ncp - degree;
+  for (std::size_t i = 0; i < knots_.size(); ++i) {
+    if (i <= degree) {
+      knots_[i] = Scalar(0.);
+    } else if (i >= ncp) {
+      knots_[i] = Scalar(1.);
+    } else {
+      knots_[i] = Scalar(i - degree) / Scalar(nspans);
+    }
+  }
+}
+
+template <typename Scalar>
+ControlParametrizationModelBSplineTpl<
+    Scalar>::~ControlParametrizationModelBSplineTpl() {}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::calc(
+    const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+    const Scalar t, const Eigen::Ref<const VectorXs>& u) const {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  computeBasis(d, t);
+  data->w.setZero();
+  const std::size_t first = d->span - degree_;
+  for (std::size_t r = 0; r <= degree_; ++r) {
+    data->w += d->N[r] * u.segment((first + r) * nw_, nw_);
+  }
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+    const Scalar, const Eigen::Ref<const VectorXs>&) const {
+  Data* d = static_cast<Data*>(data.get());
+  for (std::size_t i = 0; i < ncp_; ++i) {
+    data->dw_du.middleCols(i * nw_, nw_).diagonal().array() = d->b[i];
+  }
+}
+
+template <typename Scalar>
+std::shared_ptr<ControlParametrizationDataAbstractTpl<Scalar> >
+ControlParametrizationModelBSplineTpl<Scalar>::createData() {
+  return std::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::params(
+    const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+    const Scalar, const Eigen::Ref<const VectorXs>& w) const {
+  if (static_cast<std::size_t>(w.size()) != nw_) {
+    throw_pretty(
+        "Invalid argument: " << "w has wrong dimension (it should be " +
+                                    std::to_string(nw_) + ")");
+  }
+  for (std::size_t i = 0; i < ncp_; ++i) {
+    data->u.segment(i * nw_, nw_) = w;
+  }
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::convertBounds(
+    const Eigen::Ref<const VectorXs>& w_lb,
+    const Eigen::Ref<const VectorXs>& w_ub, Eigen::Ref<VectorXs> u_lb,
+    Eigen::Ref<VectorXs> u_ub) const {
+  if (static_cast<std::size_t>(u_lb.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u_lb has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(u_ub.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u_ub has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(w_lb.size()) != nw_) {
+    throw_pretty(
+        "Invalid argument: " << "w_lb has wrong dimension (it should be " +
+                                    std::to_string(nw_) + ")");
+  }
+  if (static_cast<std::size_t>(w_ub.size()) != nw_) {
+    throw_pretty(
+        "Invalid argument: " << "w_ub has wrong dimension (it should be " +
+                                    std::to_string(nw_) + ")");
+  }
+  for (std::size_t i = 0; i < ncp_; ++i) {
+    u_lb.segment(i * nw_, nw_) = w_lb;
+    u_ub.segment(i * nw_, nw_) = w_ub;
+  }
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::multiplyByJacobian(
+    const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+    const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+    const AssignmentOp op) const {
+  assert_pretty(is_a_AssignmentOp(op),
+                ("op must be one of the AssignmentOp {settop, addto, rmfrom}"));
+  if (A.rows() != out.rows() || static_cast<std::size_t>(A.cols()) != nw_ ||
+      static_cast<std::size_t>(out.cols()) != nu_) {
+    throw_pretty("Invalid argument: " << "A and out have wrong dimensions (" +
+                                             std::to_string(A.rows()) + "," +
+                                             std::to_string(A.cols()) +
+                                             " and " +
+                                             std::to_string(out.rows()) + "," +
+                                             std::to_string(out.cols()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  switch (op) {
+    case setto:
+      for (std::size_t i = 0; i < ncp_; ++i) {
+        out.middleCols(i * nw_, nw_) = d->b[i] * A;
+      }
+      break;
+    case addto:
+      // Only the blocks of the nonzero basis functions are modified
+      for (std::size_t r = 0; r <= degree_; ++r) {
+        out.middleCols((d->span - degree_ + r) * nw_, nw_) += d->N[r] * A;
+      }
+      break;
+    case rmfrom:
+      for (std::size_t r = 0; r <= degree_; ++r) {
+        out.middleCols((d->span - degree_ + r) * nw_, nw_) -= d->N[r] * A;
+      }
+      break;
+    default:
+      throw_pretty("Invalid argument: allowed operators: setto, addto, rmfrom");
+      break;
+  }
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::multiplyJacobianTransposeBy(
+    const std::shared_ptr<ControlParametrizationDataAbstract>& data,
+    const Eigen::Ref<const MatrixXs>& A, Eigen::Ref<MatrixXs> out,
+    const AssignmentOp op) const {
+  assert_pretty(is_a_AssignmentOp(op),
+                ("op must be one of the AssignmentOp {settop, addto, rmfrom}"));
+  if (A.cols() != out.cols() || static_cast<std::size_t>(A.rows()) != nw_ ||
+      static_cast<std::size_t>(out.rows()) != nu_) {
+    throw_pretty("Invalid argument: " << "A and out have wrong dimensions (" +
+                                             std::to_string(A.rows()) + "," +
+                                             std::to_string(A.cols()) +
+                                             " and " +
+                                             std::to_string(out.rows()) + "," +
+                                             std::to_string(out.cols()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  switch (op) {
+    case setto:
+      for (std::size_t i = 0; i < ncp_; ++i) {
+        out.middleRows(i * nw_, nw_) = d->b[i] * A;
+      }
+      break;
+    case addto:
+      for (std::size_t r = 0; r <= degree_; ++r) {
+        out.middleRows((d->span - degree_ + r) * nw_, nw_) += d->N[r] * A;
+      }
+      break;
+    case rmfrom:
+      for (std::size_t r = 0; r <= degree_; ++r) {
+        out.middleRows((d->span - degree_ + r) * nw_, nw_) -= d->N[r] * A;
+      }
+      break;
+    default:
+      throw_pretty("Invalid argument: allowed operators: setto, addto, rmfrom");
+      break;
+  }
+}
+
+template <typename Scalar>
+void ControlParametrizationModelBSplineTpl<Scalar>::computeBasis(
+    Data* d, const Scalar t) const {
+  // Spline time clamped to the knot domain
+  Scalar tau = t0_ + t * (t1_ - t0_);
+  if (tau < Scalar(0.)) {
+    tau = Scalar(0.);
+  } else if (tau > Scalar(1.)) {
+    tau = Scalar(1.);
+  }
+  // Knot span such that knots[span] <= tau < knots[span + 1], where the last
+  // span is closed
+  std::size_t span = degree_;
+  while (span + 1 < ncp_ && tau >= knots_[span + 1]) {
+    ++span;
+  }
+  d->span = span;
+  // Cox-de Boor recursion on the nonzero basis functions
+  d->N[0] = Scalar(1.);
+  for (std::size_t j = 1; j <= degree_; ++j) {
+    d->left[j] = tau - knots_[span + 1 - j];
+    d->right[j] = knots_[span + j] - tau;
+    Scalar saved = Scalar(0.);
+    for (std::size_t r = 0; r < j; ++r) {
+      const Scalar tmp = d->N[r] / (d->right[r + 1] + d->left[j - r]);
+      d->N[r] = saved + d->right[r + 1] * tmp;
+      saved = d->left[j - r] * tmp;
+    }
+    d->N[j] = saved;
+  }
+  d->b.setZero();
+  d->b.segment(span - degree_, degree_ + 1) = d->N;
+}
+
+template <typename Scalar>
+std::size_t ControlParametrizationModelBSplineTpl<Scalar>::get_ncp() const {
+  return ncp_;
+}
+
+template <typename Scalar>
+std::size_t ControlParametrizationModelBSplineTpl<Scalar>::get_degree() const {
+  return degree_;
+}
+
+template <typename Scalar>
+const Scalar ControlParametrizationModelBSplineTpl<Scalar>::get_t0() const {
+  return t0_;
+}
+
+template <typename Scalar>
+const Scalar ControlParametrizationModelBSplineTpl<Scalar>::get_t1() const {
+  return t1_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::VectorXs&
+ControlParametrizationModelBSplineTpl<Scalar>::get_knots() const {
+  return knots_;
+}
+
+}  // namespace crocoddyl
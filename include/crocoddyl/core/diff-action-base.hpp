@@ -13,6 +13,7 @@
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "crocoddyl/core/fwd.hpp"
 #include "crocoddyl/core/state-base.hpp"
@@ -127,6 +128,8 @@ class DifferentialActionModelAbstractTpl {
   typedef StateAbstractTpl<Scalar> StateAbstract;
   typedef typename MathBase::VectorXs VectorXs;
   typedef typename MathBase::MatrixXs MatrixXs;
+  typedef typename MathBase::MatrixXsRowMajor MatrixXsRowMajor;
+  typedef DifferentialActionBatchDataTpl<Scalar> DifferentialActionBatchData;
 
   /**
    * @brief Initialize the differential action model
@@ -205,6 +208,36 @@ class DifferentialActionModelAbstractTpl {
       const std::shared_ptr<DifferentialActionDataAbstract>& data,
       const Eigen::Ref<const VectorXs>& x);
 
+  /**
+   * @brief Compute the system acceleration, cost value and their derivatives
+   *
+   * It runs the forward and derivative computations in a single call. Models
+   * that share intermediate quantities between `calc()` and `calcDiff()` (e.g.,
+   * rigid-body dynamics terms) can override this function to avoid computing
+   * them twice. By default, it calls `calc()` followed by `calcDiff()`.
+   *
+   * @param[in] data  Differential action data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(
+      const std::shared_ptr<DifferentialActionDataAbstract>& data,
+      const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the total cost value and its derivatives for nodes that
+   * depends only on the state
+   *
+   * By default, it calls `calc()` followed by `calcDiff()`. This function is
+   * used in the terminal nodes of an optimal control problem.
+   *
+   * @param[in] data  Differential action data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcAndDiff(
+      const std::shared_ptr<DifferentialActionDataAbstract>& data,
+      const Eigen::Ref<const VectorXs>& x);
+
   /**
    * @brief Create the differential action data
    *
@@ -218,6 +251,48 @@ class DifferentialActionModelAbstractTpl {
   virtual bool checkData(
       const std::shared_ptr<DifferentialActionDataAbstract>& data);
 
+  /**
+   * @brief Create the data of a batch evaluation
+   *
+   * @param[in] N         Number of samples
+   * @param[in] nthreads  Number of threads (default is the number of threads
+   * of the multithreading support)
+   * @return the batch data
+   */
+  std::shared_ptr<DifferentialActionBatchData> createBatchData(
+      const std::size_t N, const std::size_t nthreads = 0);
+
+  /**
+   * @brief Compute the system accelerations and cost values of a batch of
+   * samples
+   *
+   * The samples are distributed over the threads of the batch data, and each
+   * thread runs `calc()` with its own data. An empty matrix of controls
+   * evaluates the terminal model, i.e., `calc(data, x)`.
+   *
+   * @param[in] data  Batch data
+   * @param[in] xs    States (N x nx, one sample per row)
+   * @param[in] us    Controls (N x nu, or empty)
+   */
+  void calcBatch(const std::shared_ptr<DifferentialActionBatchData>& data,
+                 const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                 const Eigen::Ref<const MatrixXsRowMajor>& us);
+
+  /**
+   * @brief Compute the system accelerations, cost values and their
+   * derivatives of a batch of samples
+   *
+   * Each thread runs `calc()` and `calcDiff()` with its own data, so there is
+   * no need to call `calcBatch()` beforehand.
+   *
+   * @param[in] data  Batch data
+   * @param[in] xs    States (N x nx, one sample per row)
+   * @param[in] us    Controls (N x nu, or empty)
+   */
+  void calcDiffBatch(const std::shared_ptr<DifferentialActionBatchData>& data,
+                     const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                     const Eigen::Ref<const MatrixXsRowMajor>& us);
+
   /**
    * @brief Computes the quasic static commands
    *
@@ -348,6 +423,13 @@ class DifferentialActionModelAbstractTpl {
   virtual void print(std::ostream& os) const;
 
  private:
+  /**
+   * @brief Check the dimensions of a batch evaluation
+   */
+  void checkBatch(const DifferentialActionBatchData& data,
+                  const Eigen::Ref<const MatrixXsRowMajor>& xs,
+                  const Eigen::Ref<const MatrixXsRowMajor>& us) const;
+
   std::size_t ng_internal_;  //!< Internal object for storing the number of
                              //!< inequality constraints
   std::size_t nh_internal_;  //!< Internal object for storing the number of
@@ -460,6 +542,73 @@ struct DifferentialActionDataAbstractTpl {
                  //!< \f$\mathbf{u}\f$
 };
 
+/**
+ * @brief Data of a batch evaluation
+ *
+ * It contains the differential action data of each thread and the outputs of
+ * the samples, one sample per row. The matrices of a sample are flattened in
+ * row-major order, e.g., the row \f$k\f$ of `Fx` is the Jacobian of the sample
+ * \f$k\f$, so the outputs can be reshaped without copying them.
+ */
+template <typename _Scalar>
+struct DifferentialActionBatchDataTpl {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef DifferentialActionDataAbstractTpl<Scalar>
+      DifferentialActionDataAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXsRowMajor MatrixXsRowMajor;
+
+  template <template <typename Scalar> class Model>
+  DifferentialActionBatchDataTpl(Model<Scalar>* const model,
+                                 const std::size_t N,
+                                 const std::size_t nthreads)
+      : nthreads(1),
+        xout(N, model->get_state()->get_nv()),
+        cost(N),
+        Fx(N, model->get_state()->get_nv() * model->get_state()->get_ndx()),
+        Fu(N, model->get_state()->get_nv() * model->get_nu()),
+        Lx(N, model->get_state()->get_ndx()),
+        Lu(N, model->get_nu()),
+        Lxx(N, model->get_state()->get_ndx() * model->get_state()->get_ndx()),
+        Lxu(N, model->get_state()->get_ndx() * model->get_nu()),
+        Luu(N, model->get_nu() * model->get_nu()) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    this->nthreads = nthreads == 0 ? CROCODDYL_WITH_NTHREADS : nthreads;
+#else
+    (void)nthreads;
+#endif
+    for (std::size_t i = 0; i < this->nthreads; ++i) {
+      datas.push_back(model->createData());
+    }
+    xout.setZero();
+    cost.setZero();
+    Fx.setZero();
+    Fu.setZero();
+    Lx.setZero();
+    Lu.setZero();
+    Lxx.setZero();
+    Lxu.setZero();
+    Luu.setZero();
+  }
+  virtual ~DifferentialActionBatchDataTpl() {}
+
+  std::size_t nthreads;  //!< Number of threads
+  std::vector<std::shared_ptr<DifferentialActionDataAbstract> >
+      datas;              //!< Differential action data of each thread
+  MatrixXsRowMajor xout;  //!< System accelerations
+  VectorXs cost;          //!< Cost values
+  MatrixXsRowMajor Fx;    //!< Jacobians of the dynamics w.r.t. the state
+  MatrixXsRowMajor Fu;    //!< Jacobians of the dynamics w.r.t. the control
+  MatrixXsRowMajor Lx;    //!< Jacobians of the cost w.r.t. the state
+  MatrixXsRowMajor Lu;    //!< Jacobians of the cost w.r.t. the control
+  MatrixXsRowMajor Lxx;   //!< Hessians of the cost w.r.t. the state
+  MatrixXsRowMajor Lxu;   //!< Hessians of the cost w.r.t. the state/control
+  MatrixXsRowMajor Luu;   //!< Hessians of the cost w.r.t. the control
+};
+
 }  // namespace crocoddyl
 
 /* --- Details -------------------------------------------------------------- */
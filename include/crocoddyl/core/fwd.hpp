@@ -30,6 +30,8 @@ class ActionModelAbstractTpl;
 
 template <typename Scalar>
 struct ActionDataAbstractTpl;
+template <typename Scalar>
+struct ActionBatchDataTpl;
 
 template <typename Scalar>
 class ActionModelUnicycleTpl;
@@ -46,6 +48,8 @@ template <typename Scalar>
 class DifferentialActionModelAbstractTpl;
 template <typename Scalar>
 struct DifferentialActionDataAbstractTpl;
+template <typename Scalar>
+struct DifferentialActionBatchDataTpl;
 
 template <typename Scalar>
 class DifferentialActionModelLQRTpl;
@@ -63,6 +67,16 @@ class IntegratedActionModelEulerTpl;
 template <typename Scalar>
 struct IntegratedActionDataEulerTpl;
 
+template <typename Scalar>
+class IntegratedActionModelImplicitEulerTpl;
+template <typename Scalar>
+struct IntegratedActionDataImplicitEulerTpl;
+
+template <typename Scalar>
+class IntegratedActionModelMultiStepTpl;
+template <typename Scalar>
+struct IntegratedActionDataMultiStepTpl;
+
 template <typename Scalar>
 class IntegratedActionModelRKTpl;
 template <typename Scalar>
@@ -154,6 +168,11 @@ class ControlParametrizationModelPolyTwoRKTpl;
 template <typename Scalar>
 struct ControlParametrizationDataPolyTwoRKTpl;
 
+template <typename Scalar>
+class ControlParametrizationModelBSplineTpl;
+template <typename Scalar>
+struct ControlParametrizationDataBSplineTpl;
+
 // actuation
 template <typename Scalar>
 class ActuationModelAbstractTpl;
@@ -295,6 +314,7 @@ struct ActionDataCodeGenTpl;
 /********************Template Instantiation*************/
 typedef ActionModelAbstractTpl<double> ActionModelAbstract;
 typedef ActionDataAbstractTpl<double> ActionDataAbstract;
+typedef ActionBatchDataTpl<double> ActionBatchData;
 typedef ActionModelUnicycleTpl<double> ActionModelUnicycle;
 typedef ActionDataUnicycleTpl<double> ActionDataUnicycle;
 typedef ActionModelLQRTpl<double> ActionModelLQR;
@@ -304,6 +324,7 @@ typedef DifferentialActionModelAbstractTpl<double>
     DifferentialActionModelAbstract;
 typedef DifferentialActionDataAbstractTpl<double>
     DifferentialActionDataAbstract;
+typedef DifferentialActionBatchDataTpl<double> DifferentialActionBatchData;
 typedef DifferentialActionModelLQRTpl<double> DifferentialActionModelLQR;
 typedef DifferentialActionDataLQRTpl<double> DifferentialActionDataLQR;
 
@@ -311,6 +332,13 @@ typedef IntegratedActionModelAbstractTpl<double> IntegratedActionModelAbstract;
 typedef IntegratedActionDataAbstractTpl<double> IntegratedActionDataAbstract;
 typedef IntegratedActionModelEulerTpl<double> IntegratedActionModelEuler;
 typedef IntegratedActionDataEulerTpl<double> IntegratedActionDataEuler;
+typedef IntegratedActionModelImplicitEulerTpl<double>
+    IntegratedActionModelImplicitEuler;
+typedef IntegratedActionDataImplicitEulerTpl<double>
+    IntegratedActionDataImplicitEuler;
+typedef IntegratedActionModelMultiStepTpl<double>
+    IntegratedActionModelMultiStep;
+typedef IntegratedActionDataMultiStepTpl<double> IntegratedActionDataMultiStep;
 typedef IntegratedActionModelRKTpl<double> IntegratedActionModelRK;
 typedef IntegratedActionDataRKTpl<double> IntegratedActionDataRK;
 DEPRECATED(
@@ -375,6 +403,10 @@ typedef ControlParametrizationModelPolyTwoRKTpl<double>
     ControlParametrizationModelPolyTwoRK;
 typedef ControlParametrizationDataPolyTwoRKTpl<double>
     ControlParametrizationDataPolyTwoRK;
+typedef ControlParametrizationModelBSplineTpl<double>
+    ControlParametrizationModelBSpline;
+typedef ControlParametrizationDataBSplineTpl<double>
+    ControlParametrizationDataBSpline;
 
 typedef ActuationDataAbstractTpl<double> ActuationDataAbstract;
 typedef ActuationModelAbstractTpl<double> ActuationModelAbstract;
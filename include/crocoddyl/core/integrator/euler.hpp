@@ -132,6 +132,33 @@ class IntegratedActionModelEulerTpl
   virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x);
 
+  /**
+   * @brief Integrate the differential action model and compute its partial
+   * derivatives using symplectic Euler scheme
+   *
+   * It evaluates the differential model through its fused
+   * `DifferentialActionModelAbstractTpl::calcAndDiff()` entry point, so the
+   * dynamics and kinematics computed for the forward pass are reused by the
+   * derivative one.
+   *
+   * @param[in] data  Symplectic Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Integrate the total cost value and compute its derivatives for
+   * nodes that depends only on the state using symplectic Euler scheme
+   *
+   * @param[in] data  Symplectic Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x);
+
   /**
    * @brief Create the symplectic Euler data
    *
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <typeinfo>
 
+#include "crocoddyl/core/controls/bspline.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 
 namespace crocoddyl {
@@ -155,10 +156,101 @@ void IntegratedActionModelEulerTpl<Scalar>::calcDiff(
   d->Hx = d->differential->Hx;
 }
 
+template <typename Scalar>
+void IntegratedActionModelEulerTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  const std::size_t nv = state_->get_nv();
+  Data* d = static_cast<Data*>(data.get());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> v =
+      x.tail(nv);
+
+  control_->calc(d->control, Scalar(0.), u);
+  differential_->calcAndDiff(d->differential, x, d->control->w);
+  const VectorXs& a = d->differential->xout;
+  d->dx.head(nv).noalias() = v * time_step_ + a * time_step2_;
+  d->dx.tail(nv).noalias() = a * time_step_;
+  differential_->get_state()->integrate(x, d->dx, d->xnext);
+  d->cost = time_step_ * d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+
+  const MatrixXs& da_dx = d->differential->Fx;
+  const MatrixXs& da_du = d->differential->Fu;
+  control_->multiplyByJacobian(d->control, da_du, d->da_du);
+  d->Fx.topRows(nv).noalias() = da_dx * time_step2_;
+  d->Fx.bottomRows(nv).noalias() = da_dx * time_step_;
+  d->Fx.topRightCorner(nv, nv).diagonal().array() += Scalar(time_step_);
+  d->Fu.topRows(nv).noalias() = time_step2_ * d->da_du;
+  d->Fu.bottomRows(nv).noalias() = time_step_ * d->da_du;
+  state_->JintegrateTransport(x, d->dx, d->Fx, second);
+  state_->Jintegrate(x, d->dx, d->Fx, d->Fx, first, addto);
+  state_->JintegrateTransport(x, d->dx, d->Fu, second);
+
+  d->Lx.noalias() = time_step_ * d->differential->Lx;
+  control_->multiplyJacobianTransposeBy(d->control, d->differential->Lu, d->Lu);
+  d->Lu *= time_step_;
+  d->Lxx.noalias() = time_step_ * d->differential->Lxx;
+  control_->multiplyByJacobian(d->control, d->differential->Lxu, d->Lxu);
+  d->Lxu *= time_step_;
+  control_->multiplyByJacobian(d->control, d->differential->Luu, d->Lwu);
+  control_->multiplyJacobianTransposeBy(d->control, d->Lwu, d->Luu);
+  d->Luu *= time_step_;
+  d->Gx = d->differential->Gx;
+  d->Hx = d->differential->Hx;
+  d->Gu.conservativeResize(differential_->get_ng(), nu_);
+  d->Hu.conservativeResize(differential_->get_nh(), nu_);
+  control_->multiplyByJacobian(d->control, d->differential->Gu, d->Gu);
+  control_->multiplyByJacobian(d->control, d->differential->Hu, d->Hu);
+}
+
+template <typename Scalar>
+void IntegratedActionModelEulerTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  differential_->calcAndDiff(d->differential, x);
+  d->dx.setZero();
+  d->xnext = x;
+  d->cost = d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+  state_->Jintegrate(x, d->dx, d->Fx, d->Fx);
+  d->Lx = d->differential->Lx;
+  d->Lxx = d->differential->Lxx;
+  d->Gx = d->differential->Gx;
+  d->Hx = d->differential->Hx;
+}
+
 template <typename Scalar>
 std::shared_ptr<ActionDataAbstractTpl<Scalar> >
 IntegratedActionModelEulerTpl<Scalar>::createData() {
-  if (control_->get_nu() > differential_->get_nu())
+  // A B-spline spans several steps, so it is not evaluated within one step only
+  if (control_->get_nu() > differential_->get_nu() &&
+      !std::dynamic_pointer_cast<
+          ControlParametrizationModelBSplineTpl<Scalar> >(control_))
     std::cerr << "Warning: It is useless to use an Euler integrator with a "
                  "control parametrization larger than PolyZero"
               << std::endl;
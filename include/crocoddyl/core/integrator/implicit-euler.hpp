@@ -0,0 +1,392 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_INTEGRATOR_IMPLICIT_EULER_HPP_
+#define CROCODDYL_CORE_INTEGRATOR_IMPLICIT_EULER_HPP_
+
+#include <Eigen/LU>
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+
+enum ImplicitEulerType { Implicit = 0, SemiImplicit };
+
+/**
+ * @brief Implicit Euler integrator
+ *
+ * It applies an implicit Euler integration scheme to a differential (i.e.,
+ * continuous time) action model. The state increment
+ * \f$\Delta\mathbf{x}=(\Delta\mathbf{q},\Delta\mathbf{v})\f$ is the root of
+ * \f{equation}
+ *   \mathbf{r}(\Delta\mathbf{x}) = \Delta\mathbf{x} - \Delta t
+ *   \begin{bmatrix}\mathbf{v}_z \\ \mathbf{a}(\mathbf{z},\mathbf{w})
+ *   \end{bmatrix} = \mathbf{0},
+ * \f}
+ * and the next state is \f$\mathbf{x}'=\mathbf{x}\oplus\Delta\mathbf{x}\f$.
+ * The available schemes differ in the point \f$\mathbf{z}\f$ where the
+ * differential model is evaluated:
+ *  - `Implicit`: backward Euler, i.e.,
+ * \f$\mathbf{z}=\mathbf{x}\oplus\Delta\mathbf{x}\f$,
+ *  - `SemiImplicit`: implicit in the velocity only, i.e.,
+ * \f$\mathbf{z}=(\mathbf{q},\mathbf{v}+\Delta\mathbf{v})\f$.
+ *
+ * Both schemes remain stable for stiff dynamics (e.g., stiff contacts or high
+ * armature and damping gains), which allows coarser time steps than the
+ * explicit integrators. The root is computed with Newton iterations starting
+ * from the symplectic Euler step. Then, the derivatives are obtained through
+ * the implicit function theorem, i.e.,
+ * \f{equation}
+ *   \frac{\partial\Delta\mathbf{x}}{\partial(\mathbf{x},\mathbf{u})} =
+ *   -\left(\frac{\partial\mathbf{r}}{\partial\Delta\mathbf{x}}\right)^{-1}
+ *   \frac{\partial\mathbf{r}}{\partial(\mathbf{x},\mathbf{u})},
+ * \f}
+ * where the Jacobians of the residual are built from the derivatives of the
+ * differential model at \f$\mathbf{z}\f$ and `StateAbstractTpl::Jintegrate()`.
+ * The cost and constraints are evaluated at the current state, as in the
+ * symplectic Euler integrator.
+ *
+ * We use \f$\mathbf{w}\f$ to refer to the control inputs of the differential
+ * model and \f$\mathbf{u}\f$ for the control inputs of the integrated action
+ * model. Note that the zero-order (e.g.,
+ * `ControlParametrizationModelPolyZeroTpl`) are the only ones that make sense
+ * to use within this integrator.
+ *
+ * \sa `IntegratedActionModelEulerTpl`, `calc()`, `calcDiff()`, `createData()`
+ */
+template <typename _Scalar>
+class IntegratedActionModelImplicitEulerTpl
+    : public IntegratedActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef IntegratedActionModelAbstractTpl<Scalar> Base;
+  typedef IntegratedActionDataImplicitEulerTpl<Scalar> Data;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef DifferentialActionModelAbstractTpl<Scalar>
+      DifferentialActionModelAbstract;
+  typedef ControlParametrizationModelAbstractTpl<Scalar>
+      ControlParametrizationModelAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  /**
+   * @brief Initialize the implicit Euler integrator
+   *
+   * @param[in] model               Differential action model
+   * @param[in] control             Control parametrization
+   * @param[in] type                Type of implicit Euler integrator
+   * @param[in] time_step           Step time (default 1e-3)
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelImplicitEulerTpl(
+      std::shared_ptr<DifferentialActionModelAbstract> model,
+      std::shared_ptr<ControlParametrizationModelAbstract> control,
+      const ImplicitEulerType type, const Scalar time_step = Scalar(1e-3),
+      const bool with_cost_residual = true);
+
+  /**
+   * @brief Initialize the implicit Euler integrator
+   *
+   * This initialization uses `ControlParametrizationPolyZeroTpl` for the
+   * control parametrization.
+   *
+   * @param[in] model               Differential action model
+   * @param[in] type                Type of implicit Euler integrator
+   * @param[in] time_step           Step time (default 1e-3)
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelImplicitEulerTpl(
+      std::shared_ptr<DifferentialActionModelAbstract> model,
+      const ImplicitEulerType type, const Scalar time_step = Scalar(1e-3),
+      const bool with_cost_residual = true);
+  virtual ~IntegratedActionModelImplicitEulerTpl();
+
+  /**
+   * @brief Integrate the differential action model using implicit Euler
+   * scheme
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calc(const std::shared_ptr<ActionDataAbstract>& data,
+                    const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Integrate the total cost value for nodes that depends only on the
+   * state using implicit Euler scheme
+   *
+   * It computes the total cost and defines the next state as the current one.
+   * This function is used in the terminal nodes of an optimal control problem.
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calc(const std::shared_ptr<ActionDataAbstract>& data,
+                    const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Compute the partial derivatives of the implicit Euler integrator
+   *
+   * It assumes that `calc()` has been run first.
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                        const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the partial derivatives of the cost
+   *
+   * It updates the derivatives of the cost function with respect to the state
+   * only. This function is used in the terminal nodes of an optimal control
+   * problem.
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                        const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Integrate the differential action model and compute its partial
+   * derivatives using implicit Euler scheme
+   *
+   * The Newton iterations evaluate the differential model through its fused
+   * `DifferentialActionModelAbstractTpl::calcAndDiff()` entry point, so the
+   * derivatives at the last iterate are reused by the implicit function
+   * theorem.
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Integrate the total cost value and compute its derivatives for
+   * nodes that depends only on the state using implicit Euler scheme
+   *
+   * @param[in] data  Implicit Euler data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Create the implicit Euler data
+   *
+   * @return the implicit Euler data
+   */
+  virtual std::shared_ptr<ActionDataAbstract> createData();
+
+  /**
+   * @brief Checks that a specific data belongs to this model
+   */
+  virtual bool checkData(const std::shared_ptr<ActionDataAbstract>& data);
+
+  /**
+   * @brief Computes the quasic static commands
+   *
+   * The quasic static commands are the ones produced for a the reference
+   * posture as an equilibrium point, i.e. for
+   * \f$\mathbf{f^q_x}\delta\mathbf{q}+\mathbf{f_u}\delta\mathbf{u}=\mathbf{0}\f$
+   *
+   * @param[in] data    Implicit Euler data
+   * @param[out] u      Quasic static commands
+   * @param[in] x       State point (velocity has to be zero)
+   * @param[in] maxiter Maximum allowed number of iterations
+   * @param[in] tol     Tolerance
+   */
+  virtual void quasiStatic(const std::shared_ptr<ActionDataAbstract>& data,
+                           Eigen::Ref<VectorXs> u,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const std::size_t maxiter = 100,
+                           const Scalar tol = Scalar(1e-9));
+
+  /**
+   * @brief Return the type of implicit Euler integrator
+   */
+  ImplicitEulerType get_type() const;
+
+  /**
+   * @brief Return the maximum number of Newton iterations
+   */
+  std::size_t get_maxiter() const;
+
+  /**
+   * @brief Return the tolerance on the infinity norm of the residual
+   */
+  Scalar get_tol() const;
+
+  /**
+   * @brief Modify the maximum number of Newton iterations
+   */
+  void set_maxiter(const std::size_t maxiter);
+
+  /**
+   * @brief Modify the tolerance on the infinity norm of the residual
+   */
+  void set_tol(const Scalar tol);
+
+  /**
+   * @brief Print relevant information of the implicit Euler integrator model
+   *
+   * @param[out] os  Output stream object
+   */
+  virtual void print(std::ostream& os) const;
+
+ protected:
+  using Base::control_;       //!< Control parametrization
+  using Base::differential_;  //!< Differential action model
+  using Base::ng_;            //!< Number of inequality constraints
+  using Base::nh_;            //!< Number of equality constraints
+  using Base::nu_;            //!< Dimension of the control
+  using Base::state_;         //!< Model of the state
+  using Base::time_step2_;    //!< Square of the time step used for integration
+  using Base::time_step_;     //!< Time step used for integration
+  using Base::with_cost_residual_;  //!< Flag indicating whether a cost residual
+                                    //!< is used
+
+ private:
+  /**
+   * @brief Solve the implicit step with Newton iterations
+   *
+   * It starts from the symplectic Euler step, which requires the differential
+   * model to be evaluated at the current state.
+   *
+   * @param[in] d          Implicit Euler data
+   * @param[in] x          State point
+   * @param[in] with_diff  True if the derivatives at the last iterate are
+   * computed together with its evaluation
+   */
+  void solveStep(Data* d, const Eigen::Ref<const VectorXs>& x,
+                 const bool with_diff);
+
+  /**
+   * @brief Factorize the Jacobian of the residual at the current iterate
+   *
+   * It assumes that the derivatives of the differential model at
+   * \f$\mathbf{z}\f$ are already computed.
+   *
+   * @param[in] d  Implicit Euler data
+   * @param[in] x  State point
+   */
+  void factorizeResidual(Data* d, const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Compute the derivatives of the implicit step and cost
+   *
+   * It assumes that the derivatives of the differential model at the current
+   * state and at \f$\mathbf{z}\f$ are already computed.
+   *
+   * @param[in] d  Implicit Euler data
+   * @param[in] x  State point
+   */
+  void integrateDerivatives(Data* d, const Eigen::Ref<const VectorXs>& x);
+
+  ImplicitEulerType type_;  //!< Type of implicit Euler integrator
+  std::size_t maxiter_;     //!< Maximum number of Newton iterations
+  Scalar tol_;              //!< Tolerance on the residual
+};
+
+template <typename _Scalar>
+struct IntegratedActionDataImplicitEulerTpl
+    : public IntegratedActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef IntegratedActionDataAbstractTpl<Scalar> Base;
+  typedef DifferentialActionDataAbstractTpl<Scalar>
+      DifferentialActionDataAbstract;
+  typedef ControlParametrizationDataAbstractTpl<Scalar>
+      ControlParametrizationDataAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  template <template <typename Scalar> class Model>
+  explicit IntegratedActionDataImplicitEulerTpl(Model<Scalar>* const model)
+      : Base(model), iter(0) {
+    differential = model->get_differential()->createData();
+    differential_z = model->get_differential()->createData();
+    control = model->get_control()->createData();
+    const std::size_t nx = model->get_state()->get_nx();
+    const std::size_t ndx = model->get_state()->get_ndx();
+    const std::size_t nv = model->get_state()->get_nv();
+    const std::size_t nu = model->get_nu();
+    dx = VectorXs::Zero(ndx);
+    dz = VectorXs::Zero(ndx);
+    z = VectorXs::Zero(nx);
+    res = VectorXs::Zero(ndx);
+    step = VectorXs::Zero(ndx);
+    Jz_x = MatrixXs::Zero(ndx, ndx);
+    Jz_dz = MatrixXs::Zero(ndx, ndx);
+    Jres = MatrixXs::Zero(ndx, ndx);
+    Jres_lu = Eigen::PartialPivLU<MatrixXs>(ndx);
+    dres_dx = MatrixXs::Zero(ndx, ndx);
+    dres_du = MatrixXs::Zero(ndx, nu);
+    ddx_dx = MatrixXs::Zero(ndx, ndx);
+    da_du = MatrixXs::Zero(nv, nu);
+    Lwu = MatrixXs::Zero(model->get_control()->get_nw(), nu);
+  }
+  virtual ~IntegratedActionDataImplicitEulerTpl() {}
+
+  std::shared_ptr<DifferentialActionDataAbstract>
+      differential;  //!< Differential model data at the current state
+  std::shared_ptr<DifferentialActionDataAbstract>
+      differential_z;  //!< Differential model data at the implicit point
+  std::shared_ptr<ControlParametrizationDataAbstract>
+      control;  //!< Control parametrization data
+  VectorXs dx;                            //!< State increment
+  VectorXs dz;                            //!< Increment of the implicit point
+  VectorXs z;                             //!< Implicit point
+  VectorXs res;                           //!< Residual of the implicit step
+  VectorXs step;                          //!< Newton step
+  MatrixXs Jz_x;                          //!< Jacobian of z wrt the state
+  MatrixXs Jz_dz;                         //!< Jacobian of z wrt its increment
+  MatrixXs Jres;                          //!< Jacobian of the residual
+  Eigen::PartialPivLU<MatrixXs> Jres_lu;  //!< LU factorization of Jres
+  MatrixXs dres_dx;  //!< Negated Jacobian of the residual wrt the state
+  MatrixXs dres_du;  //!< Negated Jacobian of the residual wrt the control
+  MatrixXs ddx_dx;   //!< Jacobian of the state increment wrt the state
+  MatrixXs da_du;
+  MatrixXs Lwu;  //!< Hessian of the cost function with respect to the control
+                 //!< input (w) and control parameters (u)
+  std::size_t iter;  //!< Number of Newton iterations of the last step
+
+  using Base::cost;
+  using Base::Fu;
+  using Base::Fx;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::Lx;
+  using Base::Lxu;
+  using Base::Lxx;
+  using Base::r;
+  using Base::xnext;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/integrator/implicit-euler.hxx"
+
+#endif  // CROCODDYL_CORE_INTEGRATOR_IMPLICIT_EULER_HPP_
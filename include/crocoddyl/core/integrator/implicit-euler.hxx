@@ -0,0 +1,368 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/demangle.hpp>
+#include <iostream>
+#include <typeinfo>
+
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+IntegratedActionModelImplicitEulerTpl<Scalar>::
+    IntegratedActionModelImplicitEulerTpl(
+        std::shared_ptr<DifferentialActionModelAbstract> model,
+        std::shared_ptr<ControlParametrizationModelAbstract> control,
+        const ImplicitEulerType type, const Scalar time_step,
+        const bool with_cost_residual)
+    : Base(model, control, time_step, with_cost_residual),
+      type_(type),
+      maxiter_(10),
+      tol_(Scalar(1e-10)) {}
+
+template <typename Scalar>
+IntegratedActionModelImplicitEulerTpl<Scalar>::
+    IntegratedActionModelImplicitEulerTpl(
+        std::shared_ptr<DifferentialActionModelAbstract> model,
+        const ImplicitEulerType type, const Scalar time_step,
+        const bool with_cost_residual)
+    : Base(model, time_step, with_cost_residual),
+      type_(type),
+      maxiter_(10),
+      tol_(Scalar(1e-10)) {}
+
+template <typename Scalar>
+IntegratedActionModelImplicitEulerTpl<
+    Scalar>::~IntegratedActionModelImplicitEulerTpl() {}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calc(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  control_->calc(d->control, Scalar(0.), u);
+  differential_->calc(d->differential, x, d->control->w);
+  solveStep(d, x, false);
+  d->cost = time_step_ * d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calc(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  differential_->calc(d->differential, x);
+  d->dx.setZero();
+  d->xnext = x;
+  d->cost = d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  control_->calc(d->control, Scalar(0.), u);
+  differential_->calcDiff(d->differential, x, d->control->w);
+  differential_->calcDiff(d->differential_z, d->z, d->control->w);
+  integrateDerivatives(d, x);
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  differential_->calcDiff(d->differential, x);
+  state_->Jintegrate(x, d->dx, d->Fx, d->Fx);
+  d->Lx = d->differential->Lx;
+  d->Lxx = d->differential->Lxx;
+  d->Gx = d->differential->Gx;
+  d->Hx = d->differential->Hx;
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  control_->calc(d->control, Scalar(0.), u);
+  differential_->calcAndDiff(d->differential, x, d->control->w);
+  solveStep(d, x, true);
+  d->cost = time_step_ * d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+  integrateDerivatives(d, x);
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  differential_->calcAndDiff(d->differential, x);
+  d->dx.setZero();
+  d->xnext = x;
+  d->cost = d->differential->cost;
+  d->g = d->differential->g;
+  d->h = d->differential->h;
+  if (with_cost_residual_) {
+    d->r = d->differential->r;
+  }
+  state_->Jintegrate(x, d->dx, d->Fx, d->Fx);
+  d->Lx = d->differential->Lx;
+  d->Lxx = d->differential->Lxx;
+  d->Gx = d->differential->Gx;
+  d->Hx = d->differential->Hx;
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::solveStep(
+    Data* d, const Eigen::Ref<const VectorXs>& x, const bool with_diff) {
+  const std::size_t ndx = state_->get_ndx();
+  const std::size_t nv = state_->get_nv();
+  const VectorXs& w = d->control->w;
+
+  // Start from the symplectic Euler step
+  const VectorXs& a = d->differential->xout;
+  d->dx.head(nv).noalias() = x.tail(nv) * time_step_ + a * time_step2_;
+  d->dx.tail(nv).noalias() = a * time_step_;
+  d->iter = 0;
+  while (true) {
+    if (type_ == Implicit) {
+      d->dz = d->dx;
+    } else {
+      d->dz.head(ndx - nv).setZero();
+      d->dz.tail(nv) = d->dx.tail(nv);
+    }
+    state_->integrate(x, d->dz, d->z);
+    if (with_diff) {
+      differential_->calcAndDiff(d->differential_z, d->z, w);
+    } else {
+      differential_->calc(d->differential_z, d->z, w);
+    }
+    d->res.head(nv) = d->dx.head(nv) - time_step_ * d->z.tail(nv);
+    d->res.tail(nv) = d->dx.tail(nv) - time_step_ * d->differential_z->xout;
+    if (d->iter == maxiter_ ||
+        d->res.template lpNorm<Eigen::Infinity>() <= tol_) {
+      break;
+    }
+    if (!with_diff) {
+      differential_->calcDiff(d->differential_z, d->z, w);
+    }
+    factorizeResidual(d, x);
+    d->step = d->Jres_lu.solve(d->res);
+    d->dx -= d->step;
+    ++d->iter;
+  }
+  state_->integrate(x, d->dx, d->xnext);
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::factorizeResidual(
+    Data* d, const Eigen::Ref<const VectorXs>& x) {
+  const std::size_t ndx = state_->get_ndx();
+  const std::size_t nv = state_->get_nv();
+  state_->Jintegrate(x, d->dz, d->Jz_x, d->Jz_dz);
+  d->Jres.topRows(nv) = -time_step_ * d->Jz_dz.bottomRows(nv);
+  d->Jres.bottomRows(nv).noalias() =
+      -time_step_ * d->differential_z->Fx * d->Jz_dz;
+  if (type_ == SemiImplicit) {
+    d->Jres.leftCols(ndx - nv).setZero();
+  }
+  d->Jres.diagonal().array() += Scalar(1.);
+  d->Jres_lu.compute(d->Jres);
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::integrateDerivatives(
+    Data* d, const Eigen::Ref<const VectorXs>& x) {
+  const std::size_t nv = state_->get_nv();
+
+  // Derivatives of the state increment through the implicit function theorem
+  factorizeResidual(d, x);
+  d->dres_dx.topRows(nv) = time_step_ * d->Jz_x.bottomRows(nv);
+  d->dres_dx.bottomRows(nv).noalias() =
+      time_step_ * d->differential_z->Fx * d->Jz_x;
+  d->ddx_dx = d->Jres_lu.solve(d->dres_dx);
+  control_->multiplyByJacobian(d->control, d->differential_z->Fu, d->da_du);
+  d->dres_du.topRows(nv).setZero();
+  d->dres_du.bottomRows(nv) = time_step_ * d->da_du;
+  d->Fu = d->Jres_lu.solve(d->dres_du);
+  state_->Jintegrate(x, d->dx, d->Fx, d->Fx, first);
+  state_->JintegrateTransport(x, d->dx, d->ddx_dx, second);
+  d->Fx += d->ddx_dx;
+  state_->JintegrateTransport(x, d->dx, d->Fu, second);
+
+  d->Lx.noalias() = time_step_ * d->differential->Lx;
+  control_->multiplyJacobianTransposeBy(d->control, d->differential->Lu, d->Lu);
+  d->Lu *= time_step_;
+  d->Lxx.noalias() = time_step_ * d->differential->Lxx;
+  control_->multiplyByJacobian(d->control, d->differential->Lxu, d->Lxu);
+  d->Lxu *= time_step_;
+  control_->multiplyByJacobian(d->control, d->differential->Luu, d->Lwu);
+  control_->multiplyJacobianTransposeBy(d->control, d->Lwu, d->Luu);
+  d->Luu *= time_step_;
+  d->Gx = d->differential->Gx;
+  d->Hx = d->differential->Hx;
+  d->Gu.conservativeResize(differential_->get_ng(), nu_);
+  d->Hu.conservativeResize(differential_->get_nh(), nu_);
+  control_->multiplyByJacobian(d->control, d->differential->Gu, d->Gu);
+  control_->multiplyByJacobian(d->control, d->differential->Hu, d->Hu);
+}
+
+template <typename Scalar>
+std::shared_ptr<ActionDataAbstractTpl<Scalar> >
+IntegratedActionModelImplicitEulerTpl<Scalar>::createData() {
+  if (control_->get_nu() > differential_->get_nu())
+    std::cerr << "Warning: It is useless to use an implicit Euler integrator "
+                 "with a control parametrization larger than PolyZero"
+              << std::endl;
+  return std::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+bool IntegratedActionModelImplicitEulerTpl<Scalar>::checkData(
+    const std::shared_ptr<ActionDataAbstract>& data) {
+  std::shared_ptr<Data> d = std::dynamic_pointer_cast<Data>(data);
+  if (d != NULL) {
+    return differential_->checkData(d->differential) &&
+           differential_->checkData(d->differential_z);
+  } else {
+    return false;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::quasiStatic(
+    const std::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+    const Eigen::Ref<const VectorXs>& x, const std::size_t maxiter,
+    const Scalar tol) {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+
+  const std::shared_ptr<Data>& d = std::static_pointer_cast<Data>(data);
+
+  d->control->w.setZero();
+  differential_->quasiStatic(d->differential, d->control->w, x, maxiter, tol);
+  control_->params(d->control, Scalar(0.), d->control->w);
+  u = d->control->u;
+}
+
+template <typename Scalar>
+ImplicitEulerType IntegratedActionModelImplicitEulerTpl<Scalar>::get_type()
+    const {
+  return type_;
+}
+
+template <typename Scalar>
+std::size_t IntegratedActionModelImplicitEulerTpl<Scalar>::get_maxiter() const {
+  return maxiter_;
+}
+
+template <typename Scalar>
+Scalar IntegratedActionModelImplicitEulerTpl<Scalar>::get_tol() const {
+  return tol_;
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::set_maxiter(
+    const std::size_t maxiter) {
+  maxiter_ = maxiter;
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::set_tol(const Scalar tol) {
+  if (tol < Scalar(0.)) {
+    throw_pretty("Invalid argument: " << "tol has to be positive");
+  }
+  tol_ = tol;
+}
+
+template <typename Scalar>
+void IntegratedActionModelImplicitEulerTpl<Scalar>::print(
+    std::ostream& os) const {
+  os << "IntegratedActionModelImplicitEuler {dt=" << time_step_ << ", type="
+     << (type_ == Implicit ? "Implicit" : "SemiImplicit") << ", "
+     << *differential_ << "}";
+}
+
+}  // namespace crocoddyl
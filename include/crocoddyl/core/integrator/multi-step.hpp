@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_INTEGRATOR_MULTI_STEP_HPP_
+#define CROCODDYL_CORE_INTEGRATOR_MULTI_STEP_HPP_
+
+#include <vector>
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/integ-action-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Multi-step integrator
+ *
+ * It chains a sequence of integrated action models (sub-steps) that share the
+ * same control parameters \f$\mathbf{u}\f$. Each sub-step integrates the
+ * differential model over a window of the node, and its control
+ * parametrization evaluates the control input \f$\mathbf{w}\f$ inside that
+ * window. For instance, when the sub-steps use consecutive windows of
+ * `ControlParametrizationModelBSplineTpl`, a single spline spans all of them.
+ * Thus, a long horizon can be described with a few nodes whose control
+ * parameters are spline control points, reducing the size of the control
+ * Hessians factorized by the solvers.
+ *
+ * The next state is the composition of the sub-step transitions, i.e.,
+ * \f$\mathbf{x}_{j+1}=\mathbf{f}_j(\mathbf{x}_j,\mathbf{u})\f$, and the cost is
+ * the sum of the sub-step costs. Its derivatives are obtained by the chain
+ * rule \f$\mathbf{J}^x_{j+1}=\mathbf{f}^j_\mathbf{x}\mathbf{J}^x_j\f$ and
+ * \f$\mathbf{J}^u_{j+1}=\mathbf{f}^j_\mathbf{x}\mathbf{J}^u_j+\mathbf{f}^j_\mathbf{u}\f$,
+ * and the cost Hessians use the Gauss-Newton approximation, i.e., the second
+ * derivatives of the sub-step transitions are neglected. The constraints and
+ * cost residuals of all the sub-steps are stacked.
+ *
+ * \sa `calc()`, `calcDiff()`, `createData()`
+ */
+template <typename _Scalar>
+class IntegratedActionModelMultiStepTpl
+    : public IntegratedActionModelAbstractTpl<_Scalar> {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef IntegratedActionModelAbstractTpl<Scalar> Base;
+  typedef IntegratedActionDataMultiStepTpl<Scalar> Data;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef DifferentialActionModelAbstractTpl<Scalar>
+      DifferentialActionModelAbstract;
+  typedef ControlParametrizationModelAbstractTpl<Scalar>
+      ControlParametrizationModelAbstract;
+  typedef IntegratedActionModelAbstractTpl<Scalar>
+      IntegratedActionModelAbstract;
+  typedef typename MathBase::VectorXs VectorXs;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  /**
+   * @brief Initialize the multi-step integrator from its sub-steps
+   *
+   * All the sub-steps have to share the same state and control-parameter
+   * dimension. The control parametrization describes the control parameters
+   * of the whole node, and it defines the control bounds.
+   *
+   * @param[in] steps               Integrated action models of the sub-steps
+   * @param[in] control             Control parametrization of the node
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelMultiStepTpl(
+      const std::vector<std::shared_ptr<IntegratedActionModelAbstract> >&
+          steps,
+      std::shared_ptr<ControlParametrizationModelAbstract> control,
+      const bool with_cost_residual = true);
+
+  /**
+   * @brief Initialize the multi-step integrator with a B-spline control
+   *
+   * It creates `nsteps` symplectic Euler sub-steps of equal duration, whose
+   * control parametrizations are consecutive windows of the same clamped
+   * B-spline.
+   *
+   * @param[in] model               Differential action model
+   * @param[in] nsteps              Number of sub-steps
+   * @param[in] ncp                 Number of control points of the spline
+   * @param[in] degree              Degree of the spline (default 3)
+   * @param[in] time_step           Duration of the node (default 1e-2)
+   * @param[in] with_cost_residual  Compute cost residual (default true)
+   */
+  IntegratedActionModelMultiStepTpl(
+      std::shared_ptr<DifferentialActionModelAbstract> model,
+      const std::size_t nsteps, const std::size_t ncp,
+      const std::size_t degree = 3, const Scalar time_step = Scalar(1e-2),
+      const bool with_cost_residual = true);
+  virtual ~IntegratedActionModelMultiStepTpl();
+
+  /**
+   * @brief Integrate the differential action model through the sub-steps
+   *
+   * @param[in] data  Multi-step data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calc(const std::shared_ptr<ActionDataAbstract>& data,
+                    const Eigen::Ref<const VectorXs>& x,
+                    const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Integrate the total cost value for nodes that depends only on the
+   * state
+   *
+   * It evaluates the first sub-step only. This function is used in the
+   * terminal nodes of an optimal control problem.
+   *
+   * @param[in] data  Multi-step data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calc(const std::shared_ptr<ActionDataAbstract>& data,
+                    const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Compute the partial derivatives of the multi-step integrator
+   *
+   * @param[in] data  Multi-step data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                        const Eigen::Ref<const VectorXs>& x,
+                        const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Compute the partial derivatives of the cost
+   *
+   * It evaluates the first sub-step only. This function is used in the
+   * terminal nodes of an optimal control problem.
+   *
+   * @param[in] data  Multi-step data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                        const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Create the multi-step data
+   *
+   * @return the multi-step data
+   */
+  virtual std::shared_ptr<ActionDataAbstract> createData();
+
+  /**
+   * @brief Checks that a specific data belongs to this model
+   */
+  virtual bool checkData(const std::shared_ptr<ActionDataAbstract>& data);
+
+  /**
+   * @brief Computes the quasic static commands
+   *
+   * The quasic static commands are the ones produced for a the reference
+   * posture as an equilibrium point, i.e. for
+   * \f$\mathbf{f^q_x}\delta\mathbf{q}+\mathbf{f_u}\delta\mathbf{u}=\mathbf{0}\f$
+   *
+   * @param[in] data    Multi-step data
+   * @param[out] u      Quasic static commands
+   * @param[in] x       State point (velocity has to be zero)
+   * @param[in] maxiter Maximum allowed number of iterations
+   * @param[in] tol     Tolerance
+   */
+  virtual void quasiStatic(const std::shared_ptr<ActionDataAbstract>& data,
+                           Eigen::Ref<VectorXs> u,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const std::size_t maxiter = 100,
+                           const Scalar tol = Scalar(1e-9));
+
+  /**
+   * @brief Return the number of inequality constraints of all the sub-steps
+   */
+  virtual std::size_t get_ng() const;
+
+  /**
+   * @brief Return the number of equality constraints of all the sub-steps
+   */
+  virtual std::size_t get_nh() const;
+
+  /**
+   * @brief Return the lower bound of the stacked inequality constraints
+   */
+  virtual const VectorXs& get_g_lb() const;
+
+  /**
+   * @brief Return the upper bound of the stacked inequality constraints
+   */
+  virtual const VectorXs& get_g_ub() const;
+
+  /**
+   * @brief Return the integrated action models of the sub-steps
+   */
+  const std::vector<std::shared_ptr<IntegratedActionModelAbstract> >&
+  get_steps() const;
+
+  /**
+   * @brief Print relevant information of the multi-step integrator model
+   *
+   * @param[out] os  Output stream object
+   */
+  virtual void print(std::ostream& os) const;
+
+ protected:
+  using Base::control_;       //!< Control parametrization
+  using Base::differential_;  //!< Differential action model
+  using Base::g_lb_;          //!< Lower bound of the inequality constraints
+  using Base::g_ub_;          //!< Upper bound of the inequality constraints
+  using Base::ng_;            //!< Number of inequality constraints
+  using Base::nh_;            //!< Number of equality constraints
+  using Base::nr_;            //!< Dimension of the cost residual
+  using Base::nu_;            //!< Dimension of the control
+  using Base::state_;         //!< Model of the state
+  using Base::time_step_;     //!< Time step used for integration
+  using Base::with_cost_residual_;  //!< Flag indicating whether a cost residual
+                                    //!< is used
+
+ private:
+  /**
+   * @brief Return the differential action model of the first sub-step
+   */
+  static std::shared_ptr<DifferentialActionModelAbstract> getDifferential(
+      const std::vector<std::shared_ptr<IntegratedActionModelAbstract> >&
+          steps);
+
+  /**
+   * @brief Check the sub-steps and stack their dimensions and bounds
+   */
+  void initSteps();
+
+  std::vector<std::shared_ptr<IntegratedActionModelAbstract> >
+      steps_;  //!< Integrated action models of the sub-steps
+};
+
+template <typename _Scalar>
+struct IntegratedActionDataMultiStepTpl
+    : public IntegratedActionDataAbstractTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef _Scalar Scalar;
+  typedef MathBaseTpl<Scalar> MathBase;
+  typedef IntegratedActionDataAbstractTpl<Scalar> Base;
+  typedef ActionDataAbstractTpl<Scalar> ActionDataAbstract;
+  typedef typename MathBase::MatrixXs MatrixXs;
+
+  template <template <typename Scalar> class Model>
+  explicit IntegratedActionDataMultiStepTpl(Model<Scalar>* const model)
+      : Base(model) {
+    const std::size_t nsteps = model->get_steps().size();
+    steps.resize(nsteps);
+    for (std::size_t j = 0; j < nsteps; ++j) {
+      steps[j] = model->get_steps()[j]->createData();
+    }
+    const std::size_t ndx = model->get_state()->get_ndx();
+    const std::size_t nu = model->get_nu();
+    Jx = MatrixXs::Zero(ndx, ndx);
+    Ju = MatrixXs::Zero(ndx, nu);
+    LxxJx = MatrixXs::Zero(ndx, ndx);
+    LxxJu = MatrixXs::Zero(ndx, nu);
+  }
+  virtual ~IntegratedActionDataMultiStepTpl() {}
+
+  std::vector<std::shared_ptr<ActionDataAbstract> >
+      steps;  //!< Data of the sub-steps
+  MatrixXs Jx;  //!< Jacobian of the sub-step state with respect to the state
+  MatrixXs Ju;  //!< Jacobian of the sub-step state with respect to the control
+  MatrixXs LxxJx;  //!< Product of the sub-step Hessian and Jx
+  MatrixXs LxxJu;  //!< Product of the sub-step Hessian and Ju
+
+  using Base::cost;
+  using Base::Fu;
+  using Base::Fx;
+  using Base::Lu;
+  using Base::Luu;
+  using Base::Lx;
+  using Base::Lxu;
+  using Base::Lxx;
+  using Base::r;
+  using Base::xnext;
+};
+
+}  // namespace crocoddyl
+
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+/* --- Details -------------------------------------------------------------- */
+#include "crocoddyl/core/integrator/multi-step.hxx"
+
+#endif  // CROCODDYL_CORE_INTEGRATOR_MULTI_STEP_HPP_
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/demangle.hpp>
+#include <iostream>
+#include <typeinfo>
+
+#include "crocoddyl/core/controls/bspline.hpp"
+#include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+template <typename Scalar>
+IntegratedActionModelMultiStepTpl<Scalar>::IntegratedActionModelMultiStepTpl(
+    const std::vector<std::shared_ptr<IntegratedActionModelAbstract> >& steps,
+    std::shared_ptr<ControlParametrizationModelAbstract> control,
+    const bool with_cost_residual)
+    : Base(getDifferential(steps), control, Scalar(0.), with_cost_residual),
+      steps_(steps) {
+  initSteps();
+}
+
+template <typename Scalar>
+IntegratedActionModelMultiStepTpl<Scalar>::IntegratedActionModelMultiStepTpl(
+    std::shared_ptr<DifferentialActionModelAbstract> model,
+    const std::size_t nsteps, const std::size_t ncp, const std::size_t degree,
+    const Scalar time_step, const bool with_cost_residual)
+    : Base(model,
+           std::make_shared<ControlParametrizationModelBSplineTpl<Scalar> >(
+               model->get_nu(), ncp, degree),
+           time_step, with_cost_residual) {
+  if (nsteps == 0) {
+    throw_pretty("Invalid argument: " << "nsteps should be positive");
+  }
+  const Scalar dt = time_step / Scalar(nsteps);
+  steps_.resize(nsteps);
+  for (std::size_t j = 0; j < nsteps; ++j) {
+    std::shared_ptr<ControlParametrizationModelAbstract> window =
+        std::make_shared<ControlParametrizationModelBSplineTpl<Scalar> >(
+            model->get_nu(), ncp, degree, Scalar(j) / Scalar(nsteps),
+            Scalar(j + 1) / Scalar(nsteps));
+    steps_[j] = std::make_shared<IntegratedActionModelEulerTpl<Scalar> >(
+        model, window, dt, with_cost_residual);
+  }
+  initSteps();
+}
+
+template <typename Scalar>
+IntegratedActionModelMultiStepTpl<
+    Scalar>::~IntegratedActionModelMultiStepTpl() {}
+
+template <typename Scalar>
+std::shared_ptr<DifferentialActionModelAbstractTpl<Scalar> >
+IntegratedActionModelMultiStepTpl<Scalar>::getDifferential(
+    const std::vector<std::shared_ptr<IntegratedActionModelAbstract> >&
+        steps) {
+  if (steps.empty()) {
+    throw_pretty("Invalid argument: " << "steps should not be empty");
+  }
+  return steps[0]->get_differential();
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::initSteps() {
+  Scalar time_step = Scalar(0.);
+  ng_ = 0;
+  nh_ = 0;
+  nr_ = 0;
+  for (std::size_t j = 0; j < steps_.size(); ++j) {
+    const std::shared_ptr<IntegratedActionModelAbstract>& step = steps_[j];
+    if (step->get_state()->get_nx() != state_->get_nx() ||
+        step->get_state()->get_ndx() != state_->get_ndx()) {
+      throw_pretty("Invalid argument: "
+                   << "the state of step " + std::to_string(j) +
+                          " is not consistent with the first one");
+    }
+    if (step->get_nu() != nu_) {
+      throw_pretty("Invalid argument: "
+                   << "step " + std::to_string(j) +
+                          " has wrong nu (it should be " +
+                          std::to_string(nu_) + ")");
+    }
+    time_step += step->get_dt();
+    ng_ += step->get_ng();
+    nh_ += step->get_nh();
+    nr_ += step->get_nr();
+  }
+  Base::set_dt(time_step);
+  g_lb_.resize(ng_);
+  g_ub_.resize(ng_);
+  std::size_t ig = 0;
+  for (std::size_t j = 0; j < steps_.size(); ++j) {
+    const std::size_t ng = steps_[j]->get_ng();
+    g_lb_.segment(ig, ng) = steps_[j]->get_g_lb();
+    g_ub_.segment(ig, ng) = steps_[j]->get_g_ub();
+    ig += ng;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::calc(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  // The terminal calls might have resized the constraint and residual vectors
+  d->g.resize(ng_);
+  d->h.resize(nh_);
+  d->r.resize(nr_);
+  d->cost = Scalar(0.);
+  std::size_t ig = 0, ih = 0, ir = 0;
+  for (std::size_t j = 0; j < steps_.size(); ++j) {
+    const std::shared_ptr<ActionDataAbstract>& dj = d->steps[j];
+    if (j == 0) {
+      steps_[j]->calc(dj, x, u);
+    } else {
+      steps_[j]->calc(dj, d->steps[j - 1]->xnext, u);
+    }
+    d->cost += dj->cost;
+    const std::size_t ng = steps_[j]->get_ng();
+    const std::size_t nh = steps_[j]->get_nh();
+    const std::size_t nr = steps_[j]->get_nr();
+    d->g.segment(ig, ng) = dj->g.head(ng);
+    d->h.segment(ih, nh) = dj->h.head(nh);
+    if (with_cost_residual_) {
+      d->r.segment(ir, nr) = dj->r;
+    }
+    ig += ng;
+    ih += nh;
+    ir += nr;
+  }
+  d->xnext = d->steps.back()->xnext;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::calc(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  const std::shared_ptr<ActionDataAbstract>& d0 = d->steps[0];
+
+  steps_[0]->calc(d0, x);
+  d->xnext = x;
+  d->cost = d0->cost;
+  d->g = d0->g;
+  d->h = d0->h;
+  if (with_cost_residual_) {
+    d->r = d0->r;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  const std::size_t ndx = state_->get_ndx();
+
+  d->Gx.resize(ng_, ndx);
+  d->Gu.resize(ng_, nu_);
+  d->Hx.resize(nh_, ndx);
+  d->Hu.resize(nh_, nu_);
+  // Jx and Ju are the Jacobians of the state at the beginning of the sub-step
+  // with respect to the state and control of the node
+  d->Jx.setIdentity();
+  d->Ju.setZero();
+  d->Lx.setZero();
+  d->Lu.setZero();
+  d->Lxx.setZero();
+  d->Lxu.setZero();
+  d->Luu.setZero();
+  std::size_t ig = 0, ih = 0;
+  for (std::size_t j = 0; j < steps_.size(); ++j) {
+    const std::shared_ptr<ActionDataAbstract>& dj = d->steps[j];
+    if (j == 0) {
+      steps_[j]->calcDiff(dj, x, u);
+    } else {
+      steps_[j]->calcDiff(dj, d->steps[j - 1]->xnext, u);
+    }
+    // Cost derivatives with the Gauss-Newton approximation
+    d->LxxJx.noalias() = dj->Lxx * d->Jx;
+    d->LxxJu = dj->Lxu;
+    d->LxxJu.noalias() += dj->Lxx * d->Ju;
+    d->Lx.noalias() += d->Jx.transpose() * dj->Lx;
+    d->Lu += dj->Lu;
+    d->Lu.noalias() += d->Ju.transpose() * dj->Lx;
+    d->Lxx.noalias() += d->Jx.transpose() * d->LxxJx;
+    d->Lxu.noalias() += d->Jx.transpose() * d->LxxJu;
+    d->Luu += dj->Luu;
+    d->Luu.noalias() += d->Ju.transpose() * d->LxxJu;
+    d->Luu.noalias() += dj->Lxu.transpose() * d->Ju;
+    // Constraint derivatives
+    const std::size_t ng = steps_[j]->get_ng();
+    const std::size_t nh = steps_[j]->get_nh();
+    d->Gx.middleRows(ig, ng).noalias() = dj->Gx.topRows(ng) * d->Jx;
+    d->Gu.middleRows(ig, ng) = dj->Gu.topRows(ng);
+    d->Gu.middleRows(ig, ng).noalias() += dj->Gx.topRows(ng) * d->Ju;
+    d->Hx.middleRows(ih, nh).noalias() = dj->Hx.topRows(nh) * d->Jx;
+    d->Hu.middleRows(ih, nh) = dj->Hu.topRows(nh);
+    d->Hu.middleRows(ih, nh).noalias() += dj->Hx.topRows(nh) * d->Ju;
+    ig += ng;
+    ih += nh;
+    // Propagate the Jacobians through the sub-step transition
+    d->LxxJx.noalias() = dj->Fx * d->Jx;
+    d->Jx.swap(d->LxxJx);
+    d->LxxJu = dj->Fu;
+    d->LxxJu.noalias() += dj->Fx * d->Ju;
+    d->Ju.swap(d->LxxJu);
+  }
+  d->Fx = d->Jx;
+  d->Fu = d->Ju;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  const std::shared_ptr<ActionDataAbstract>& d0 = d->steps[0];
+
+  steps_[0]->calcDiff(d0, x);
+  d->Fx = d0->Fx;
+  d->Lx = d0->Lx;
+  d->Lxx = d0->Lxx;
+  d->Gx = d0->Gx;
+  d->Hx = d0->Hx;
+}
+
+template <typename Scalar>
+std::shared_ptr<ActionDataAbstractTpl<Scalar> >
+IntegratedActionModelMultiStepTpl<Scalar>::createData() {
+  return std::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+bool IntegratedActionModelMultiStepTpl<Scalar>::checkData(
+    const std::shared_ptr<ActionDataAbstract>& data) {
+  std::shared_ptr<Data> d = std::dynamic_pointer_cast<Data>(data);
+  if (d == NULL || d->steps.size() != steps_.size()) {
+    return false;
+  }
+  for (std::size_t j = 0; j < steps_.size(); ++j) {
+    if (!steps_[j]->checkData(d->steps[j])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::quasiStatic(
+    const std::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+    const Eigen::Ref<const VectorXs>& x, const std::size_t maxiter,
+    const Scalar tol) {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+  // All the sub-steps share the control parameters
+  steps_[0]->quasiStatic(d->steps[0], u, x, maxiter, tol);
+}
+
+template <typename Scalar>
+std::size_t IntegratedActionModelMultiStepTpl<Scalar>::get_ng() const {
+  return ng_;
+}
+
+template <typename Scalar>
+std::size_t IntegratedActionModelMultiStepTpl<Scalar>::get_nh() const {
+  return nh_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::VectorXs&
+IntegratedActionModelMultiStepTpl<Scalar>::get_g_lb() const {
+  return g_lb_;
+}
+
+template <typename Scalar>
+const typename MathBaseTpl<Scalar>::VectorXs&
+IntegratedActionModelMultiStepTpl<Scalar>::get_g_ub() const {
+  return g_ub_;
+}
+
+template <typename Scalar>
+const std::vector<std::shared_ptr<IntegratedActionModelAbstractTpl<Scalar> > >&
+IntegratedActionModelMultiStepTpl<Scalar>::get_steps() const {
+  return steps_;
+}
+
+template <typename Scalar>
+void IntegratedActionModelMultiStepTpl<Scalar>::print(std::ostream& os) const {
+  os << "IntegratedActionModelMultiStep {dt=" << time_step_
+     << ", nsteps=" << steps_.size() << ", " << *differential_ << "}";
+}
+
+}  // namespace crocoddyl
@@ -133,6 +133,31 @@ class IntegratedActionModelRKTpl
   virtual void calcDiff(const std::shared_ptr<ActionDataAbstract>& data,
                         const Eigen::Ref<const VectorXs>& x);
 
+  /**
+   * @brief Integrate the differential action model and compute its partial
+   * derivatives using RK scheme
+   *
+   * Each RK stage is evaluated through the fused
+   * `DifferentialActionModelAbstractTpl::calcAndDiff()` entry point.
+   *
+   * @param[in] data  RK integrator data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x,
+                           const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief Integrate the total cost value and compute its derivatives for
+   * nodes that depends only on the state using RK scheme
+   *
+   * @param[in] data  RK integrator data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   */
+  virtual void calcAndDiff(const std::shared_ptr<ActionDataAbstract>& data,
+                           const Eigen::Ref<const VectorXs>& x);
+
   /**
    * @brief Create the RK integrator data
    *
@@ -169,6 +194,26 @@ class IntegratedActionModelRKTpl
    */
   std::size_t get_ni() const;
 
+  /**
+   * @brief Return the number of threads used to compute the stage derivatives
+   */
+  std::size_t get_nthreads() const;
+
+  /**
+   * @brief Modify the number of threads used to compute the stage derivatives
+   *
+   * The stage points are known after `calc()`, so the derivatives of the
+   * differential model at each stage are independent. With more than one
+   * thread, they are computed concurrently before being chained into the
+   * derivatives of the integrator. It is useful when the horizon has fewer
+   * nodes than cores. Note that the differential model has to support
+   * concurrent calls with different data. By default, it uses one thread.
+   *
+   * @param[in] nthreads  number of threads (if nthreads <= 1, then the stage
+   * derivatives are computed sequentially)
+   */
+  void set_nthreads(const int nthreads);
+
   /**
    * @brief Print relevant information of the RK integrator model
    *
@@ -194,8 +239,42 @@ class IntegratedActionModelRKTpl
    */
   void set_rk_type(const RKType rktype);
 
+  /**
+   * @brief Evaluate the RK stages and integrate the next state and cost
+   *
+   * @param[in] d          RK integrator data
+   * @param[in] x          State point
+   * @param[in] u          Control input
+   * @param[in] with_diff  True if the stage derivatives are computed together
+   * with the stage evaluation
+   */
+  void integrateStages(Data* d, const Eigen::Ref<const VectorXs>& x,
+                       const Eigen::Ref<const VectorXs>& u,
+                       const bool with_diff);
+
+  /**
+   * @brief Chain the stage derivatives into the RK integrator derivatives
+   *
+   * It assumes that the derivatives of every stage are already computed.
+   *
+   * @param[in] d  RK integrator data
+   * @param[in] x  State point
+   */
+  void integrateStageDerivatives(Data* d, const Eigen::Ref<const VectorXs>& x);
+
+  /**
+   * @brief Compute the derivatives of the differential model at every stage
+   *
+   * It assumes that the stage points are already computed, and it runs the
+   * stages concurrently if more than one thread is used.
+   *
+   * @param[in] d  RK integrator data
+   */
+  void calcStageDiffs(Data* d);
+
   std::vector<Scalar> rk_c_;
   std::size_t ni_;
+  std::size_t nthreads_;  //!< Number of threads used for the stage derivatives
 };
 
 template <typename _Scalar>
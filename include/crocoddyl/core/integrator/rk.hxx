@@ -8,6 +8,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#include <omp.h>
+#endif  // CROCODDYL_WITH_MULTITHREADING
 
 #include "crocoddyl/core/utils/exception.hpp"
 
@@ -18,7 +21,7 @@ IntegratedActionModelRKTpl<Scalar>::IntegratedActionModelRKTpl(
     std::shared_ptr<DifferentialActionModelAbstract> model,
     std::shared_ptr<ControlParametrizationModelAbstract> control,
     const RKType rktype, const Scalar time_step, const bool with_cost_residual)
-    : Base(model, control, time_step, with_cost_residual) {
+    : Base(model, control, time_step, with_cost_residual), nthreads_(1) {
   set_rk_type(rktype);
 }
 
@@ -26,7 +29,7 @@ template <typename Scalar>
 IntegratedActionModelRKTpl<Scalar>::IntegratedActionModelRKTpl(
     std::shared_ptr<DifferentialActionModelAbstract> model, const RKType rktype,
     const Scalar time_step, const bool with_cost_residual)
-    : Base(model, time_step, with_cost_residual) {
+    : Base(model, time_step, with_cost_residual), nthreads_(1) {
   set_rk_type(rktype);
 }
 
@@ -47,16 +50,252 @@ void IntegratedActionModelRKTpl<Scalar>::calc(
         "Invalid argument: " << "u has wrong dimension (it should be " +
                                     std::to_string(nu_) + ")");
   }
-  const std::size_t nv = state_->get_nv();
+  Data* d = static_cast<Data*>(data.get());
+
+  integrateStages(d, x, u, false);
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::calc(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
+      d->differential[0];
+  differential_->calc(k0_data, x);
+  d->dx.setZero();
+  d->xnext = x;
+  d->cost = k0_data->cost;
+  d->g = k0_data->g;
+  d->h = k0_data->h;
+  if (with_cost_residual_) {
+    d->r = k0_data->r;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  calcStageDiffs(d);
+  integrateStageDerivatives(d, x);
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::calcDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
+      d->differential[0];
+  differential_->calcDiff(k0_data, x);
+  d->Lx = k0_data->Lx;
+  d->Lxx = k0_data->Lxx;
+  d->Gx = k0_data->Gx;
+  d->Hx = k0_data->Hx;
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  Data* d = static_cast<Data*>(data.get());
+
+  if (nthreads_ > 1) {
+    integrateStages(d, x, u, false);
+    calcStageDiffs(d);
+  } else {
+    integrateStages(d, x, u, true);
+  }
+  integrateStageDerivatives(d, x);
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<ActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
   Data* d = static_cast<Data*>(data.get());
 
+  const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
+      d->differential[0];
+  differential_->calcAndDiff(k0_data, x);
+  d->dx.setZero();
+  d->xnext = x;
+  d->cost = k0_data->cost;
+  d->g = k0_data->g;
+  d->h = k0_data->h;
+  if (with_cost_residual_) {
+    d->r = k0_data->r;
+  }
+  d->Lx = k0_data->Lx;
+  d->Lxx = k0_data->Lxx;
+  d->Gx = k0_data->Gx;
+  d->Hx = k0_data->Hx;
+}
+
+template <typename Scalar>
+std::shared_ptr<ActionDataAbstractTpl<Scalar> >
+IntegratedActionModelRKTpl<Scalar>::createData() {
+  return std::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
+}
+
+template <typename Scalar>
+bool IntegratedActionModelRKTpl<Scalar>::checkData(
+    const std::shared_ptr<ActionDataAbstract>& data) {
+  std::shared_ptr<Data> d = std::dynamic_pointer_cast<Data>(data);
+  if (data != NULL) {
+    for (std::size_t i = 0; i < ni_; ++i) {
+      if (!differential_->checkData(d->differential[i])) {
+        return false;
+      }
+    }
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::quasiStatic(
+    const std::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
+    const Eigen::Ref<const VectorXs>& x, const std::size_t maxiter,
+    const Scalar tol) {
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+
+  Data* d = static_cast<Data*>(data.get());
+  const std::shared_ptr<ControlParametrizationDataAbstract>& u0_data =
+      d->control[0];
+  u0_data->w *= 0.;
+  differential_->quasiStatic(d->differential[0], u0_data->w, x, maxiter, tol);
+  control_->params(u0_data, 0., u0_data->w);
+  u = u0_data->u;
+}
+
+template <typename Scalar>
+std::size_t IntegratedActionModelRKTpl<Scalar>::get_ni() const {
+  return ni_;
+}
+
+template <typename Scalar>
+std::size_t IntegratedActionModelRKTpl<Scalar>::get_nthreads() const {
+  return nthreads_;
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::set_nthreads(const int nthreads) {
+#ifndef CROCODDYL_WITH_MULTITHREADING
+  (void)nthreads;
+  std::cerr << "Warning: the number of threads won't affect the computational "
+               "performance as multithreading "
+               "support is not enabled."
+            << std::endl;
+#else
+  if (nthreads < 1 || !enableMultithreading()) {
+    nthreads_ = 1;
+  } else {
+    nthreads_ = static_cast<std::size_t>(nthreads);
+  }
+#endif
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::print(std::ostream& os) const {
+  os << "IntegratedActionModelRK {dt=" << time_step_ << ", " << *differential_
+     << "}";
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::set_rk_type(const RKType rktype) {
+  switch (rktype) {
+    case two:
+      ni_ = 2;
+      rk_c_.resize(ni_);
+      rk_c_[0] = Scalar(0.);
+      rk_c_[1] = Scalar(0.5);
+      break;
+    case three:
+      ni_ = 3;
+      rk_c_.resize(ni_);
+      rk_c_[0] = Scalar(0.);
+      rk_c_[1] = Scalar(1. / 3.);
+      rk_c_[2] = Scalar(2. / 3.);
+      break;
+    case four:
+      ni_ = 4;
+      rk_c_.resize(ni_);
+      rk_c_[0] = Scalar(0.);
+      rk_c_[1] = Scalar(0.5);
+      rk_c_[2] = Scalar(0.5);
+      rk_c_[3] = Scalar(1.);
+      break;
+  }
+}
+
+template <typename Scalar>
+void IntegratedActionModelRKTpl<Scalar>::integrateStages(
+    Data* d, const Eigen::Ref<const VectorXs>& x,
+    const Eigen::Ref<const VectorXs>& u, const bool with_diff) {
+  const std::size_t nv = state_->get_nv();
+
   const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
       d->differential[0];
   const std::shared_ptr<ControlParametrizationDataAbstract>& u0_data =
       d->control[0];
   control_->calc(u0_data, rk_c_[0], u);
   d->ws[0] = u0_data->w;
-  differential_->calc(k0_data, x, d->ws[0]);
+  if (with_diff) {
+    differential_->calcAndDiff(k0_data, x, d->ws[0]);
+  } else {
+    differential_->calc(k0_data, x, d->ws[0]);
+  }
   d->y[0] = x;
   d->ki[0].head(nv) = d->y[0].tail(nv);
   d->ki[0].tail(nv) = k0_data->xout;
@@ -70,7 +309,11 @@ void IntegratedActionModelRKTpl<Scalar>::calc(
     state_->integrate(x, d->dx_rk[i], d->y[i]);
     control_->calc(ui_data, rk_c_[i], u);
     d->ws[i] = ui_data->w;
-    differential_->calc(ki_data, d->y[i], d->ws[i]);
+    if (with_diff) {
+      differential_->calcAndDiff(ki_data, d->y[i], d->ws[i]);
+    } else {
+      differential_->calc(ki_data, d->y[i], d->ws[i]);
+    }
     d->ki[i].head(nv) = d->y[i].tail(nv);
     d->ki[i].tail(nv) = ki_data->xout;
     d->integral[i] = ki_data->cost;
@@ -100,46 +343,20 @@ void IntegratedActionModelRKTpl<Scalar>::calc(
 }
 
 template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::calc(
-    const std::shared_ptr<ActionDataAbstract>& data,
-    const Eigen::Ref<const VectorXs>& x) {
-  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
-    throw_pretty(
-        "Invalid argument: " << "x has wrong dimension (it should be " +
-                                    std::to_string(state_->get_nx()) + ")");
-  }
-  Data* d = static_cast<Data*>(data.get());
-
-  const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
-      d->differential[0];
-  differential_->calc(k0_data, x);
-  d->dx.setZero();
-  d->xnext = x;
-  d->cost = k0_data->cost;
-  d->g = k0_data->g;
-  d->h = k0_data->h;
-  if (with_cost_residual_) {
-    d->r = k0_data->r;
+void IntegratedActionModelRKTpl<Scalar>::calcStageDiffs(Data* d) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(nthreads_) if (nthreads_ > 1)
+#endif
+  for (std::size_t i = 0; i < ni_; ++i) {
+    differential_->calcDiff(d->differential[i], d->y[i], d->ws[i]);
   }
 }
 
 template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::calcDiff(
-    const std::shared_ptr<ActionDataAbstract>& data,
-    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
-  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
-    throw_pretty(
-        "Invalid argument: " << "x has wrong dimension (it should be " +
-                                    std::to_string(state_->get_nx()) + ")");
-  }
-  if (static_cast<std::size_t>(u.size()) != nu_) {
-    throw_pretty(
-        "Invalid argument: " << "u has wrong dimension (it should be " +
-                                    std::to_string(nu_) + ")");
-  }
+void IntegratedActionModelRKTpl<Scalar>::integrateStageDerivatives(
+    Data* d, const Eigen::Ref<const VectorXs>& x) {
   const std::size_t nv = state_->get_nv();
   const std::size_t nu = control_->get_nu();
-  Data* d = static_cast<Data*>(data.get());
   assert_pretty(
       MatrixXs(d->dyi_dx[0])
           .isApprox(MatrixXs::Identity(state_->get_ndx(), state_->get_ndx())),
@@ -150,10 +367,6 @@ void IntegratedActionModelRKTpl<Scalar>::calcDiff(
           .isApprox(MatrixXs::Identity(nv, nv)),
       "you have changed dki_dx[0] values that supposed to be constant.");
 
-  for (std::size_t i = 0; i < ni_; ++i) {
-    differential_->calcDiff(d->differential[i], d->y[i], d->ws[i]);
-  }
-
   const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
       d->differential[0];
   const std::shared_ptr<ControlParametrizationDataAbstract>& u0_data =
@@ -317,109 +530,4 @@ void IntegratedActionModelRKTpl<Scalar>::calcDiff(
   state_->JintegrateTransport(x, d->dx, d->Fu, second);
 }
 
-template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::calcDiff(
-    const std::shared_ptr<ActionDataAbstract>& data,
-    const Eigen::Ref<const VectorXs>& x) {
-  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
-    throw_pretty(
-        "Invalid argument: " << "x has wrong dimension (it should be " +
-                                    std::to_string(state_->get_nx()) + ")");
-  }
-  Data* d = static_cast<Data*>(data.get());
-
-  const std::shared_ptr<DifferentialActionDataAbstract>& k0_data =
-      d->differential[0];
-  differential_->calcDiff(k0_data, x);
-  d->Lx = k0_data->Lx;
-  d->Lxx = k0_data->Lxx;
-  d->Gx = k0_data->Gx;
-  d->Hx = k0_data->Hx;
-}
-
-template <typename Scalar>
-std::shared_ptr<ActionDataAbstractTpl<Scalar> >
-IntegratedActionModelRKTpl<Scalar>::createData() {
-  return std::allocate_shared<Data>(Eigen::aligned_allocator<Data>(), this);
-}
-
-template <typename Scalar>
-bool IntegratedActionModelRKTpl<Scalar>::checkData(
-    const std::shared_ptr<ActionDataAbstract>& data) {
-  std::shared_ptr<Data> d = std::dynamic_pointer_cast<Data>(data);
-  if (data != NULL) {
-    for (std::size_t i = 0; i < ni_; ++i) {
-      if (!differential_->checkData(d->differential[i])) {
-        return false;
-      }
-    }
-    return true;
-  } else {
-    return false;
-  }
-}
-
-template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::quasiStatic(
-    const std::shared_ptr<ActionDataAbstract>& data, Eigen::Ref<VectorXs> u,
-    const Eigen::Ref<const VectorXs>& x, const std::size_t maxiter,
-    const Scalar tol) {
-  if (static_cast<std::size_t>(u.size()) != nu_) {
-    throw_pretty(
-        "Invalid argument: " << "u has wrong dimension (it should be " +
-                                    std::to_string(nu_) + ")");
-  }
-  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
-    throw_pretty(
-        "Invalid argument: " << "x has wrong dimension (it should be " +
-                                    std::to_string(state_->get_nx()) + ")");
-  }
-
-  Data* d = static_cast<Data*>(data.get());
-  const std::shared_ptr<ControlParametrizationDataAbstract>& u0_data =
-      d->control[0];
-  u0_data->w *= 0.;
-  differential_->quasiStatic(d->differential[0], u0_data->w, x, maxiter, tol);
-  control_->params(u0_data, 0., u0_data->w);
-  u = u0_data->u;
-}
-
-template <typename Scalar>
-std::size_t IntegratedActionModelRKTpl<Scalar>::get_ni() const {
-  return ni_;
-}
-
-template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::print(std::ostream& os) const {
-  os << "IntegratedActionModelRK {dt=" << time_step_ << ", " << *differential_
-     << "}";
-}
-
-template <typename Scalar>
-void IntegratedActionModelRKTpl<Scalar>::set_rk_type(const RKType rktype) {
-  switch (rktype) {
-    case two:
-      ni_ = 2;
-      rk_c_.resize(ni_);
-      rk_c_[0] = Scalar(0.);
-      rk_c_[1] = Scalar(0.5);
-      break;
-    case three:
-      ni_ = 3;
-      rk_c_.resize(ni_);
-      rk_c_[0] = Scalar(0.);
-      rk_c_[1] = Scalar(1. / 3.);
-      rk_c_[2] = Scalar(2. / 3.);
-      break;
-    case four:
-      ni_ = 4;
-      rk_c_.resize(ni_);
-      rk_c_[0] = Scalar(0.);
-      rk_c_[1] = Scalar(0.5);
-      rk_c_[2] = Scalar(0.5);
-      rk_c_[3] = Scalar(1.);
-      break;
-  }
-}
-
 }  // namespace crocoddyl
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_MPC_HORIZON_HPP_
+#define CROCODDYL_CORE_MPC_HORIZON_HPP_
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "crocoddyl/core/fwd.hpp"
+#include "crocoddyl/core/mathbase.hpp"
+#include "crocoddyl/core/optctrl/shooting.hpp"
+
+namespace crocoddyl {
+
+enum HorizonIntegrator {
+  HorizonEuler = 0,
+  HorizonRK2,
+  HorizonRK3,
+  HorizonRK4,
+  HorizonImplicitEuler,
+  HorizonSemiImplicitEuler
+};
+
+/**
+ * @brief Builder of non-uniform, multi-rate MPC horizons
+ *
+ * It describes the horizon as a sequence of segments, each one with its own
+ * time step and integrator, and it builds the corresponding
+ * `ShootingProblem`. This allows fine nodes near the initial time and
+ * progressively coarser nodes (with larger time steps or higher-order
+ * integrators) further out. For instance, a preview of 1.5 s requires 150
+ * uniform nodes of 10 ms, while a graded grid covers it with about 50 nodes.
+ *
+ * Consecutive nodes with the same time step and integrator share the same
+ * integrated action model. Since the grid is anchored to the initial time, the
+ * problem is not shifted between MPC solves. Instead, the previous solution is
+ * interpolated in time with `interpolateTrajectory()` (see
+ * `MPCRuntime::set_warmStart()`).
+ *
+ * \sa `addUniformSegment()`, `addGradedSegment()`, `build()`
+ */
+class HorizonBuilder {
+ public:
+  /**
+   * @brief Initialize the horizon builder
+   *
+   * @param[in] running   Differential action model of the running nodes
+   * @param[in] terminal  Differential action model of the terminal node
+   */
+  HorizonBuilder(std::shared_ptr<DifferentialActionModelAbstract> running,
+                 std::shared_ptr<DifferentialActionModelAbstract> terminal);
+  ~HorizonBuilder();
+
+  /**
+   * @brief Append a segment of nodes with a constant time step
+   *
+   * @param[in] nnodes      Number of nodes
+   * @param[in] dt          Time step of the nodes
+   * @param[in] integrator  Integrator of the nodes (default HorizonEuler)
+   */
+  void addUniformSegment(const std::size_t nnodes, const double dt,
+                         const HorizonIntegrator integrator = HorizonEuler);
+
+  /**
+   * @brief Append a segment of nodes with geometrically growing time steps
+   *
+   * The time step of the \f$k\f$-th node of the segment is
+   * \f$\min(\Delta t_0 r^k, \Delta t_{max})\f$. The nodes are appended until
+   * they cover the given duration, and then their time steps are scaled to
+   * match it exactly.
+   *
+   * @param[in] duration    Duration covered by the segment
+   * @param[in] dt0         Time step of the first node
+   * @param[in] ratio       Growth ratio of the time steps (greater or equal
+   * to 1)
+   * @param[in] integrator  Integrator of the nodes (default HorizonEuler)
+   * @param[in] dt_max      Maximum time step (default infinity)
+   */
+  void addGradedSegment(
+      const double duration, const double dt0, const double ratio,
+      const HorizonIntegrator integrator = HorizonEuler,
+      const double dt_max = std::numeric_limits<double>::infinity());
+
+  /**
+   * @brief Remove all the nodes
+   */
+  void clear();
+
+  /**
+   * @brief Build the shooting problem of the horizon
+   *
+   * @param[in] x0  Initial state
+   * @return the shooting problem
+   */
+  std::shared_ptr<ShootingProblem> build(const Eigen::VectorXd& x0) const;
+
+  /**
+   * @brief Return the differential action model of the running nodes
+   */
+  const std::shared_ptr<DifferentialActionModelAbstract>& get_running() const;
+
+  /**
+   * @brief Return the differential action model of the terminal node
+   */
+  const std::shared_ptr<DifferentialActionModelAbstract>& get_terminal() const;
+
+  /**
+   * @brief Return the number of running nodes
+   */
+  std::size_t get_T() const;
+
+  /**
+   * @brief Return the duration of the horizon
+   */
+  double get_duration() const;
+
+  /**
+   * @brief Return the time steps of the running nodes
+   */
+  const std::vector<double>& get_dts() const;
+
+  /**
+   * @brief Return the integrators of the running nodes
+   */
+  const std::vector<HorizonIntegrator>& get_integrators() const;
+
+  /**
+   * @brief Return the time of the nodes relative to the initial one (size
+   * T+1)
+   */
+  const std::vector<double>& get_ts() const;
+
+ private:
+  /**
+   * @brief Create the integrated action model of a running node
+   */
+  std::shared_ptr<ActionModelAbstract> createModel(
+      const double dt, const HorizonIntegrator integrator) const;
+
+  std::shared_ptr<DifferentialActionModelAbstract> running_;
+  std::shared_ptr<DifferentialActionModelAbstract> terminal_;
+  std::vector<double> dts_;                     //!< Node time steps
+  std::vector<HorizonIntegrator> integrators_;  //!< Node integrators
+  std::vector<double> ts_;                      //!< Node times
+};
+
+/**
+ * @brief Interpolate a trajectory on a new time grid
+ *
+ * The states are interpolated along the geodesic between consecutive nodes,
+ * i.e., \f$\mathbf{x}_k\oplus\alpha(\mathbf{x}_{k+1}\ominus\mathbf{x}_k)\f$.
+ * The controls are piecewise constant in each interval, so the control of a
+ * new interval is the time average of the previous controls over it. Thus, a
+ * coarse interval receives the mean of the fine controls it spans. Times
+ * outside of the previous grid are clamped, and only the previous controls
+ * with the same dimension are averaged.
+ *
+ * @param[in]  state   State model
+ * @param[in]  ts      Time of the previous nodes (size T+1)
+ * @param[in]  xs      Previous state trajectory (size T+1)
+ * @param[in]  us      Previous control trajectory (size T)
+ * @param[in]  ts_new  Time of the new nodes (size N+1)
+ * @param[out] xs_new  New state trajectory (size N+1)
+ * @param[out] us_new  New control trajectory (size N). Its vectors have to be
+ * allocated with the dimension of each control.
+ */
+void interpolateTrajectory(const std::shared_ptr<StateAbstract>& state,
+                           const std::vector<double>& ts,
+                           const std::vector<Eigen::VectorXd>& xs,
+                           const std::vector<Eigen::VectorXd>& us,
+                           const std::vector<double>& ts_new,
+                           std::vector<Eigen::VectorXd>& xs_new,
+                           std::vector<Eigen::VectorXd>& us_new);
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_MPC_HORIZON_HPP_
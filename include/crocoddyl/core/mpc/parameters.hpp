@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_MPC_PARAMETERS_HPP_
+#define CROCODDYL_CORE_MPC_PARAMETERS_HPP_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "crocoddyl/core/mathbase.hpp"
+#include "crocoddyl/core/optctrl/shooting.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Conversion between a parameter vector and a residual reference
+ *
+ * The default implementation supports Eigen references, whose parameter
+ * vector contains their coefficients in column-major order. Other reference
+ * types specialize this structure (e.g., see
+ * `crocoddyl/multibody/utils/parameters.hpp` for the spatial types).
+ */
+template <class Reference, class Enable = void>
+struct ParameterReference {
+  /**
+   * @brief Return the dimension of the parameter vector of a reference
+   */
+  static std::size_t size(const Reference& reference) {
+    return static_cast<std::size_t>(reference.size());
+  }
+
+  /**
+   * @brief Write a parameter vector into a reference
+   */
+  static void assign(const Eigen::Ref<const Eigen::VectorXd>& value,
+                     Reference& reference) {
+    reference = Eigen::Map<const Reference>(value.data(), reference.rows(),
+                                            reference.cols());
+  }
+};
+
+/**
+ * @brief Named parameters of a shooting problem
+ *
+ * It stores the values of a set of named parameters, e.g., the references of
+ * the tracking costs, for each node of a shooting problem. The parameters are
+ * registered once with `addParameter()`, and each one occupies a fixed range
+ * of columns of a contiguous \f$(T+1)\times n_p\f$ row-major table, i.e., a
+ * row per node. Then, the parameters are bound to the models of the nodes:
+ *  - `bindReference()` binds a parameter to the reference of a residual
+ * model,
+ *  - `bindEnvironment()` binds the whole row of a node to the environment
+ * vector of a code-generated action model, and
+ *  - `bind()` binds a parameter to a user-defined function.
+ *
+ * The targets of the bindings are resolved once, when they are created.
+ * Later, the values of a parameter over the whole horizon are modified in a
+ * single call of `set()`, and `update()` writes the modified nodes into their
+ * models without allocating memory. Since the row of a node has the same
+ * layout as the environment vector of code-generated models, they share the
+ * parameters with the other models of the horizon.
+ *
+ * Note that nodes that share the same residual model also share its
+ * reference, so the nodes bound to a parameter need their own residual
+ * models. Instead, the environment vectors are stored in the node's data.
+ *
+ * \sa `addParameter()`, `set()`, `update()`
+ */
+class ProblemParameters {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+  typedef std::function<void(const std::shared_ptr<ShootingProblem>&,
+                             const std::size_t,
+                             const Eigen::Ref<const Eigen::VectorXd>&)>
+      Binding;
+
+  /**
+   * @brief Initialize the parameters of a shooting problem
+   *
+   * @param[in] problem  shooting problem
+   */
+  explicit ProblemParameters(std::shared_ptr<ShootingProblem> problem);
+  ~ProblemParameters();
+
+  /**
+   * @brief Register a parameter
+   *
+   * The parameter is appended to the columns of the table, and it is
+   * initialized with the given value in all the nodes.
+   *
+   * @param[in] name   Name of the parameter
+   * @param[in] value  Initial value of the parameter
+   * @return the index of the first column of the parameter
+   */
+  std::size_t addParameter(const std::string& name,
+                           const Eigen::Ref<const Eigen::VectorXd>& value);
+
+  /**
+   * @brief Bind a parameter of a node to a function
+   *
+   * The function receives the problem, the index of the node and the value of
+   * the parameter, and it is called by `update()` when the value has changed.
+   *
+   * @param[in] name     Name of the parameter
+   * @param[in] t        Index of the node \f$(0\leq t \leq T)\f$
+   * @param[in] binding  Function that writes the value into the node
+   */
+  void bind(const std::string& name, const std::size_t t, Binding binding);
+
+  /**
+   * @brief Bind a parameter of a node to the reference of a residual model
+   *
+   * The residual model needs to provide `get_reference()` and
+   * `set_reference()`, and the conversion of its reference type is defined by
+   * `ParameterReference`. The reference is written through a buffer allocated
+   * here, so `update()` does not allocate memory.
+   *
+   * @param[in] name      Name of the parameter
+   * @param[in] t         Index of the node \f$(0\leq t \leq T)\f$
+   * @param[in] residual  Residual model of the node
+   */
+  template <class Residual>
+  void bindReference(const std::string& name, const std::size_t t,
+                     std::shared_ptr<Residual> residual) {
+    typedef typename std::decay<decltype(residual->get_reference())>::type
+        Reference;
+    if (!residual) {
+      throw_pretty("Invalid argument: " << "residual is null");
+    }
+    const std::size_t dim = get_dim(name);
+    std::shared_ptr<Reference> reference =
+        std::allocate_shared<Reference>(Eigen::aligned_allocator<Reference>(),
+                                        residual->get_reference());
+    if (ParameterReference<Reference>::size(*reference) != dim) {
+      throw_pretty("Invalid argument: "
+                   << "the residual reference has dimension " +
+                          std::to_string(ParameterReference<Reference>::size(
+                              *reference)) +
+                          " (it should be " + std::to_string(dim) + ")");
+    }
+    bind(name, t,
+         [residual, reference](const std::shared_ptr<ShootingProblem>&,
+                               const std::size_t,
+                               const Eigen::Ref<const Eigen::VectorXd>& value) {
+           ParameterReference<Reference>::assign(value, *reference);
+           residual->set_reference(*reference);
+         });
+  }
+
+  /**
+   * @brief Bind the row of a node to the environment vector of a
+   * code-generated action model
+   *
+   * The environment vector of the model has the layout of the rows of the
+   * table, i.e., its dimension is the number of columns, and it is written
+   * into the node's data with `Model::set_env()`.
+   *
+   * @param[in] t      Index of the node \f$(0\leq t \leq T)\f$
+   * @param[in] model  Code-generated action model of the node
+   */
+  template <class Model>
+  void bindEnvironment(const std::size_t t, std::shared_ptr<Model> model) {
+    if (!model) {
+      throw_pretty("Invalid argument: " << "model is null");
+    }
+    if (model->get_nenv() != get_nparams()) {
+      throw_pretty("Invalid argument: "
+                   << "the model has " + std::to_string(model->get_nenv()) +
+                          " environment variables (it should be " +
+                          std::to_string(get_nparams()) + ")");
+    }
+    bindNode(t, [model](const std::shared_ptr<ShootingProblem>& problem,
+                        const std::size_t k,
+                        const Eigen::Ref<const Eigen::VectorXd>& value) {
+      model->set_env(k < problem->get_T() ? problem->get_runningDatas()[k]
+                                          : problem->get_terminalData(),
+                     value);
+    });
+  }
+
+  /**
+   * @brief Modify the value of a parameter in all the nodes
+   *
+   * @param[in] name    Name of the parameter
+   * @param[in] values  Values of the parameter, one node per row
+   * (\f$(T+1)\times n\f$), or a single value for all the nodes
+   * (\f$1\times n\f$)
+   */
+  void set(const std::string& name,
+           const Eigen::Ref<const MatrixXdRowMajor>& values);
+
+  /**
+   * @brief Modify the value of a parameter in a node
+   *
+   * @param[in] name   Name of the parameter
+   * @param[in] t      Index of the node \f$(0\leq t \leq T)\f$
+   * @param[in] value  Value of the parameter
+   */
+  void set(const std::string& name, const std::size_t t,
+           const Eigen::Ref<const Eigen::VectorXd>& value);
+
+  /**
+   * @brief Modify the values of all the parameters
+   *
+   * @param[in] values  Table of values (\f$(T+1)\times n_p\f$)
+   */
+  void set_values(const Eigen::Ref<const MatrixXdRowMajor>& values);
+
+  /**
+   * @brief Modify the values of all the parameters in a node
+   *
+   * @param[in] t      Index of the node \f$(0\leq t \leq T)\f$
+   * @param[in] value  Row of values (\f$n_p\f$)
+   */
+  void set_values(const std::size_t t,
+                  const Eigen::Ref<const Eigen::VectorXd>& value);
+
+  /**
+   * @brief Write the modified values into the models of the nodes
+   *
+   * Only the bindings of the nodes whose values have changed since the
+   * previous update are called.
+   */
+  void update();
+
+  /**
+   * @brief Write the values of all the nodes into their models
+   */
+  void updateAll();
+
+  /**
+   * @brief Return the values of a parameter, one node per row
+   */
+  Eigen::Block<const MatrixXdRowMajor> get(const std::string& name) const;
+
+  /**
+   * @brief Return the table of values
+   */
+  const MatrixXdRowMajor& get_values() const;
+
+  /**
+   * @brief Return the names of the parameters in their column order
+   */
+  const std::vector<std::string>& get_names() const;
+
+  /**
+   * @brief Return the index of the first column of a parameter
+   */
+  std::size_t get_offset(const std::string& name) const;
+
+  /**
+   * @brief Return the dimension of a parameter
+   */
+  std::size_t get_dim(const std::string& name) const;
+
+  /**
+   * @brief Return the number of columns, i.e., the total dimension of the
+   * parameters
+   */
+  std::size_t get_nparams() const;
+
+  /**
+   * @brief Return the number of bindings
+   */
+  std::size_t get_nbindings() const;
+
+  /**
+   * @brief Return the shooting problem
+   */
+  const std::shared_ptr<ShootingProblem>& get_problem() const;
+
+ private:
+  /**
+   * @brief Binding of a range of columns of a node
+   */
+  struct NodeBinding {
+    std::size_t offset;  //!< Index of the first column
+    std::size_t dim;     //!< Number of columns (zero for the whole row)
+    Binding binding;     //!< Function that writes the value into the node
+  };
+
+  /**
+   * @brief Bind the whole row of a node to a function
+   */
+  void bindNode(const std::size_t t, Binding binding);
+
+  /**
+   * @brief Return the index of a parameter
+   */
+  std::size_t find(const std::string& name) const;
+
+  /**
+   * @brief Check the index of a node
+   */
+  void checkNode(const std::size_t t) const;
+
+  std::shared_ptr<ShootingProblem> problem_;  //!< Shooting problem
+  std::vector<std::string> names_;            //!< Names of the parameters
+  std::vector<std::size_t> offsets_;  //!< First columns of the parameters
+  std::vector<std::size_t> dims_;     //!< Dimensions of the parameters
+  std::map<std::string, std::size_t> index_;  //!< Indexes of the parameters
+  MatrixXdRowMajor values_;                   //!< Table of values
+  std::vector<std::vector<NodeBinding> > bindings_;  //!< Bindings per node
+  std::vector<bool> changed_;  //!< Nodes modified since the last update
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_MPC_PARAMETERS_HPP_
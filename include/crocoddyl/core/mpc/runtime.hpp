@@ -0,0 +1,344 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_MPC_RUNTIME_HPP_
+#define CROCODDYL_CORE_MPC_RUNTIME_HPP_
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "crocoddyl/core/mathbase.hpp"
+#include "crocoddyl/core/mpc/horizon.hpp"
+#include "crocoddyl/core/solver-base.hpp"
+#include "crocoddyl/core/utils/triple-buffer.hpp"
+
+namespace crocoddyl {
+
+class SolverDDP;
+
+/**
+ * @brief Warm-start strategy between consecutive MPC solves
+ *
+ * `ShiftNodes` shifts the horizon by the number of elapsed nodes, which suits
+ * uniform grids. `InterpolateTime` keeps the problem anchored to the initial
+ * time and interpolates the previous solution at the new node times, which
+ * suits non-uniform grids (see `HorizonBuilder`).
+ */
+enum MPCWarmStart { ShiftNodes = 0, InterpolateTime };
+
+/**
+ * @brief Local policy computed by a MPC solve
+ *
+ * It stores the state and control trajectories, the feedback gains and the
+ * time stamps of the nodes of the horizon. The control applied at time
+ * \f$t\in[t_k,t_{k+1})\f$ is
+ * \f{equation}
+ *   \mathbf{u} = \bar{\mathbf{u}}(t) - \mathbf{K}_k(\mathbf{x}\ominus
+ * \bar{\mathbf{x}}(t)),
+ * \f}
+ * where \f$\bar{\mathbf{x}}(t)\f$ and \f$\bar{\mathbf{u}}(t)\f$ are linearly
+ * interpolated between the nodes \f$k\f$ and \f$k+1\f$.
+ */
+struct MPCPolicy {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+
+  MPCPolicy() : t0(0.), cost(0.), iter(0), id(0) {}
+
+  double t0;                        //!< Time of the initial state
+  std::vector<double> ts;           //!< Time stamps of the nodes (size T+1)
+  std::vector<Eigen::VectorXd> xs;  //!< State trajectory (size T+1)
+  std::vector<Eigen::VectorXd> us;  //!< Control trajectory (size T)
+  std::vector<MatrixXdRowMajor> K;  //!< Feedback gains (size T)
+  double cost;                      //!< Total cost of the solution
+  std::size_t iter;                 //!< Number of solver iterations
+  std::size_t id;                   //!< Index of the solve that produced it
+};
+
+/**
+ * @brief Receding-horizon MPC runtime
+ *
+ * It runs a solver on a dedicated thread and exchanges data with a
+ * high-rate control thread without locks. The control thread feeds the
+ * measured state with `setState()` and computes the control with
+ * `computeControl()`. The solver thread repeatedly takes the latest state,
+ * shifts the horizon by the number of nodes elapsed since the previous solve,
+ * warm-starts the solver with the shifted solution and publishes the new
+ * policy. The state and the policy are handed over through `TripleBuffer`s.
+ * Therefore, the control thread never waits for the solver and no memory is
+ * allocated once the dimensions of the problem are fixed.
+ *
+ * The horizon is shifted in place with `SolverAbstract::shift()`, so the
+ * solver keeps its previous solution and feedback gains. The appended nodes are
+ * initialized according to the shift policy (see `set_shiftPolicy()`). A
+ * problem-update callback can be registered with `set_problemUpdate()`. It
+ * runs on the solver thread after the shift and before each solve, and it is
+ * the place where the user updates the references or the appended nodes, e.g.,
+ * with `ShootingProblem::updateModel()`.
+ *
+ * For non-uniform horizons, the warm-start strategy can be set to
+ * `InterpolateTime` with `set_warmStart()`. Then, the horizon is not shifted
+ * and the previous solution is interpolated at the new node times with
+ * `interpolateTrajectory()`.
+ *
+ * The feedback gains are published only for solvers derived from `SolverDDP`.
+ * For other solvers, the policy is applied in open loop.
+ *
+ * \sa `start()`, `stop()`, `step()`, `setState()`, `computeControl()`
+ */
+class MPCRuntime {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  typedef MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+  typedef std::function<void(const std::shared_ptr<ShootingProblem>&,
+                             const std::size_t, const double)>
+      ProblemUpdate;
+
+  /**
+   * @brief Initialize the MPC runtime
+   *
+   * @param[in] solver   Solver used to compute the policy
+   * @param[in] dt       Duration of the nodes whose action model is not an
+   * integrated one
+   * @param[in] maxiter  Maximum number of solver iterations per solve
+   * (default 1)
+   */
+  MPCRuntime(std::shared_ptr<SolverAbstract> solver, const double dt,
+             const std::size_t maxiter = 1);
+  ~MPCRuntime();
+
+  /**
+   * @brief Start the solver thread
+   */
+  void start();
+
+  /**
+   * @brief Stop the solver thread
+   *
+   * If the solver thread failed, it rethrows its exception.
+   */
+  void stop();
+
+  /**
+   * @brief Run a single MPC cycle in the calling thread
+   *
+   * It takes the latest state, shifts the horizon, solves the problem and
+   * publishes the new policy. This function is called by the solver thread,
+   * and it must not be called while the runtime is running.
+   *
+   * @return true if a new state was available and a policy was published
+   */
+  bool step();
+
+  /**
+   * @brief Feed the measured state
+   *
+   * This function is lock-free and it is called by the control thread.
+   *
+   * @param[in] x  Measured state \f$\mathbf{x}\in\mathbb{R}^{nx}\f$
+   * @param[in] t  Time of the measurement
+   */
+  void setState(const Eigen::Ref<const Eigen::VectorXd>& x, const double t);
+
+  /**
+   * @brief Compute the control from the latest policy
+   *
+   * It interpolates the policy at time \f$t\f$ and applies the feedback gains.
+   * This function is lock-free and it is called by the control thread.
+   *
+   * @param[in]  t  Current time
+   * @param[in]  x  Current state \f$\mathbf{x}\in\mathbb{R}^{nx}\f$
+   * @param[out] u  Control command \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   * @return false if no policy has been published yet
+   */
+  bool computeControl(const double t,
+                      const Eigen::Ref<const Eigen::VectorXd>& x,
+                      Eigen::Ref<Eigen::VectorXd> u);
+
+  /**
+   * @brief Compute the reference state and control from the latest policy
+   *
+   * This function is lock-free and it is called by the control thread.
+   *
+   * @param[in]  t     Current time
+   * @param[out] xref  Reference state \f$\bar{\mathbf{x}}(t)\f$
+   * @param[out] uref  Reference control \f$\bar{\mathbf{u}}(t)\f$
+   * @return false if no policy has been published yet
+   */
+  bool computeReference(const double t, Eigen::Ref<Eigen::VectorXd> xref,
+                        Eigen::Ref<Eigen::VectorXd> uref);
+
+  /**
+   * @brief Return the solver
+   */
+  const std::shared_ptr<SolverAbstract>& get_solver() const;
+
+  /**
+   * @brief Return the latest policy fetched by the control thread
+   */
+  const MPCPolicy& get_policy() const;
+
+  /**
+   * @brief Return the default duration of the nodes
+   */
+  double get_dt() const;
+
+  /**
+   * @brief Return the maximum number of solver iterations per solve
+   */
+  std::size_t get_maxiter() const;
+
+  /**
+   * @brief Return the number of published policies
+   */
+  std::size_t get_nsolves() const;
+
+  /**
+   * @brief Return the sleep time of the solver thread when no new state is
+   * available
+   */
+  double get_idle_time() const;
+
+  /**
+   * @brief Return the initialization policy of the appended nodes
+   */
+  ShiftPolicy get_shiftPolicy() const;
+
+  /**
+   * @brief Return the warm-start strategy between consecutive solves
+   */
+  MPCWarmStart get_warmStart() const;
+
+  /**
+   * @brief Return true if the solver thread is running
+   */
+  bool is_running() const;
+
+  /**
+   * @brief Modify the default duration of the nodes
+   */
+  void set_dt(const double dt);
+
+  /**
+   * @brief Modify the maximum number of solver iterations per solve
+   */
+  void set_maxiter(const std::size_t maxiter);
+
+  /**
+   * @brief Modify the sleep time of the solver thread when no new state is
+   * available
+   */
+  void set_idle_time(const double idle_time);
+
+  /**
+   * @brief Modify the initialization policy of the appended nodes
+   */
+  void set_shiftPolicy(const ShiftPolicy policy);
+
+  /**
+   * @brief Modify the warm-start strategy between consecutive solves
+   */
+  void set_warmStart(const MPCWarmStart warmstart);
+
+  /**
+   * @brief Modify the callback that updates the problem before each solve
+   *
+   * The callback receives the problem, the number of nodes the horizon has
+   * been shifted, and the time of the initial state. The shifted nodes are the
+   * last ones of the horizon. With the `InterpolateTime` warm start, the
+   * horizon is never shifted.
+   */
+  void set_problemUpdate(const ProblemUpdate& update);
+
+ protected:
+  /**
+   * @brief Allocate the buffers for the current problem dimensions
+   */
+  void allocateData();
+
+  /**
+   * @brief Compute the node time stamps of the current problem
+   *
+   * The time stamps are stored in `ts_ws_`.
+   *
+   * @param[in]  t0  Time of the initial state
+   */
+  void computeTimeGrid(const double t0);
+
+  /**
+   * @brief Locate the policy interval that contains the time \f$t\f$
+   *
+   * @param[in]  policy  Policy
+   * @param[in]  t       Time
+   * @param[out] alpha   Interpolation ratio inside the interval
+   * @return the node index
+   */
+  std::size_t locate(const MPCPolicy& policy, const double t,
+                     double& alpha) const;
+
+  /**
+   * @brief Interpolate the reference state and control of a policy
+   *
+   * The reference state is stored in `xref_`.
+   *
+   * @param[in]  policy  Policy
+   * @param[in]  k       Node index
+   * @param[in]  alpha   Interpolation ratio
+   * @param[out] uref    Reference control
+   */
+  void interpolate(const MPCPolicy& policy, const std::size_t k,
+                   const double alpha, Eigen::Ref<Eigen::VectorXd> uref);
+
+  /**
+   * @brief Loop of the solver thread
+   */
+  void run();
+
+  struct StateSample {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    Eigen::VectorXd x;
+    double t;
+  };
+
+  std::shared_ptr<SolverAbstract> solver_;  //!< Solver
+  SolverDDP* ddp_;                          //!< DDP solver (or nullptr)
+  std::shared_ptr<StateAbstract> state_;    //!< State model
+  double dt_;                               //!< Default node duration
+  std::size_t maxiter_;                     //!< Maximum iterations per solve
+  double idle_time_;                        //!< Idle sleep time
+  ShiftPolicy shift_policy_;                //!< Appended-node policy
+  MPCWarmStart warmstart_;                  //!< Warm-start strategy
+  ProblemUpdate update_;                    //!< Problem-update callback
+
+  TripleBuffer<StateSample> state_buffer_;  //!< State handoff
+  TripleBuffer<MPCPolicy> policy_buffer_;   //!< Policy handoff
+  std::atomic<std::size_t> nsolves_;        //!< Number of published policies
+  std::atomic<bool> running_;               //!< Running flag
+  std::thread thread_;                      //!< Solver thread
+  std::exception_ptr error_;                //!< Solver thread failure
+
+  bool has_policy_;                     //!< Policy received flag
+  bool has_solved_;                     //!< Solver run flag
+  std::vector<double> ts_;              //!< Node time stamps
+  std::vector<double> ts_ws_;           //!< Warm-start time stamps
+  std::vector<Eigen::VectorXd> xs_ws_;  //!< State warm start
+  std::vector<Eigen::VectorXd> us_ws_;  //!< Control warm start
+  Eigen::VectorXd dx_;                  //!< State difference (control thread)
+  Eigen::VectorXd xref_;                //!< Reference state (control thread)
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_MPC_RUNTIME_HPP_
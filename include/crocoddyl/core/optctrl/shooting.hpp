@@ -109,6 +109,23 @@ class ShootingProblemTpl {
   Scalar calcDiff(const std::vector<VectorXs>& xs,
                   const std::vector<VectorXs>& us);
 
+  /**
+   * @brief Compute the cost and the next states, and the derivatives of all
+   * action models in a single pass
+   *
+   * It is equivalent to call `calc()` followed by `calcDiff()`, but each node
+   * is visited once through `ActionModelAbstractTpl::calcAndDiff()`. This lets
+   * action models share the computations needed by both stages.
+   *
+   * @param[in] xs  time-discrete state trajectory \f$\mathbf{x_{s}}\f$ (size
+   * \f$T+1\f$)
+   * @param[in] us  time-discrete control sequence \f$\mathbf{u_{s}}\f$ (size
+   * \f$T\f$)
+   * @return The total cost value \f$l_{k}\f$
+   */
+  Scalar calcAndDiff(const std::vector<VectorXs>& xs,
+                     const std::vector<VectorXs>& us);
+
   /**
    * @brief Integrate the dynamics given a control sequence
    *
@@ -129,6 +146,41 @@ class ShootingProblemTpl {
    */
   std::vector<VectorXs> rollout_us(const std::vector<VectorXs>& us);
 
+  /**
+   * @brief Integrate the dynamics of a batch of control sequences and initial
+   * states
+   *
+   * It simulates \f$K\f$ rollouts in parallel, where \f$K\f$ is the largest
+   * size of `uss` and `x0s`. A single control sequence (or initial state) is
+   * shared by all the rollouts, and an empty `x0s` uses the initial state of
+   * the problem. Each worker thread evaluates the action models with its own
+   * data, which are allocated once and reused, so the running datas of the
+   * problem are not modified.
+   *
+   * @param[in]  uss    control sequences (size \f$1\f$ or \f$K\f$, each of
+   * size \f$T\f$)
+   * @param[in]  x0s    initial states (size \f$0\f$, \f$1\f$ or \f$K\f$)
+   * @param[out] xss    state trajectories (size \f$K\f$, each of size
+   * \f$T+1\f$)
+   * @param[out] costs  total costs of the rollouts (size \f$K\f$)
+   */
+  void rollouts(const std::vector<std::vector<VectorXs> >& uss,
+                const std::vector<VectorXs>& x0s,
+                std::vector<std::vector<VectorXs> >& xss,
+                std::vector<Scalar>& costs);
+
+  /**
+   * @brief Allocate the data of the rollout workers
+   *
+   * Datas are only re-allocated for the nodes whose action model changed
+   * since the last call, otherwise nothing is modified. It is called by
+   * `rollouts()`, and the Python bindings call it beforehand so the models and
+   * datas are created and released while holding the GIL.
+   *
+   * @param[in] nworkers  number of rollout workers
+   */
+  void allocateRolloutData(const std::size_t nworkers);
+
   /**
    * @brief Compute the quasic static commands given a state trajectory
    *
@@ -172,6 +224,18 @@ class ShootingProblemTpl {
    */
   void circularAppend(std::shared_ptr<ActionModelAbstract> model);
 
+  /**
+   * @brief Shift the running nodes by \f$n\f$ positions
+   *
+   * The first \f$n\f$ running models and datas are moved onto the end of the
+   * horizon as in a circular buffer. It neither allocates nor copies any data.
+   * The moved nodes are typically updated afterwards with `updateNode()` or
+   * `updateModel()`.
+   *
+   * @param[in] n  number of shifted nodes \f$(0\leq n \leq T)\f$
+   */
+  void shift(const std::size_t n);
+
   /**
    * @brief Update the model and data for a specific node
    *
@@ -302,6 +366,11 @@ class ShootingProblemTpl {
 
  private:
   void allocateData();
+
+  std::vector<std::shared_ptr<ActionModelAbstract> >
+      rollout_models_;  //!< Action models used to allocate the rollout data
+  std::vector<std::vector<std::shared_ptr<ActionDataAbstract> > >
+      rollout_datas_;  //!< Action data of each rollout worker (size T+1)
 };
 
 }  // namespace crocoddyl
@@ -7,6 +7,7 @@
 // All rights reserved.
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iostream>
 #ifdef CROCODDYL_WITH_MULTITHREADING
 #include <omp.h>
@@ -179,7 +180,9 @@ Scalar ShootingProblemTpl<Scalar>::calc(const std::vector<VectorXs>& xs,
 #pragma omp parallel for num_threads(nthreads_)
 #endif
   for (std::size_t i = 0; i < T_; ++i) {
+    START_PROFILER_NODE("ShootingProblem::calc::node", i);
     running_models_[i]->calc(running_datas_[i], xs[i], us[i]);
+    STOP_PROFILER("ShootingProblem::calc::node");
   }
   terminal_model_->calc(terminal_data_, xs.back());
 
@@ -214,7 +217,9 @@ Scalar ShootingProblemTpl<Scalar>::calcDiff(const std::vector<VectorXs>& xs,
 #pragma omp parallel for num_threads(nthreads_)
 #endif
   for (std::size_t i = 0; i < T_; ++i) {
+    START_PROFILER_NODE("ShootingProblem::calcDiff::node", i);
     running_models_[i]->calcDiff(running_datas_[i], xs[i], us[i]);
+    STOP_PROFILER("ShootingProblem::calcDiff::node");
   }
   terminal_model_->calcDiff(terminal_data_, xs.back());
 
@@ -231,6 +236,44 @@ Scalar ShootingProblemTpl<Scalar>::calcDiff(const std::vector<VectorXs>& xs,
   return cost_;
 }
 
+template <typename Scalar>
+Scalar ShootingProblemTpl<Scalar>::calcAndDiff(
+    const std::vector<VectorXs>& xs, const std::vector<VectorXs>& us) {
+  if (xs.size() != T_ + 1) {
+    throw_pretty(
+        "Invalid argument: " << "xs has wrong dimension (it should be " +
+                                    std::to_string(T_ + 1) + ")");
+  }
+  if (us.size() != T_) {
+    throw_pretty(
+        "Invalid argument: " << "us has wrong dimension (it should be " +
+                                    std::to_string(T_) + ")");
+  }
+  START_PROFILER("ShootingProblem::calcAndDiff");
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(nthreads_)
+#endif
+  for (std::size_t i = 0; i < T_; ++i) {
+    START_PROFILER_NODE("ShootingProblem::calcAndDiff::node", i);
+    running_models_[i]->calcAndDiff(running_datas_[i], xs[i], us[i]);
+    STOP_PROFILER("ShootingProblem::calcAndDiff::node");
+  }
+  terminal_model_->calcAndDiff(terminal_data_, xs.back());
+
+  cost_ = Scalar(0.);
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp simd reduction(+ : cost_)
+#endif
+  for (std::size_t i = 0; i < T_; ++i) {
+    cost_ += running_datas_[i]->cost;
+  }
+  cost_ += terminal_data_->cost;
+
+  STOP_PROFILER("ShootingProblem::calcAndDiff");
+  return cost_;
+}
+
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::rollout(const std::vector<VectorXs>& us,
                                          std::vector<VectorXs>& xs) {
@@ -265,6 +308,89 @@ ShootingProblemTpl<Scalar>::rollout_us(const std::vector<VectorXs>& us) {
   return xs;
 }
 
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::rollouts(
+    const std::vector<std::vector<VectorXs> >& uss,
+    const std::vector<VectorXs>& x0s, std::vector<std::vector<VectorXs> >& xss,
+    std::vector<Scalar>& costs) {
+  const std::size_t K = std::max(uss.size(), x0s.size());
+  if (uss.size() != 1 && uss.size() != K) {
+    throw_pretty(
+        "Invalid argument: " << "uss has wrong dimension (it should be 1 or " +
+                                    std::to_string(K) + ")");
+  }
+  if (x0s.size() > 1 && x0s.size() != K) {
+    throw_pretty("Invalid argument: "
+                 << "x0s has wrong dimension (it should be 0, 1 or " +
+                        std::to_string(K) + ")");
+  }
+  // The inputs are checked beforehand as exceptions cannot be propagated
+  // outside the parallel region
+  for (std::size_t k = 0; k < uss.size(); ++k) {
+    const std::vector<VectorXs>& us = uss[k];
+    if (us.size() != T_) {
+      throw_pretty("Invalid argument: "
+                   << "uss[" << k
+                   << "] has wrong dimension (it should be " +
+                          std::to_string(T_) + ")");
+    }
+    for (std::size_t i = 0; i < T_; ++i) {
+      if (static_cast<std::size_t>(us[i].size()) !=
+          running_models_[i]->get_nu()) {
+        throw_pretty("Invalid argument: "
+                     << "uss[" << k << "][" << i
+                     << "] has wrong dimension (it should be " +
+                            std::to_string(running_models_[i]->get_nu()) +
+                            ")");
+      }
+    }
+  }
+  for (std::size_t k = 0; k < x0s.size(); ++k) {
+    if (static_cast<std::size_t>(x0s[k].size()) != nx_) {
+      throw_pretty("Invalid argument: "
+                   << "x0s[" << k
+                   << "] has wrong dimension (it should be " +
+                          std::to_string(nx_) + ")");
+    }
+  }
+  START_PROFILER("ShootingProblem::rollouts");
+  xss.resize(K);
+  costs.resize(K);
+  const std::size_t nworkers = std::max<std::size_t>(
+      std::min<std::size_t>(nthreads_, K), std::size_t(1));
+  allocateRolloutData(nworkers);
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(nworkers) schedule(dynamic)
+#endif
+  for (std::size_t k = 0; k < K; ++k) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    const std::size_t w = static_cast<std::size_t>(omp_get_thread_num());
+#else
+    const std::size_t w = 0;
+#endif
+    const std::vector<std::shared_ptr<ActionDataAbstract> >& datas =
+        rollout_datas_[w];
+    const std::vector<VectorXs>& us = uss.size() == 1 ? uss[0] : uss[k];
+    std::vector<VectorXs>& xs = xss[k];
+    xs.resize(T_ + 1);
+    if (x0s.empty()) {
+      xs[0] = x0_;
+    } else {
+      xs[0] = x0s.size() == 1 ? x0s[0] : x0s[k];
+    }
+    Scalar cost = Scalar(0.);
+    for (std::size_t i = 0; i < T_; ++i) {
+      running_models_[i]->calc(datas[i], xs[i], us[i]);
+      xs[i + 1] = datas[i]->xnext;
+      cost += datas[i]->cost;
+    }
+    terminal_model_->calc(datas[T_], xs.back());
+    costs[k] = cost + datas[T_]->cost;
+  }
+  STOP_PROFILER("ShootingProblem::rollouts");
+}
+
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::quasiStatic(std::vector<VectorXs>& us,
                                              const std::vector<VectorXs>& xs) {
@@ -344,6 +470,24 @@ void ShootingProblemTpl<Scalar>::circularAppend(
   running_datas_.back() = model->createData();
 }
 
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::shift(const std::size_t n) {
+  if (n > T_) {
+    throw_pretty("Invalid argument: "
+                 << "n is bigger than the allocated horizon (it should be less "
+                    "than or equal to " +
+                        std::to_string(T_) + ")");
+  }
+  if (n == 0 || n == T_) {
+    return;
+  }
+  is_updated_ = true;
+  std::rotate(running_models_.begin(), running_models_.begin() + n,
+              running_models_.end());
+  std::rotate(running_datas_.begin(), running_datas_.begin() + n,
+              running_datas_.end());
+}
+
 template <typename Scalar>
 void ShootingProblemTpl<Scalar>::updateNode(
     const std::size_t i, std::shared_ptr<ActionModelAbstract> model,
@@ -424,6 +568,33 @@ void ShootingProblemTpl<Scalar>::allocateData() {
   terminal_data_ = terminal_model_->createData();
 }
 
+template <typename Scalar>
+void ShootingProblemTpl<Scalar>::allocateRolloutData(
+    const std::size_t nworkers) {
+  rollout_models_.resize(T_ + 1);
+  if (rollout_datas_.size() < nworkers) {
+    rollout_datas_.resize(nworkers);
+  }
+  for (std::size_t i = 0; i < T_ + 1; ++i) {
+    const std::shared_ptr<ActionModelAbstract>& model =
+        i < T_ ? running_models_[i] : terminal_model_;
+    const bool changed = rollout_models_[i] != model;
+    if (changed) {
+      rollout_models_[i] = model;
+    }
+    for (std::size_t w = 0; w < rollout_datas_.size(); ++w) {
+      std::vector<std::shared_ptr<ActionDataAbstract> >& datas =
+          rollout_datas_[w];
+      if (datas.size() != T_ + 1) {
+        datas.resize(T_ + 1);
+      }
+      if (changed || !datas[i]) {
+        datas[i] = model->createData();
+      }
+    }
+  }
+}
+
 template <typename Scalar>
 const std::vector<std::shared_ptr<crocoddyl::ActionModelAbstractTpl<Scalar> > >&
 ShootingProblemTpl<Scalar>::get_runningModels() const {
@@ -10,6 +10,7 @@
 #ifndef CROCODDYL_CORE_SOLVER_BASE_HPP_
 #define CROCODDYL_CORE_SOLVER_BASE_HPP_
 
+#include <chrono>
 #include <vector>
 
 #include "crocoddyl/core/optctrl/shooting.hpp"
@@ -22,6 +23,86 @@ static std::vector<Eigen::VectorXd> DEFAULT_VECTOR;
 
 enum FeasibilityNorm { LInf = 0, L1 };
 
+/**
+ * @brief Initialization of the nodes appended by `SolverAbstract::shift()`
+ *
+ * `RepeatLast` repeats the last shifted state and control, `QuasiStatic` uses
+ * the quasi-static control of the last shifted state, and `TerminalRollout`
+ * rolls out the dynamics with the policy of the last shifted node.
+ */
+enum ShiftPolicy { RepeatLast = 0, QuasiStatic, TerminalRollout };
+
+/**
+ * @brief Phase at which the time budget stopped the last solve
+ *
+ * `DeadlineNone` means that the solve finished within the time budget.
+ * `DeadlineIteration` stops before starting a new iteration,
+ * `DeadlineBackwardPass` stops after the backward pass (only the feedback
+ * policy is updated), and `DeadlineLineSearch` stops during the line search
+ * (the last accepted iterate is kept).
+ */
+enum DeadlineStatus {
+  DeadlineNone = 0,
+  DeadlineIteration,
+  DeadlineBackwardPass,
+  DeadlineLineSearch
+};
+
+/**
+ * @brief Statistics of a solver iteration
+ *
+ * The wall times are measured in seconds with the clock used to check the time
+ * budget. Only the phases run in the iteration are timed, e.g., `calc_time` is
+ * zero when the derivatives are not recomputed, and `backward_time` includes
+ * the backward passes that failed before increasing the regularization.
+ */
+struct SolverIterationStats {
+  SolverIterationStats()
+      : solve(0),
+        iter(0),
+        start_time(0.),
+        iteration_time(0.),
+        calc_time(0.),
+        backward_time(0.),
+        cost(0.),
+        merit(0.),
+        stop(0.),
+        steplength(0.),
+        dV(0.),
+        dVexp(0.),
+        preg(0.),
+        dreg(0.),
+        feas(0.),
+        ffeas(0.),
+        gfeas(0.),
+        hfeas(0.),
+        is_feasible(false),
+        deadline_status(DeadlineNone) {}
+
+  std::size_t solve;      //!< Index of the solve
+  std::size_t iter;       //!< Index of the iteration within the solve
+  double start_time;      //!< Start of the iteration since the solve started
+  double iteration_time;  //!< Duration of the iteration
+  double calc_time;       //!< Duration of the derivatives computation
+  double backward_time;   //!< Duration of the backward passes
+  std::vector<double>
+      trial_times;    //!< Duration of each forward pass of the line search
+  double cost;        //!< Cost after the iteration
+  double merit;       //!< Merit after the iteration
+  double stop;        //!< Stopping criteria after the iteration
+  double steplength;  //!< Last step length tried by the line search
+  double dV;          //!< Cost reduction of the last step length
+  double dVexp;       //!< Expected cost reduction of the last step length
+  double preg;        //!< Primal-variable regularization of the backward pass
+  double dreg;        //!< Dual-variable regularization of the backward pass
+  double feas;        //!< Total feasibility after the iteration
+  double ffeas;       //!< Dynamic feasibility after the iteration
+  double gfeas;       //!< Inequality feasibility after the iteration
+  double hfeas;       //!< Equality feasibility after the iteration
+  bool is_feasible;   //!< True if the iterate is dynamically feasible
+  DeadlineStatus deadline_status;  //!< Phase stopped by the time budget
+};
+
 /**
  * @brief Abstract class for optimal control solvers
  *
@@ -155,6 +236,36 @@ class SolverAbstract {
    */
   virtual void resizeData();
 
+  /**
+   * @brief Shift the horizon by \f$n\f$ nodes
+   *
+   * It shifts the running nodes of the shooting problem (see
+   * `ShootingProblem::shift()`) together with the current guess and the solver
+   * data of each node. The shift is done in place, so no memory is allocated
+   * and the previous solution, e.g., the Riccati gains, is kept to warm-start
+   * the next solve in receding-horizon control. The \f$n\f$ appended nodes are
+   * initialized according to the shift policy.
+   *
+   * @param[in] n       number of shifted nodes \f$(0\leq n \leq T)\f$
+   * @param[in] policy  initialization of the appended nodes (default
+   * `RepeatLast`)
+   */
+  void shift(const std::size_t n, const ShiftPolicy policy = RepeatLast);
+
+  /**
+   * @brief Compute the control of the current policy at a given node
+   *
+   * By default, it returns the control of the current guess. Solvers that
+   * compute feedback gains apply them on the deviation from the current guess.
+   *
+   * @param[in]  t  node index \f$(0\leq t \lt T)\f$
+   * @param[in]  x  state \f$\mathbf{x}\in\mathbb{R}^{nx}\f$
+   * @param[out] u  control \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void rolloutPolicy(const std::size_t t,
+                             const Eigen::Ref<const Eigen::VectorXd>& x,
+                             Eigen::Ref<Eigen::VectorXd> u);
+
   /**
    * @brief Compute the dynamic feasibility
    * \f$\|\mathbf{f}_{\mathbf{s}}\|_{\infty,1}\f$ for the current guess
@@ -228,6 +339,11 @@ class SolverAbstract {
    */
   const std::vector<std::shared_ptr<CallbackAbstract> >& getCallbacks() const;
 
+  /**
+   * @brief Remove the recorded iteration statistics
+   */
+  void clearStats();
+
   /**
    * @brief Return the shooting problem
    */
@@ -382,6 +498,36 @@ class SolverAbstract {
    */
   std::size_t get_iter() const;
 
+  /**
+   * @brief Return the wall-clock time budget of a solve in seconds
+   */
+  double get_time_budget() const;
+
+  /**
+   * @brief Return the phase at which the time budget stopped the last solve
+   */
+  DeadlineStatus get_deadline_status() const;
+
+  /**
+   * @brief Return the number of iteration statistics kept by the solver
+   */
+  std::size_t get_stats_capacity() const;
+
+  /**
+   * @brief Return the number of recorded iteration statistics
+   *
+   * It is bounded by the capacity, as the oldest statistics are overwritten.
+   */
+  std::size_t get_nstats() const;
+
+  /**
+   * @brief Return the recorded statistics of an iteration
+   *
+   * @param[in] i  index of the statistics, from the oldest (0) to the latest
+   * (`get_nstats()-1`)
+   */
+  const SolverIterationStats& get_stats(const std::size_t i) const;
+
   /**
    * @brief Modify the state trajectory \f$\mathbf{x}_s\f$
    */
@@ -428,7 +574,79 @@ class SolverAbstract {
    */
   void set_feasnorm(const FeasibilityNorm feas_norm);
 
+  /**
+   * @brief Modify the wall-clock time budget of a solve in seconds
+   *
+   * The solver consults a monotonic clock at the boundaries of its phases, and
+   * it stops if the expected duration of the next phase exceeds the remaining
+   * time. The expected durations are the ones measured in the previous phases.
+   * By default, the time budget is infinite.
+   */
+  void set_time_budget(const double time_budget);
+
+  /**
+   * @brief Modify the number of iteration statistics kept by the solver
+   *
+   * The statistics are stored in a ring buffer allocated by this function,
+   * and the recorded ones are removed. A zero capacity disables the recording.
+   * By default, the solver keeps the statistics of the last 100 iterations.
+   */
+  void set_stats_capacity(const std::size_t capacity);
+
  protected:
+  /**
+   * @brief Rotate the solver data by \f$n\f$ nodes
+   *
+   * It moves the first \f$n\f$ nodes onto the end of the horizon as in a
+   * circular buffer. Solvers with extra data per node override it.
+   *
+   * @param[in] n  number of shifted nodes \f$(0\lt n \lt T)\f$
+   */
+  virtual void shiftData(const std::size_t n);
+
+  /**
+   * @brief Start the clock of a new solve
+   *
+   * The clock is used to check the time budget and to time the iterations.
+   */
+  void startClock();
+
+  /**
+   * @brief Start the statistics of a new iteration
+   */
+  void startIterationStats();
+
+  /**
+   * @brief Reserve the trial times of the iteration statistics
+   *
+   * Solvers call it with their maximum number of step trials per iteration,
+   * so the statistics are recorded without allocating memory.
+   *
+   * @param[in] ntrials  maximum number of step trials per iteration
+   */
+  void reserveIterationStats(const std::size_t ntrials);
+
+  /**
+   * @brief Record the statistics of the current iteration
+   *
+   * It completes the statistics with the current values of the solver, and it
+   * stores them in the ring buffer.
+   */
+  void recordIterationStats();
+
+  /**
+   * @brief Return the time elapsed since `startClock()` in seconds
+   */
+  double elapsedTime() const;
+
+  /**
+   * @brief Check if a phase cannot be completed within the time budget
+   *
+   * @param[in] phase_time  expected duration of the phase in seconds
+   * @return true if the remaining time is smaller than \p phase_time
+   */
+  bool isDeadlineReached(const double phase_time) const;
+
   std::shared_ptr<ShootingProblem> problem_;  //!< optimal control problem
   std::vector<Eigen::VectorXd> xs_;           //!< State trajectory
   std::vector<Eigen::VectorXd> us_;           //!< Control trajectory
@@ -475,6 +693,19 @@ class SolverAbstract {
   std::size_t iter_;  //!< Number of iteration performed by the solver
   double tmp_feas_;   //!< Temporal variables used for computed the feasibility
   std::vector<Eigen::VectorXd> g_adj_;  //!< Adjusted inequality bound
+
+  double time_budget_;              //!< Wall-clock time budget of a solve
+  DeadlineStatus deadline_status_;  //!< Phase stopped by the time budget
+  double direction_time_;           //!< Duration of the last search direction
+  double trystep_time_;             //!< Duration of the last step trial
+
+  std::chrono::steady_clock::time_point start_time_;  //!< Start of the solve
+  std::size_t nsolves_;  //!< Number of solves started
+
+  SolverIterationStats iter_stats_;  //!< Statistics of the current iteration
+  std::vector<SolverIterationStats>
+      stats_;           //!< Ring buffer of the iteration statistics
+  std::size_t nstats_;  //!< Number of iteration statistics recorded
 };
 
 /**
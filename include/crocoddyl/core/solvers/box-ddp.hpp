@@ -14,6 +14,7 @@
 
 #include "crocoddyl/core/solvers/box-qp.hpp"
 #include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/utils/deprecate.hpp"
 
 namespace crocoddyl {
 
@@ -29,11 +30,17 @@ class SolverBoxDDP : public SolverDDP {
   virtual void forwardPass(const double steplength);
   virtual void resizeData();
 
-  const std::vector<Eigen::MatrixXd>& get_Quu_inv() const;
+  /**
+   * @brief Throw an exception, as the inverse of Quu is not computed anymore
+   */
+  DEPRECATED("The inverse of Quu is not computed anymore, the feedback gains "
+             "are computed by triangular solves in the box QP",
+             const std::vector<Eigen::MatrixXd>& get_Quu_inv() const;)
 
  protected:
+  virtual void shiftData(const std::size_t n);
+
   BoxQP qp_;
-  std::vector<Eigen::MatrixXd> Quu_inv_;
   std::vector<Eigen::VectorXd> du_lb_;
   std::vector<Eigen::VectorXd> du_ub_;
 };
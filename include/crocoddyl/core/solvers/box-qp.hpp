@@ -21,7 +21,8 @@ namespace crocoddyl {
  * @brief Box QP solution
  *
  * It contains the Box QP solution data which consists of
- *  - the inverse of the free space Hessian
+ *  - the inverse of the free space Hessian (only if it is requested, see
+ *    `BoxQP::set_with_inverse()`)
  *  - the optimal decision vector
  *  - the indexes for the free space
  *  - the indexes for the clamped (constrained) space
@@ -70,7 +71,12 @@ struct BoxQPSolution {
  * The algorithm procees by iteratively identifying the active bounds, and then
  * performing a projected Newton step in the free sub-space.
  * The projection uses the Hessian of the free sub-space and is computed
- * efficiently using a Cholesky decomposition.
+ * efficiently using a Cholesky decomposition. This decomposition is not
+ * recomputed when the active set changes by a few variables; instead, the
+ * Cholesky factor is modified by rank-one updates (removal of a free variable)
+ * and downdates (addition of a free variable). The active set of the first
+ * iteration is warm-started from the initial guess, which is typically the
+ * solution of the previous iteration.
  * It uses a line search procedure with polynomial step length values in a
  * backtracking fashion.
  * The steps are checked using an Armijo condition together L2-norm gradient.
@@ -83,6 +89,9 @@ class BoxQP {
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      MatrixXdRowMajor;
+
   /**
    * @brief Initialize the Projected-Newton QP for bound constraints
    *
@@ -117,6 +126,20 @@ class BoxQP {
                              const Eigen::VectorXd& ub,
                              const Eigen::VectorXd& xinit);
 
+  /**
+   * @brief Multiply a matrix by the inverse of the free space Hessian
+   *
+   * It computes \f$\mathbf{B}_f\leftarrow\mathbf{H}_{ff}^{-1}\mathbf{B}_f\f$
+   * by forward and backward substitution with the Cholesky factor of the last
+   * `solve()` call, where \f$\mathbf{B}_f\f$ are the rows of the free space.
+   * The rows of the clamped space are set to zero. Thus, the feedback gains of
+   * the box-constrained solvers are computed without forming the inverse of
+   * the free space Hessian.
+   *
+   * @param[in,out] B  Matrix to be multiplied (dimension nx * m)
+   */
+  void solveFreeInPlace(Eigen::Ref<MatrixXdRowMajor> B);
+
   /**
    * @brief Return the stored solution
    */
@@ -152,6 +175,11 @@ class BoxQP {
    */
   const std::vector<double>& get_alphas() const;
 
+  /**
+   * @brief Return true if the inverse of the free space Hessian is computed
+   */
+  bool get_with_inverse() const;
+
   /**
    * @brief Modify the decision vector dimension
    */
@@ -182,7 +210,47 @@ class BoxQP {
    */
   void set_alphas(const std::vector<double>& alphas);
 
+  /**
+   * @brief Modify the flag that enables the computation of the inverse of the
+   * free space Hessian
+   *
+   * The inverse is stored in `BoxQPSolution::Hff_inv`. Disable it when only
+   * products with the inverse are needed, see `solveFreeInPlace()`.
+   */
+  void set_with_inverse(const bool with_inverse);
+
  private:
+  /**
+   * @brief Compute the Cholesky factor of the free space Hessian from scratch
+   *
+   * @return true if the free space Hessian is positive definite
+   */
+  bool factorize(const Eigen::MatrixXd& H);
+
+  /**
+   * @brief Remove a variable from the free space and update the Cholesky
+   * factor
+   */
+  void removeFree(const std::size_t j);
+
+  /**
+   * @brief Add a variable to the free space and downdate the Cholesky factor
+   *
+   * @return true if the new free space Hessian is positive definite
+   */
+  bool addFree(const Eigen::MatrixXd& H, const std::size_t j);
+
+  /**
+   * @brief Rank-one modification of a lower-triangular Cholesky factor
+   *
+   * It computes \f$\mathbf{L}\mathbf{L}^T+\sigma\mathbf{w}\mathbf{w}^T\f$
+   * in place, where \f$\mathbf{w}\f$ is overwritten.
+   *
+   * @return false if the downdated matrix is not positive definite
+   */
+  static bool rankUpdate(Eigen::Ref<Eigen::MatrixXd> L,
+                         Eigen::Ref<Eigen::VectorXd> w, const double sigma);
+
   std::size_t nx_;          //!< Decision variable dimension
   BoxQPSolution solution_;  //!< Solution of the Box QP
   std::size_t maxiter_;     //!< Allowed maximum number of iterations
@@ -202,14 +270,19 @@ class BoxQP {
   Eigen::VectorXd g_;     //!< Current gradient
   Eigen::VectorXd dx_;    //!< Current search direction
 
-  Eigen::VectorXd xo_;  //!< Organized decision
   Eigen::VectorXd
       dxo_;  //!< Search direction organized by free and constrained subspaces
   Eigen::VectorXd
       qo_;  //!< Gradient organized by free and constrained subspaces
-  Eigen::MatrixXd Ho_;  //!< Hessian organized by free and constrained subspaces
 
-  Eigen::LLT<Eigen::MatrixXd> Hff_inv_llt_;  //!< Cholesky solver
+  bool with_inverse_;  //!< Compute the inverse of the free space Hessian
+  std::vector<bool> clamped_;  //!< Flags of the clamped variables
+  std::vector<std::size_t>
+      changes_;        //!< Variables that changed their active-set status
+  Eigen::MatrixXd L_;  //!< Cholesky factor of the free space Hessian (lower
+                       //!< triangular part of the top-left nf x nf block)
+  Eigen::VectorXd w_;  //!< Vector used by the rank-one modifications
+  MatrixXdRowMajor Bf_;  //!< Rows of the free space used by solveFreeInPlace
 };
 
 }  // namespace crocoddyl
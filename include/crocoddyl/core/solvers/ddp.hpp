@@ -78,6 +78,21 @@ class SolverDDP : public SolverAbstract {
   virtual const Eigen::Vector2d& expectedImprovement();
   virtual void resizeData();
 
+  /**
+   * @brief Compute the control of the current policy at a given node
+   *
+   * It applies the feedback gains on the deviation from the current guess,
+   * i.e., \f$\mathbf{u} = \mathbf{u}_t - \mathbf{K}_t(\mathbf{x}_t\ominus
+   * \mathbf{x})\f$.
+   *
+   * @param[in]  t  node index \f$(0\leq t \lt T)\f$
+   * @param[in]  x  state \f$\mathbf{x}\in\mathbb{R}^{nx}\f$
+   * @param[out] u  control \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void rolloutPolicy(const std::size_t t,
+                             const Eigen::Ref<const Eigen::VectorXd>& x,
+                             Eigen::Ref<Eigen::VectorXd> u);
+
   /**
    * @brief Update the Jacobian, Hessian and feasibility of the optimal control
    * problem
@@ -294,6 +309,16 @@ class SolverDDP : public SolverAbstract {
    */
   const std::vector<Eigen::VectorXd>& get_k() const;
 
+  /**
+   * @brief Modify the feedback gains \f$\mathbf{K}_{s}\f$
+   */
+  void set_K(const std::vector<MatrixXdRowMajor>& K);
+
+  /**
+   * @brief Modify the feedforward gains \f$\mathbf{k}_{s}\f$
+   */
+  void set_k(const std::vector<Eigen::VectorXd>& k);
+
   /**
    * @brief Modify the regularization factor used to increase the damping value
    */
@@ -344,6 +369,8 @@ class SolverDDP : public SolverAbstract {
   void set_th_grad(const double th_grad);
 
  protected:
+  virtual void shiftData(const std::size_t n);
+
   double reg_incfactor_;  //!< Regularization factor used to increase the
                           //!< damping value
   double reg_decfactor_;  //!< Regularization factor used to decrease the
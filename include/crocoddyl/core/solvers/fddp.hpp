@@ -95,6 +95,34 @@ class SolverFDDP : public SolverDDP {
   void updateExpectedImprovement();
   virtual void forwardPass(const double stepLength);
 
+  /**
+   * @brief Run the preparation phase of a real-time iteration (RTI)
+   *
+   * It computes the derivatives and runs the backward pass around the current
+   * guess, e.g., the previous solution shifted with `shift()`, whose initial
+   * state is the predicted one. This phase does not depend on the measured
+   * state, so it runs before the new measurement arrives. If the backward pass
+   * fails, the regularization is increased until it succeeds.
+   *
+   * @return false if the regularization reached its maximum value
+   */
+  bool prepareRTI();
+
+  /**
+   * @brief Run the feedback phase of a real-time iteration (RTI)
+   *
+   * Once the initial state is measured, it applies the gains computed by
+   * `prepareRTI()` and rolls out the dynamics with a full step, i.e.,
+   * \f$\mathbf{\hat{u}}_k = \mathbf{u}_k - \mathbf{k}_k -
+   * \mathbf{K}_k(\mathbf{\hat{x}}_k\ominus\mathbf{x}_k)\f$ with
+   * \f$\mathbf{\hat{x}}_0=\mathbf{\tilde{x}}_0\f$. The rollout is accepted as
+   * the new guess, and its first control is the command to apply.
+   *
+   * @param[in] x0  measured initial state \f$\mathbf{\tilde{x}}_0\f$
+   * @return false if the rollout failed
+   */
+  bool feedbackRTI(const Eigen::VectorXd& x0);
+
   /**
    * @brief Return the threshold used for accepting step along ascent direction
    */
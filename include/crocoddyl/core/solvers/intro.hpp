@@ -157,6 +157,8 @@ class SolverIntro : public SolverFDDP {
   void set_zero_upsilon(const bool zero_upsilon);
 
  protected:
+  virtual void shiftData(const std::size_t n);
+
   enum EqualitySolverType
       eq_solver_;   //!< Strategy used for handling the equality constraints
   double th_feas_;  //!< Threshold for switching to feasibility
@@ -195,7 +197,14 @@ class SolverIntro : public SolverFDDP {
   std::vector<Eigen::MatrixXd>
       Ks_;  //!< Feedback gain related to the equality constraints
   std::vector<Eigen::MatrixXd> QuuinvHuT_;
-  std::vector<Eigen::LLT<Eigen::MatrixXd> > Qzz_llt_;  //!< Cholesky LLT solver
+  Eigen::MatrixXd Qzz_L_;  //!< Workspace for the in-place Cholesky
+                           //!< factorization of the reduced Hessian
+  std::vector<Eigen::MatrixXd>
+      Hu_cache_;  //!< Control Jacobian of the equality constraints used to
+                  //!< compute the span and kernel matrices
+  std::vector<Eigen::MatrixXd>
+      YZ_ws_;  //!< Workspace used to compute the kernel matrix and to evaluate
+               //!< the Householder sequence
   std::vector<Eigen::FullPivLU<Eigen::MatrixXd> >
       Hu_lu_;  //!< Full-pivot LU solvers used for computing the span and
                //!< nullspace matrices
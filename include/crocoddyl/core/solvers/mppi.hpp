@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_SOLVERS_MPPI_HPP_
+#define CROCODDYL_CORE_SOLVERS_MPPI_HPP_
+
+#include <random>
+#include <vector>
+
+#include "crocoddyl/core/solver-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Model Predictive Path Integral (MPPI) solver
+ *
+ * The MPPI solver is a sampling-based method that only evaluates the dynamics
+ * and costs of the action models, i.e., it does not need their derivatives.
+ * In each iteration, it samples \f$K\f$ control sequences around the nominal
+ * one, \f$\mathbf{u}^{(k)}_t=\mathbf{u}_t+\boldsymbol{\epsilon}^{(k)}_t\f$
+ * with \f$\boldsymbol{\epsilon}^{(k)}_t\sim\mathcal{N}(\mathbf{0},
+ * \sigma^2\mathbf{I})\f$, and rolls them out to obtain their total costs
+ * \f$S_k\f$. Then, the search direction is the average of the perturbations
+ * weighted by
+ * \f{equation}
+ *   w_k = \frac{\exp(-\frac{1}{\lambda}(S_k-S_{min}))}{\sum_{j=1}^K
+ * \exp(-\frac{1}{\lambda}(S_j-S_{min}))},
+ * \f}
+ * where \f$\lambda\f$ is the temperature. The perturbed controls are clamped
+ * to the control limits of the action models. The new control sequence is
+ * accepted if it does not increase the cost, so the state trajectory is always
+ * feasible.
+ *
+ * The samples are rolled out in parallel with `ShootingProblem::rollouts()`,
+ * where each thread has its own action data. The samples, rollouts and
+ * weights are allocated once, so an iteration does not allocate memory. The
+ * initial guess of the state trajectory is ignored as it is obtained by
+ * rolling out the control sequence.
+ *
+ * This solver is useful to escape poor initial guesses or non-smooth costs,
+ * and its solution can warm-start a derivative-based solver, e.g.,
+ * `SolverFDDP::solve(mppi.get_xs(), mppi.get_us(), maxiter, true)`.
+ *
+ * \sa `solve()`, `computeDirection()`, `tryStep()`, `stoppingCriteria()`
+ */
+class SolverMPPI : public SolverAbstract {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief Initialize the MPPI solver
+   *
+   * @param[in] problem      shooting problem
+   * @param[in] nsamples     number of sampled control sequences (default 256)
+   * @param[in] noise        standard deviation of the control perturbations
+   * (default 0.1)
+   * @param[in] temperature  temperature of the sample weights (default 1)
+   * @param[in] seed         seed of the random number generators (default 0)
+   */
+  explicit SolverMPPI(std::shared_ptr<ShootingProblem> problem,
+                      const std::size_t nsamples = 256,
+                      const double noise = 0.1, const double temperature = 1.,
+                      const unsigned int seed = 0);
+  virtual ~SolverMPPI();
+
+  virtual bool solve(
+      const std::vector<Eigen::VectorXd>& init_xs = DEFAULT_VECTOR,
+      const std::vector<Eigen::VectorXd>& init_us = DEFAULT_VECTOR,
+      const std::size_t maxiter = 100, const bool is_feasible = false,
+      const double init_reg = NAN);
+
+  /**
+   * @brief Compute the search direction from the weighted samples
+   *
+   * It samples the control sequences, rolls them out in parallel, and
+   * computes the weighted average of their perturbations. It throws an
+   * exception if all the rollouts diverged, as there is no search direction.
+   * In that case, `solve()` counts a failed iteration and draws new samples.
+   *
+   * @param[in] recalc  unused, the samples are always drawn again
+   */
+  virtual void computeDirection(const bool recalc = true);
+
+  /**
+   * @brief Roll out the nominal control sequence moved along the search
+   * direction
+   *
+   * @param[in] steplength  applied step length (\f$0\leq\alpha\leq1\f$)
+   * @return the cost improvement
+   */
+  virtual double tryStep(const double steplength = 1);
+
+  /**
+   * @brief Return the squared norm of the search direction
+   */
+  virtual double stoppingCriteria();
+
+  /**
+   * @brief Return zero, as the sampling-based search direction has no
+   * improvement model
+   */
+  virtual const Eigen::Vector2d& expectedImprovement();
+
+  virtual void resizeData();
+
+  /**
+   * @brief Return the number of sampled control sequences
+   */
+  std::size_t get_nsamples() const;
+
+  /**
+   * @brief Return the standard deviation of the control perturbations
+   */
+  double get_noise() const;
+
+  /**
+   * @brief Return the temperature of the sample weights
+   */
+  double get_temperature() const;
+
+  /**
+   * @brief Return the search direction
+   */
+  const std::vector<Eigen::VectorXd>& get_dus() const;
+
+  /**
+   * @brief Return the sampled control sequences of the last iteration
+   */
+  const std::vector<std::vector<Eigen::VectorXd> >& get_us_samples() const;
+
+  /**
+   * @brief Return the state trajectories of the sampled control sequences
+   */
+  const std::vector<std::vector<Eigen::VectorXd> >& get_xs_samples() const;
+
+  /**
+   * @brief Return the total costs of the sampled control sequences
+   */
+  const std::vector<double>& get_costs() const;
+
+  /**
+   * @brief Return the normalized weights of the sampled control sequences
+   */
+  const std::vector<double>& get_weights() const;
+
+  /**
+   * @brief Modify the number of sampled control sequences
+   */
+  void set_nsamples(const std::size_t nsamples);
+
+  /**
+   * @brief Modify the standard deviation of the control perturbations
+   */
+  void set_noise(const double noise);
+
+  /**
+   * @brief Modify the temperature of the sample weights
+   */
+  void set_temperature(const double temperature);
+
+  /**
+   * @brief Reset the random number generators with a new seed
+   */
+  void set_seed(const unsigned int seed);
+
+ protected:
+  double cost_try_;                      //!< Total cost of the trial rollout
+  std::vector<Eigen::VectorXd> xs_try_;  //!< State trajectory of the trial
+  std::vector<Eigen::VectorXd> us_try_;  //!< Control sequence of the trial
+
+ private:
+  /**
+   * @brief Allocate the samples and the random number generators
+   */
+  void allocateData();
+
+  /**
+   * @brief Roll out a control sequence with the problem datas
+   *
+   * @return the total cost
+   */
+  double rollout(const std::vector<Eigen::VectorXd>& us,
+                 std::vector<Eigen::VectorXd>& xs);
+
+  std::size_t nsamples_;  //!< Number of sampled control sequences
+  double noise_;          //!< Standard deviation of the control perturbations
+  double temperature_;    //!< Temperature of the sample weights
+  unsigned int seed_;     //!< Seed of the random number generators
+  std::vector<Eigen::VectorXd> dus_;  //!< Search direction
+  std::vector<std::vector<Eigen::VectorXd> >
+      us_samples_;  //!< Sampled control sequences
+  std::vector<std::vector<Eigen::VectorXd> >
+      xs_samples_;               //!< Rollouts of the sampled control sequences
+  std::vector<double> costs_;    //!< Total costs of the samples
+  std::vector<double> weights_;  //!< Normalized weights of the samples
+  std::vector<std::mt19937> rngs_;  //!< Random number generator per thread
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_SOLVERS_MPPI_HPP_
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_BINARY_LOG_HPP_
+#define CROCODDYL_CORE_UTILS_BINARY_LOG_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "crocoddyl/core/mathbase.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Magic number at the beginning of a binary log
+ */
+static const char BINARY_LOG_MAGIC[8] = {'C', 'R', 'O', 'C',
+                                         'L', 'O', 'G', '1'};
+
+/**
+ * @brief Fixed-size header of a record in a binary log
+ *
+ * A binary log starts with `BINARY_LOG_MAGIC`, followed by a sequence of
+ * records. Each record is made of 8-byte words: this header, and three blocks
+ * with the state trajectory, the control trajectory and the feedback gains.
+ * Each block contains the number of elements \f$n\f$, the \f$n\f$ pairs of
+ * rows and columns of the elements (as unsigned integers), and their values
+ * (as doubles, matrices are stored in row-major order). Words use the native
+ * byte order.
+ *
+ * As records are only appended, a log can be extended by a new logger, and a
+ * truncated record at the end of the file (e.g., after a crash) is ignored by
+ * the reader.
+ */
+struct BinaryLogHeader {
+  std::uint64_t size;      //!< Size of the record in bytes
+  std::uint64_t sequence;  //!< Index of the record in its logger
+  std::uint64_t time;      //!< Wall-clock time since epoch [ns]
+  std::uint64_t iter;      //!< Iteration index of the solver
+  double cost;             //!< Cost
+  double merit;            //!< Merit
+  double stop;             //!< Stopping criteria
+  double steplength;       //!< Applied step length
+  double preg;             //!< Primal-variable regularization
+  double dreg;             //!< Dual-variable regularization
+  double ffeas;            //!< Dynamic feasibility
+  double gfeas;            //!< Inequality feasibility
+  double hfeas;            //!< Equality feasibility
+};
+
+/**
+ * @brief Solver iterate read from a binary log
+ */
+struct BinaryLogRecord {
+  BinaryLogRecord()
+      : sequence(0),
+        time(0),
+        iter(0),
+        cost(0.),
+        merit(0.),
+        stop(0.),
+        steplength(0.),
+        preg(0.),
+        dreg(0.),
+        ffeas(0.),
+        gfeas(0.),
+        hfeas(0.) {}
+
+  std::size_t sequence;             //!< Index of the record in its logger
+  std::uint64_t time;               //!< Wall-clock time since epoch [ns]
+  std::size_t iter;                 //!< Iteration index of the solver
+  double cost;                      //!< Cost
+  double merit;                     //!< Merit
+  double stop;                      //!< Stopping criteria
+  double steplength;                //!< Applied step length
+  double preg;                      //!< Primal-variable regularization
+  double dreg;                      //!< Dual-variable regularization
+  double ffeas;                     //!< Dynamic feasibility
+  double gfeas;                     //!< Inequality feasibility
+  double hfeas;                     //!< Equality feasibility
+  std::vector<Eigen::VectorXd> xs;  //!< State trajectory
+  std::vector<Eigen::VectorXd> us;  //!< Control trajectory
+  std::vector<Eigen::MatrixXd> Ks;  //!< Feedback gains (if logged)
+};
+
+/**
+ * @brief Reader of binary logs
+ *
+ * It maps the log file in memory and indexes its records, so records can be
+ * read in any order without parsing the whole file. Call `reload()` to see
+ * the records appended after opening the log.
+ *
+ * \sa `CallbackBinaryLogger`
+ */
+class BinaryLogReader {
+ public:
+  /**
+   * @brief Open a binary log
+   *
+   * @param[in] filename  Path of the binary log
+   */
+  explicit BinaryLogReader(const std::string& filename);
+  ~BinaryLogReader();
+
+  /**
+   * @brief Map the binary log again to include the appended records
+   */
+  void reload();
+
+  /**
+   * @brief Read a record
+   *
+   * @param[in] i  Index of the record \f$(0\leq i \lt n)\f$
+   * @return the record
+   */
+  BinaryLogRecord read(const std::size_t i) const;
+
+  /**
+   * @brief Read a record reusing the memory of a given one
+   *
+   * @param[in] i        Index of the record \f$(0\leq i \lt n)\f$
+   * @param[out] record  Record
+   */
+  void read(const std::size_t i, BinaryLogRecord& record) const;
+
+  /**
+   * @brief Return the path of the binary log
+   */
+  const std::string& get_filename() const;
+
+  /**
+   * @brief Return the number of complete records
+   */
+  std::size_t get_nrecords() const;
+
+ private:
+  /**
+   * @brief Release the mapped memory
+   */
+  void unmap();
+
+  std::string filename_;              //!< Path of the binary log
+  const char* data_;                  //!< Mapped log
+  std::size_t size_;                  //!< Size of the mapped log
+  std::vector<char> buffer_;          //!< Log copy if mapping is unsupported
+  std::vector<std::size_t> offsets_;  //!< Offset of each record
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_BINARY_LOG_HPP_
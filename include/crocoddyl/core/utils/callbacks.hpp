@@ -10,8 +10,14 @@
 #ifndef CROCODDYL_CORE_UTILS_CALLBACKS_HPP_
 #define CROCODDYL_CORE_UTILS_CALLBACKS_HPP_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "crocoddyl/core/solver-base.hpp"
 
@@ -52,6 +58,97 @@ class CallbackVerbose : public CallbackAbstract {
   void update_header();
 };
 
+/**
+ * @brief Callback that logs the solver iterates into a binary file
+ *
+ * It copies the iterates (i.e., the state and control trajectories, and the
+ * feedback gains of DDP-based solvers) into a preallocated single-producer
+ * single-consumer queue. A background thread drains this queue into the log
+ * file, so the solver does not wait for the file system. The thread sleeps
+ * until a record is queued, so an idle logger does not wake up the CPU. If
+ * the queue is full,
+ * the iterate is dropped instead of blocking the solver. The records are
+ * appended to the log file, then a log can collect several solves and
+ * processes. The log can be read with `BinaryLogReader`, and its format is
+ * described in `BinaryLogHeader`.
+ */
+class CallbackBinaryLogger : public CallbackAbstract {
+ public:
+  /**
+   * @brief Initialize the binary logger
+   *
+   * @param[in] filename    Path of the binary log
+   * @param[in] capacity    Number of records in the queue (default 64)
+   * @param[in] with_gains  Log the feedback gains (default true)
+   */
+  explicit CallbackBinaryLogger(const std::string& filename,
+                                const std::size_t capacity = 64,
+                                const bool with_gains = true);
+  ~CallbackBinaryLogger() override;
+
+  void operator()(SolverAbstract& solver) override;
+
+  /**
+   * @brief Wait until the queued records are written in the log
+   */
+  void flush();
+
+  /**
+   * @brief Return the path of the binary log
+   */
+  const std::string& get_filename() const;
+
+  /**
+   * @brief Return the number of records in the queue
+   */
+  std::size_t get_capacity() const;
+
+  /**
+   * @brief Return the number of records written in the log
+   *
+   * Once the logger is flushed, the written and dropped records add up to the
+   * number of logged iterations.
+   */
+  std::size_t get_nrecords() const;
+
+  /**
+   * @brief Return the number of records dropped because the queue was full or
+   * their write failed
+   */
+  std::size_t get_ndropped() const;
+
+  /**
+   * @brief Indicate if the feedback gains are logged
+   */
+  bool get_with_gains() const;
+
+  /**
+   * @brief Modify the flag that indicates if the feedback gains are logged
+   */
+  void set_with_gains(const bool with_gains);
+
+ private:
+  /**
+   * @brief Drain the queue into the log file until the logger is destroyed
+   */
+  void run();
+
+  std::string filename_;                   //!< Path of the binary log
+  std::FILE* file_;                        //!< Log file
+  bool with_gains_;                        //!< Log the feedback gains
+  std::vector<std::vector<char> > slots_;  //!< Queued records
+  std::atomic<std::size_t> head_;          //!< Number of queued records
+  std::atomic<std::size_t> tail_;          //!< Number of drained records
+  std::atomic<std::size_t> nwritten_;      //!< Number of written records
+  std::atomic<std::size_t> ndropped_;      //!< Number of dropped records
+  std::size_t sequence_;                   //!< Index of the next record
+  std::atomic<bool> running_;              //!< Keep draining the queue
+  std::mutex mutex_;                       //!< Guards the sleeps
+  std::condition_variable queued_;         //!< Signals the queued records
+  std::condition_variable drained_;        //!< Signals the drained records
+  std::thread thread_;                     //!< Background writer
+};
+
 }  // namespace crocoddyl
 
 #endif  // CROCODDYL_CORE_UTILS_CALLBACKS_HPP_
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_SENSITIVITY_HPP_
+#define CROCODDYL_CORE_UTILS_SENSITIVITY_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "crocoddyl/core/mpc/parameters.hpp"
+#include "crocoddyl/core/solvers/ddp.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Sensitivities of the solution of a DDP solver
+ *
+ * It computes the derivatives of the optimal trajectory with respect to the
+ * initial state and the registered parameters of the problem, without solving
+ * perturbed problems. For this, it reuses the last backward pass of the
+ * solver, i.e., the feedback gains \f$\mathbf{K}_t\f$, the Hessians of the
+ * Value function \f$\mathbf{V}_{\mathbf{xx},t}\f$ and the Hessians
+ * \f$\mathbf{Q}_{\mathbf{uu},t}\f$, whose Cholesky decompositions are
+ * recomputed. The box and intro solvers are not supported, as their gains are
+ * not the ones of the unconstrained Hessians \f$\mathbf{Q}_{\mathbf{uu},t}\f$.
+ *
+ * The derivatives with respect to the initial state follow the closed-loop
+ * dynamics of the linearized problem:
+ * \f{eqnarray*}{
+ * \frac{\partial\mathbf{u}_t}{\partial\mathbf{x}_0} &=&
+ * -\mathbf{K}_t\frac{\partial\mathbf{x}_t}{\partial\mathbf{x}_0},\\
+ * \frac{\partial\mathbf{x}_{t+1}}{\partial\mathbf{x}_0} &=&
+ * \mathbf{f_x}\frac{\partial\mathbf{x}_t}{\partial\mathbf{x}_0} +
+ * \mathbf{f_u}\frac{\partial\mathbf{u}_t}{\partial\mathbf{x}_0},
+ * \f}
+ * where the derivatives of the states are expressed in their tangent spaces.
+ *
+ * The parameters perturb the gradients of the costs and the dynamics of the
+ * nodes. Their derivatives \f$\boldsymbol{\ell}_{\mathbf{xp}}\f$,
+ * \f$\boldsymbol{\ell}_{\mathbf{up}}\f$ and \f$\mathbf{f_p}\f$ are computed
+ * by finite differences of the node models, and then an extra backward and
+ * forward sweep with the gains and Hessians of the solver gives the
+ * derivatives of the trajectory. This sweep handles all the parameters at once.
+ *
+ * Note that the sensitivities are the ones of the Gauss-Newton approximation
+ * used by the solver, and they are computed at the current solution. They are
+ * exact for linear-quadratic problems and accurate for converged solutions.
+ *
+ * \sa `compute()`, `get_dxs_dx0()`, `get_dxs_dp()`
+ */
+class SolutionSensitivity {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief Initialize the sensitivities of a solver
+   *
+   * @param[in] solver  DDP or FDDP solver
+   * @param[in] params  Registered parameters of the solver's problem (default
+   * none)
+   */
+  explicit SolutionSensitivity(
+      std::shared_ptr<SolverDDP> solver,
+      std::shared_ptr<ProblemParameters> params = nullptr);
+  ~SolutionSensitivity();
+
+  /**
+   * @brief Compute the sensitivities of the current solution
+   *
+   * The pending changes of the parameters are written into the models, and
+   * the problem's datas are evaluated at the solution. By default, the gains
+   * and Hessians of the last backward pass of the solver are reused, which are
+   * the ones of the solution for converged solvers. It throws if a Hessian
+   * \f$\mathbf{Q}_{\mathbf{uu},t}\f$ is not positive definite.
+   *
+   * @param[in] recalc  true for running a backward pass at the solution
+   * (default false)
+   */
+  void compute(const bool recalc = false);
+
+  /**
+   * @brief Return the derivatives of the states with respect to the initial
+   * state (size \f$T+1\f$)
+   */
+  const std::vector<Eigen::MatrixXd>& get_dxs_dx0() const;
+
+  /**
+   * @brief Return the derivatives of the controls with respect to the initial
+   * state (size \f$T\f$)
+   */
+  const std::vector<Eigen::MatrixXd>& get_dus_dx0() const;
+
+  /**
+   * @brief Return the derivatives of the states with respect to the
+   * parameters (size \f$T+1\f$)
+   *
+   * A column is the derivative with respect to a column of the parameter
+   * table, i.e., the parameter is perturbed in all the nodes.
+   */
+  const std::vector<Eigen::MatrixXd>& get_dxs_dp() const;
+
+  /**
+   * @brief Return the derivatives of the controls with respect to the
+   * parameters (size \f$T\f$)
+   */
+  const std::vector<Eigen::MatrixXd>& get_dus_dp() const;
+
+  /**
+   * @brief Return the solver
+   */
+  const std::shared_ptr<SolverDDP>& get_solver() const;
+
+  /**
+   * @brief Return the registered parameters
+   */
+  const std::shared_ptr<ProblemParameters>& get_parameters() const;
+
+  /**
+   * @brief Return the disturbance used by the finite differences of the
+   * parameters
+   */
+  double get_disturbance() const;
+
+  /**
+   * @brief Modify the disturbance used by the finite differences of the
+   * parameters
+   */
+  void set_disturbance(const double disturbance);
+
+ private:
+  /**
+   * @brief Resize the data when the problem or the parameters have changed
+   */
+  void resizeData();
+
+  /**
+   * @brief Compute the derivatives of the node models with respect to the
+   * parameters
+   */
+  void computeParameterDerivatives();
+
+  /**
+   * @brief Evaluate a node model at the solution
+   */
+  void calcNode(const std::size_t t);
+
+  std::shared_ptr<SolverDDP> solver_;          //!< DDP solver
+  std::shared_ptr<ProblemParameters> params_;  //!< Registered parameters
+  double disturbance_;  //!< Disturbance of the finite differences
+  std::vector<Eigen::MatrixXd> dxs_dx0_;  //!< States w.r.t. the initial state
+  std::vector<Eigen::MatrixXd> dus_dx0_;  //!< Controls w.r.t. the initial state
+  std::vector<Eigen::MatrixXd> dxs_dp_;   //!< States w.r.t. the parameters
+  std::vector<Eigen::MatrixXd> dus_dp_;   //!< Controls w.r.t. the parameters
+  std::vector<Eigen::MatrixXd> Lxp_;  //!< Derivatives of Lx w.r.t. the params
+  std::vector<Eigen::MatrixXd> Lup_;  //!< Derivatives of Lu w.r.t. the params
+  std::vector<Eigen::MatrixXd> Fp_;   //!< Dynamics w.r.t. the parameters
+  std::vector<Eigen::MatrixXd> Vxp_;  //!< Derivatives of Vx w.r.t. the params
+  std::vector<Eigen::MatrixXd> kp_;   //!< Feed-forward terms of the parameters
+  std::vector<Eigen::LLT<Eigen::MatrixXd> > Quu_llt_;  //!< Cholesky of Quu
+  Eigen::MatrixXd Wp_;     //!< Derivatives of the next Vx w.r.t. the params
+  Eigen::MatrixXd Qup_;    //!< Derivatives of Qu w.r.t. the params
+  Eigen::VectorXd row_;    //!< Values of the parameters of a node
+  Eigen::VectorXd xnext_;  //!< Nominal next state of a node
+  Eigen::VectorXd Lx_;     //!< Nominal cost gradient w.r.t. the state
+  Eigen::VectorXd Lu_;     //!< Nominal cost gradient w.r.t. the control
+  Eigen::VectorXd dx_;     //!< Tangent-space displacement of the next state
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_SENSITIVITY_HPP_
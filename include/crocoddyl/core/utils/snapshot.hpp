@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_SNAPSHOT_HPP_
+#define CROCODDYL_CORE_UTILS_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "crocoddyl/core/solver-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Magic number at the beginning of a snapshot
+ */
+static const char SNAPSHOT_MAGIC[8] = {'C', 'R', 'O', 'C', 'S', 'N', 'P', '1'};
+
+/**
+ * @brief Version of the snapshot format written by `saveSnapshot()`
+ */
+static const std::uint64_t SNAPSHOT_VERSION = 1;
+
+/**
+ * @brief Fixed-size header of a snapshot
+ *
+ * A snapshot starts with `SNAPSHOT_MAGIC`, followed by this header, the
+ * initial state, a table with a `SnapshotNode` per node (the terminal node is
+ * the last one), and the blocks of the nodes. All the fields are 8-byte words
+ * in the native byte order, and the blocks are stored as doubles (matrices in
+ * row-major order). As the blocks are located by byte offsets, a snapshot
+ * can be read in place from a mapped file.
+ */
+struct SnapshotHeader {
+  std::uint64_t version;  //!< Version of the snapshot format
+  std::uint64_t size;     //!< Size of the snapshot in bytes
+  std::uint64_t T;        //!< Number of running nodes
+  std::uint64_t nx;       //!< Dimension of the initial state
+  std::uint64_t flags;    //!< Feasibility (bit 0) and gains (bit 1) flags
+  std::uint64_t iter;     //!< Number of solver iterations
+  double cost;            //!< Cost
+  double merit;           //!< Merit
+  double stop;            //!< Stopping criteria
+  double preg;            //!< Primal-variable regularization
+  double dreg;            //!< Dual-variable regularization
+  double ffeas;           //!< Dynamic feasibility
+};
+
+/**
+ * @brief Entry of the node table of a snapshot
+ *
+ * It contains the structure of the node's action model, which is used to
+ * check that a snapshot is restored in an equivalent problem, and the byte
+ * offsets of the node's blocks (zero if the block is not stored).
+ */
+struct SnapshotNode {
+  std::uint64_t model;  //!< Fingerprint of the action model type
+  std::uint64_t nx;     //!< State dimension
+  std::uint64_t ndx;    //!< State rate dimension
+  std::uint64_t nu;     //!< Control dimension
+  std::uint64_t nr;     //!< Cost residual dimension
+  std::uint64_t ng;     //!< Inequality constraint dimension
+  std::uint64_t nh;     //!< Equality constraint dimension
+  std::uint64_t x;      //!< Offset of the state
+  std::uint64_t u;      //!< Offset of the control
+  std::uint64_t K;      //!< Offset of the feedback gain
+  std::uint64_t k;      //!< Offset of the feed-forward term
+};
+
+/**
+ * @brief Save a snapshot of a solver
+ *
+ * It stores the initial state of the solver's problem, the structure of its
+ * action models, the state and control trajectories and the solver status.
+ * For DDP-based solvers, it also stores the feedback gains and feed-forward
+ * terms. The snapshot is written to a temporary file which is then renamed,
+ * so an existing snapshot is never left half-written.
+ *
+ * The parameters of the action models are not stored, as they are defined by
+ * the concrete models. Instead, the snapshot is restored in a problem built
+ * with the same code, and the fingerprints of the model types guarantee that
+ * both problems have the same structure.
+ *
+ * @param[in] filename  Path of the snapshot
+ * @param[in] solver    Solver
+ * \sa `SnapshotReader`
+ */
+void saveSnapshot(const std::string& filename, const SolverAbstract& solver);
+
+/**
+ * @brief Reader of snapshots
+ *
+ * It maps the snapshot file in memory, and the trajectories and gains are
+ * returned as views of the mapped file. In consequence, opening a snapshot
+ * does not depend on the horizon length, and only the accessed nodes are read
+ * from disk.
+ *
+ * \sa `saveSnapshot()`, `restore()`
+ */
+class SnapshotReader {
+ public:
+  typedef MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+
+  /**
+   * @brief Open a snapshot
+   *
+   * @param[in] filename  Path of the snapshot
+   */
+  explicit SnapshotReader(const std::string& filename);
+  ~SnapshotReader();
+
+  /**
+   * @brief Check if the snapshot can be restored in a problem
+   *
+   * Both problems need to have the same horizon, and their action models need
+   * to have the same type and dimensions.
+   *
+   * @param[in] problem  shooting problem
+   */
+  bool is_compatible(const ShootingProblem& problem) const;
+
+  /**
+   * @brief Restore the snapshot in a solver
+   *
+   * It sets the initial state of the solver's problem, the state and control
+   * trajectories, the regularization values and, if they were stored and the
+   * solver is DDP-based, the feedback gains and feed-forward terms.
+   *
+   * @param[in] solver  solver whose problem is compatible with the snapshot
+   */
+  void restore(SolverAbstract& solver) const;
+
+  /**
+   * @brief Return the initial state
+   */
+  Eigen::Map<const Eigen::VectorXd> get_x0() const;
+
+  /**
+   * @brief Return the state of a node
+   *
+   * @param[in] t  Index of the node \f$(0\leq t \leq T)\f$
+   */
+  Eigen::Map<const Eigen::VectorXd> get_x(const std::size_t t) const;
+
+  /**
+   * @brief Return the control of a running node
+   *
+   * @param[in] t  Index of the node \f$(0\leq t \lt T)\f$
+   */
+  Eigen::Map<const Eigen::VectorXd> get_u(const std::size_t t) const;
+
+  /**
+   * @brief Return the feedback gain of a running node
+   *
+   * @param[in] t  Index of the node \f$(0\leq t \lt T)\f$
+   */
+  Eigen::Map<const MatrixXdRowMajor> get_K(const std::size_t t) const;
+
+  /**
+   * @brief Return the feed-forward term of a running node
+   *
+   * @param[in] t  Index of the node \f$(0\leq t \lt T)\f$
+   */
+  Eigen::Map<const Eigen::VectorXd> get_k(const std::size_t t) const;
+
+  /**
+   * @brief Return the node table entry of a node
+   *
+   * @param[in] t  Index of the node \f$(0\leq t \leq T)\f$
+   */
+  const SnapshotNode& get_node(const std::size_t t) const;
+
+  /**
+   * @brief Return the header of the snapshot
+   */
+  const SnapshotHeader& get_header() const;
+
+  /**
+   * @brief Return the path of the snapshot
+   */
+  const std::string& get_filename() const;
+
+  /**
+   * @brief Return the number of running nodes
+   */
+  std::size_t get_T() const;
+
+  /**
+   * @brief Return true if the state trajectory is feasible
+   */
+  bool get_is_feasible() const;
+
+  /**
+   * @brief Return true if the snapshot has the feedback gains
+   */
+  bool get_has_gains() const;
+
+ private:
+  /**
+   * @brief Release the mapped memory
+   */
+  void unmap();
+
+  /**
+   * @brief Return the block at a given offset
+   */
+  const double* block(const std::uint64_t offset) const;
+
+  std::string filename_;       //!< Path of the snapshot
+  const char* data_;           //!< Mapped snapshot
+  std::size_t size_;           //!< Size of the mapped snapshot
+  std::vector<char> buffer_;   //!< Snapshot copy if mapping is unsupported
+  SnapshotHeader header_;      //!< Header of the snapshot
+  const SnapshotNode* nodes_;  //!< Node table
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_SNAPSHOT_HPP_
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_SOLVER_POOL_HPP_
+#define CROCODDYL_CORE_UTILS_SOLVER_POOL_HPP_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "crocoddyl/core/solver-base.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Result of a solve run by the solver pool
+ */
+struct SolverPoolResult {
+  SolverPoolResult()
+      : converged(false),
+        is_feasible(false),
+        iter(0),
+        cost(0.),
+        stop(0.),
+        ffeas(0.),
+        time(0.),
+        worker(0) {}
+
+  bool converged;                   //!< True if the solver converged
+  bool is_feasible;                 //!< True if the solution is feasible
+  std::size_t iter;                 //!< Number of solver iterations
+  double cost;                      //!< Total cost of the solution
+  double stop;                      //!< Stopping criteria of the solution
+  double ffeas;                     //!< Dynamic feasibility of the solution
+  double time;                      //!< Duration of the solve in seconds
+  std::size_t worker;               //!< Index of the worker that solved it
+  std::vector<Eigen::VectorXd> xs;  //!< State trajectory (size T+1)
+  std::vector<Eigen::VectorXd> us;  //!< Control trajectory (size T)
+};
+
+/**
+ * @brief Pool of solvers for many independent shooting problems
+ *
+ * It solves a batch of independent problems, e.g., multi-start initial
+ * guesses, footstep candidates or dataset generation, where the throughput
+ * matters more than the latency. Whole solves are scheduled dynamically across
+ * the workers, instead of parallelizing the nodes of each problem. For this
+ * reason, the problems of the workers run their nodes in a single thread, i.e.,
+ * the nested parallelism is disabled.
+ *
+ * Each worker owns a copy of the problem, which shares the action models of
+ * the batch but has its own datas, and a solver created by the solver factory.
+ * They are allocated once per horizon and state dimension, and they are reused
+ * by the following jobs and batches. Before each job, the initial state and
+ * the action models of the job's problem are copied into the worker's problem.
+ * Only the nodes whose action model has changed allocate a new data, so a
+ * batch of initial guesses for the same problem does not allocate memory.
+ * The worker's problems are first synchronized with the batch by
+ * `allocate()`, so the models of previous batches are released in the calling
+ * thread, and the jobs only replace models that are owned by the batch.
+ *
+ * The solver factory is called in the calling thread of `solve()` or
+ * `allocate()`, and it configures the solvers, e.g., their thresholds, time
+ * budget or callbacks.
+ *
+ * \sa `solve()`, `get_results()`
+ */
+class SolverPool {
+ public:
+  typedef std::function<std::shared_ptr<SolverAbstract>(
+      std::shared_ptr<ShootingProblem>)>
+      SolverFactory;
+
+  /**
+   * @brief Initialize the solver pool with FDDP solvers
+   *
+   * @param[in] nworkers  Number of workers (default is the number of threads
+   * of the multithreading support)
+   */
+  explicit SolverPool(const std::size_t nworkers = 0);
+
+  /**
+   * @brief Initialize the solver pool
+   *
+   * @param[in] factory   Function that creates a solver for a given problem
+   * @param[in] nworkers  Number of workers (default is the number of threads
+   * of the multithreading support)
+   */
+  explicit SolverPool(SolverFactory factory, const std::size_t nworkers = 0);
+  ~SolverPool();
+
+  /**
+   * @brief Solve a batch of independent problems
+   *
+   * The number of jobs \f$K\f$ is the largest size of `problems`, `init_xs`
+   * and `init_us`. A single problem or initial guess is shared by all the
+   * jobs, and empty initial guesses use the default ones of the solvers.
+   *
+   * @param[in] problems     shooting problems (size 1 or \f$K\f$)
+   * @param[in] init_xs      initial guesses of the state trajectories (size 0,
+   * 1 or \f$K\f$)
+   * @param[in] init_us      initial guesses of the control trajectories (size
+   * 0, 1 or \f$K\f$)
+   * @param[in] maxiter      maximum allowed number of iterations per job
+   * (default 100)
+   * @param[in] is_feasible  true if the initial guesses are feasible (default
+   * false)
+   * @param[in] init_reg     initial guess for the regularization value
+   * @return the results of the jobs (size \f$K\f$)
+   */
+  const std::vector<SolverPoolResult>& solve(
+      const std::vector<std::shared_ptr<ShootingProblem> >& problems,
+      const std::vector<std::vector<Eigen::VectorXd> >& init_xs =
+          std::vector<std::vector<Eigen::VectorXd> >(),
+      const std::vector<std::vector<Eigen::VectorXd> >& init_us =
+          std::vector<std::vector<Eigen::VectorXd> >(),
+      const std::size_t maxiter = 100, const bool is_feasible = false,
+      const double init_reg = NAN);
+
+  /**
+   * @brief Allocate the problems and solvers of the workers
+   *
+   * Each worker allocates a problem and a solver for each horizon and state
+   * dimension of the given problems that it does not have yet. Then, the
+   * worker's problems are synchronized with the first given problem of their
+   * dimension. This function is called by `solve()`, and it can be called
+   * beforehand to allocate the solvers outside the time-critical code.
+   *
+   * @param[in] problems  shooting problems
+   */
+  void allocate(const std::vector<std::shared_ptr<ShootingProblem> >& problems);
+
+  /**
+   * @brief Return the results of the last batch
+   */
+  const std::vector<SolverPoolResult>& get_results() const;
+
+  /**
+   * @brief Return the number of workers
+   */
+  std::size_t get_nworkers() const;
+
+  /**
+   * @brief Return the number of solvers allocated by the workers
+   */
+  std::size_t get_nsolvers() const;
+
+  /**
+   * @brief Return the solvers allocated by a worker
+   *
+   * @param[in] w  index of the worker
+   */
+  const std::vector<std::shared_ptr<SolverAbstract> >& get_solvers(
+      const std::size_t w) const;
+
+  /**
+   * @brief Return the duration of the last batch in seconds
+   */
+  double get_time() const;
+
+  /**
+   * @brief Modify the number of workers
+   *
+   * The solvers of the workers are kept, so they are reused if the number of
+   * workers increases again.
+   */
+  void set_nworkers(const std::size_t nworkers);
+
+ private:
+  /**
+   * @brief Problems and solvers of a worker, one per problem dimension
+   */
+  struct Worker {
+    std::vector<std::shared_ptr<ShootingProblem> > problems;
+    std::vector<std::shared_ptr<SolverAbstract> > solvers;
+  };
+
+  /**
+   * @brief Return the worker's solver whose problem has the dimension of the
+   * given problem, or -1 if it does not exist
+   */
+  static int findSolver(const Worker& worker,
+                        const std::shared_ptr<ShootingProblem>& problem);
+
+  /**
+   * @brief Copy the initial state and the action models of a problem into a
+   * worker's problem
+   *
+   * Only the nodes whose action model has changed allocate a new data.
+   */
+  static void syncProblem(ShootingProblem& worker_problem,
+                          const ShootingProblem& problem);
+
+  /**
+   * @brief Run a job with a worker
+   */
+  void solveJob(const std::size_t w, const std::size_t k,
+                const std::shared_ptr<ShootingProblem>& problem,
+                const std::vector<Eigen::VectorXd>& init_xs,
+                const std::vector<Eigen::VectorXd>& init_us,
+                const std::size_t maxiter, const bool is_feasible,
+                const double init_reg);
+
+  SolverFactory factory_;                  //!< Solver factory
+  std::size_t nworkers_;                   //!< Number of workers
+  std::vector<Worker> workers_;            //!< Problems and solvers per worker
+  std::vector<SolverPoolResult> results_;  //!< Results of the last batch
+  double time_;                            //!< Duration of the last batch
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_SOLVER_POOL_HPP_
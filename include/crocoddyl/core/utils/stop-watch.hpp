@@ -25,21 +25,54 @@
 #ifndef CROCODDYL_CORE_UTILS_STOPWATCH_H_
 #define CROCODDYL_CORE_UTILS_STOPWATCH_H_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <iostream>
 #include <limits>
-#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #ifndef WIN32
 /* The classes below are exported */
 #pragma GCC visibility push(default)
 #endif
 
-#define START_PROFILER(name) \
-  getProfiler().profiler_status() ? getProfiler().start(name) : void()
-#define STOP_PROFILER(name) \
-  getProfiler().profiler_status() ? getProfiler().stop(name) : void()
+// The region ID is interned once per call site, then the profiled code only
+// touches the records of the calling thread
+#define START_PROFILER(name)                                                 \
+  do {                                                                       \
+    crocoddyl::Stopwatch& crocoddyl_profiler_ = crocoddyl::getProfiler();    \
+    if (crocoddyl_profiler_.profiler_status()) {                             \
+      static const std::size_t crocoddyl_profiler_id_ =                      \
+          crocoddyl_profiler_.intern(name);                                  \
+      crocoddyl_profiler_.start(crocoddyl_profiler_id_);                     \
+    }                                                                        \
+  } while (0)
+#define START_PROFILER_NODE(name, node)                                      \
+  do {                                                                       \
+    crocoddyl::Stopwatch& crocoddyl_profiler_ = crocoddyl::getProfiler();    \
+    if (crocoddyl_profiler_.profiler_status()) {                             \
+      static const std::size_t crocoddyl_profiler_id_ =                      \
+          crocoddyl_profiler_.intern(name);                                  \
+      crocoddyl_profiler_.start(crocoddyl_profiler_id_,                      \
+                                static_cast<long>(node));                    \
+    }                                                                        \
+  } while (0)
+#define STOP_PROFILER(name)                                                  \
+  do {                                                                       \
+    crocoddyl::Stopwatch& crocoddyl_profiler_ = crocoddyl::getProfiler();    \
+    if (crocoddyl_profiler_.profiler_status()) {                             \
+      static const std::size_t crocoddyl_profiler_id_ =                      \
+          crocoddyl_profiler_.intern(name);                                  \
+      crocoddyl_profiler_.stop(crocoddyl_profiler_id_);                      \
+    }                                                                        \
+  } while (0)
 
 #define STOP_WATCH_MAX_NAME_LENGTH 60
 #define STOP_WATCH_TIME_WIDTH 10
@@ -150,29 +183,47 @@ enum StopwatchMode {
     Same as above, you can redirect the output by providing a std::ostream&
     parameter.
 
+    Each ID string is interned into a region ID, and the time measurements
+    are accumulated in records owned by the calling thread. Then, profiled
+    code running in parallel (e.g., inside OpenMP loops) does not share any
+    lock or map, and the START_PROFILER / STOP_PROFILER macros intern their
+    region once per call site. Measurements use a monotonic clock with
+    nanosecond resolution, and each region keeps a log-linear histogram from
+    which percentiles are estimated:
+
+    @code
+    swatch.get_percentile_time("Code ID", 99.);
+    @endcode
+
+    Regions started by the same thread are nested, i.e., stopping a region
+    closes the regions opened inside it. Finally, the trace of each thread can
+    be recorded in a fixed-size ring buffer and exported in the Chrome-trace
+    JSON format, which can be inspected with Perfetto or chrome://tracing:
+
+    @code
+    swatch.enable_trace();
+    // Profiled code
+    swatch.export_chrome_trace("trace.json");
+    @endcode
+
+    Reset and report functions, as well as the trace export, expect that the
+    profiled code is not running.
 */
 class Stopwatch {
- protected:
-  struct PerformanceData;
-
  public:
   struct Watcher {
     Stopwatch &w;
     std::string n;
-    PerformanceData *p;
+    std::size_t id;
 
-    Watcher(Stopwatch &_w, std::string _n, PerformanceData *_p)
-        : w(_w), n(_n), p(_p) {}
+    Watcher(Stopwatch &_w, std::string _n, std::size_t _id)
+        : w(_w), n(_n), id(_id) {}
     inline void start() {
-      if (w.profiler_active) _start();
+      if (w.profiler_status()) w.start(id);
     }
     inline void stop() {
-      if (w.profiler_active) _stop();
+      if (w.profiler_status()) w.stop(id);
     }
-
-   private:
-    void _start();
-    void _stop();
   };
 
   /** @brief Constructor */
@@ -188,7 +239,25 @@ class Stopwatch {
   void disable_profiler();
 
   /** @brief Return if the profiler is enable or disable **/
-  inline bool profiler_status() { return profiler_active; }
+  inline bool profiler_status() {
+    return profiler_active.load(std::memory_order_relaxed);
+  }
+
+  /** @brief Enable the trace recording with a given number of events per
+      thread
+
+      It can be called while the profiled code is running. Changing the
+      capacity discards the recorded events, and the ring buffers of the
+      previous capacities are kept until the stopwatch is destroyed. **/
+  void enable_trace(const std::size_t capacity = 65536);
+
+  /** @brief Disable the trace recording **/
+  void disable_trace();
+
+  /** @brief Return if the trace recording is enable or disable **/
+  inline bool trace_status() {
+    return trace_active.load(std::memory_order_relaxed);
+  }
 
   /** @brief Tells if a performance with a certain ID exists */
   bool performance_exists(std::string perf_name);
@@ -199,12 +268,22 @@ class Stopwatch {
   /** @brief create a Start the stopwatch related to a certain piece of code */
   Watcher watcher(const std::string &perf_name);
 
+  /** @brief Return the region ID of a certain piece of code */
+  std::size_t intern(const std::string &perf_name);
+
   /** @brief Start the stopwatch related to a certain piece of code */
   void start(const std::string &perf_name);
 
+  /** @brief Start the stopwatch related to a certain region ID, the node
+      index (if any) is reported in the trace */
+  void start(const std::size_t id, const long node = -1);
+
   /** @brief Stops the stopwatch related to a certain piece of code */
   void stop(const std::string &perf_name);
 
+  /** @brief Stops the stopwatch related to a certain region ID */
+  void stop(const std::size_t id);
+
   /** @brief Stops the stopwatch related to a certain piece of code */
   void pause(const std::string &perf_name);
 
@@ -221,6 +300,12 @@ class Stopwatch {
   /** @brief Dump the data of all the performance records */
   void report_all(int precision = 2, std::ostream &output = std::cout);
 
+  /** @brief Export the recorded trace in the Chrome-trace JSON format */
+  void export_chrome_trace(std::ostream &output);
+
+  /** @brief Export the recorded trace in the Chrome-trace JSON format */
+  void export_chrome_trace(const std::string &filename);
+
   /** @brief Returns total execution time of a certain performance */
   long double get_total_time(const std::string &perf_name);
 
@@ -233,9 +318,17 @@ class Stopwatch {
   /** @brief Returns maximum execution time of a certain performance */
   long double get_max_time(const std::string &perf_name);
 
+  /** @brief Returns the estimated percentile (in [0, 100]) of the execution
+      time of a certain performance */
+  long double get_percentile_time(const std::string &perf_name,
+                                  const double percentile);
+
   /** @brief Return last measurement of a certain performance */
   long double get_last_time(const std::string &perf_name);
 
+  /** @brief Returns the number of measurements of a certain performance */
+  std::size_t get_nsamples(const std::string &perf_name);
+
   /** @brief Return the time since the start of the last measurement of a given
       performance.
   */
@@ -251,37 +344,36 @@ class Stopwatch {
   /** @brief Take time, depends on mode. */
   long double take_time();
 
+  /** @brief Return the monotonic time in nanoseconds */
+  static std::uint64_t take_time_ns();
+
  protected:
-  /** @brief Struct to hold the performance data */
-  struct PerformanceData {
-    PerformanceData()
-        : clock_start(0),
-          total_time(0),
-          min_time(std::numeric_limits<long double>::max()),
-          max_time(std::numeric_limits<long double>::min()),
-          last_time(0),
-          paused(false),
-          stops(0) {}
-
-    long double clock_start;  //!< Start time
-    long double total_time;   //!< Cumulative total time
-    long double min_time;     //!< Minimum time
-    long double max_time;     //!< Maximum time
-    long double last_time;    //!< Last time
-    bool paused;  //!< Tells if this performance has been paused, only for
-                  //!< internal use
-    int stops;    //!< How many cycles have been this stopwatch executed?
-  };
+  struct PerformanceData;
+  struct ThreadRecords;
+  struct PerformanceSummary;
+
+  /** @brief Return the records of the calling thread */
+  ThreadRecords &get_thread_records();
 
-  PerformanceData &get_or_create_perf(const std::string &perf_name);
+  /** @brief Return the region ID of an existing performance */
+  std::size_t get_id(const std::string &perf_name);
 
-  void stop_perf(PerformanceData &perf_info, long double clock_end);
+  /** @brief Merge the records of all the threads for a given region */
+  void summarize(const std::size_t id, PerformanceSummary &summary);
 
   bool active;         //!< Flag to hold the clock's status
   StopwatchMode mode;  //!< Time taking mode
-  std::map<std::string, PerformanceData>
-      *records_of;       //!< Dynamic collection of performance data
-  bool profiler_active;  //!< Indicates if the profiler is enabled
+  std::atomic<bool> profiler_active;  //!< Indicates if the profiler is enabled
+  std::atomic<bool> trace_active;     //!< Indicates if the trace is recorded
+  std::size_t trace_capacity;  //!< Number of trace events per thread
+  std::uint64_t serial;  //!< Unique number used by the thread-local caches
+  std::uint64_t origin;  //!< Time origin of the trace [ns]
+  std::mutex mutex;      //!< Guards the names and the thread records
+  std::vector<std::string> names;  //!< Name of each region ID
+  std::unordered_map<std::string, std::size_t>
+      ids;  //!< Region ID of each name
+  std::vector<std::unique_ptr<ThreadRecords> >
+      records_of;  //!< Performance data of each thread
 };
 
 Stopwatch &getProfiler();
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_CORE_UTILS_TRIPLE_BUFFER_HPP_
+#define CROCODDYL_CORE_UTILS_TRIPLE_BUFFER_HPP_
+
+#include <atomic>
+
+namespace crocoddyl {
+
+/**
+ * @brief Lock-free single-producer / single-consumer buffer
+ *
+ * It holds three slots of type `T`: the back slot owned by the writer, the
+ * front slot owned by the reader, and a middle slot used for the handoff. The
+ * writer fills `back()` and calls `publish()`, which swaps the back and middle
+ * slots. The reader calls `update()`, which swaps the middle and front slots
+ * only if a new value was published. Neither side waits for the other and no
+ * memory is allocated after `reset()`, so it can be used to exchange
+ * trajectories between a solver thread and a real-time control thread.
+ *
+ * Only one thread can write and only one thread can read.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() : state_(1), back_(0), front_(2) {}
+
+  /**
+   * @brief Initialize the three slots with a given value
+   *
+   * @param[in] value  Value used to allocate the slots
+   */
+  explicit TripleBuffer(const T& value) : state_(1), back_(0), front_(2) {
+    reset(value);
+  }
+
+  /**
+   * @brief Reset the three slots to a given value
+   *
+   * This function is not thread-safe and must be called before the writer and
+   * reader threads start.
+   *
+   * @param[in] value  Value used to allocate the slots
+   */
+  void reset(const T& value) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      buffers_[i] = value;
+    }
+    state_.store(1, std::memory_order_relaxed);
+    back_ = 0;
+    front_ = 2;
+  }
+
+  /**
+   * @brief Return the slot owned by the writer
+   */
+  T& back() { return buffers_[back_]; }
+
+  /**
+   * @brief Publish the back slot to the reader
+   *
+   * After this call, `back()` returns the slot that was previously in the
+   * middle.
+   */
+  void publish() {
+    back_ = state_.exchange(back_ | fresh_bit, std::memory_order_acq_rel) &
+            index_mask;
+  }
+
+  /**
+   * @brief Fetch the last published slot
+   *
+   * @return true if a new value has been published since the last call
+   */
+  bool update() {
+    if (!(state_.load(std::memory_order_relaxed) & fresh_bit)) {
+      return false;
+    }
+    front_ = state_.exchange(front_, std::memory_order_acq_rel) & index_mask;
+    return true;
+  }
+
+  /**
+   * @brief Return the slot owned by the reader
+   */
+  const T& front() const { return buffers_[front_]; }
+
+ private:
+  static const unsigned fresh_bit = 4;   //!< New value flag
+  static const unsigned index_mask = 3;  //!< Mask of the middle index
+
+  T buffers_[3];                 //!< Three slots
+  std::atomic<unsigned> state_;  //!< Middle index and new value flag
+  unsigned back_;                //!< Index of the writer slot
+  unsigned front_;               //!< Index of the reader slot
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_CORE_UTILS_TRIPLE_BUFFER_HPP_
@@ -227,8 +227,10 @@ void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::calcDiff(
   d->Fx.leftCols(nv).noalias() = -a_partial_dtau * d->pinocchio.dtau_dq;
   d->Fx.rightCols(nv).noalias() = -a_partial_dtau * d->pinocchio.dtau_dv;
   d->Fx.noalias() -= a_partial_da * d->multibody.contacts->da0_dx.topRows(nc);
-  d->Fx.noalias() += a_partial_dtau * d->multibody.actuation->dtau_dx;
-  d->Fu.noalias() = a_partial_dtau * d->multibody.actuation->dtau_du;
+  actuation_->multiplyByStateJacobian(d->multibody.actuation, a_partial_dtau,
+                                      d->Fx, addto);
+  actuation_->multiplyByControlJacobian(d->multibody.actuation, a_partial_dtau,
+                                        d->Fu);
   d->multibody.joint->da_dx = d->Fx;
   d->multibody.joint->da_du = d->Fu;
 
@@ -240,10 +242,11 @@ void DifferentialActionModelContactFwdDynamicsTpl<Scalar>::calcDiff(
         f_partial_dtau * d->pinocchio.dtau_dv;
     d->df_dx.topRows(nc).noalias() +=
         f_partial_da * d->multibody.contacts->da0_dx.topRows(nc);
-    d->df_dx.topRows(nc).noalias() -=
-        f_partial_dtau * d->multibody.actuation->dtau_dx;
-    d->df_du.topRows(nc).noalias() =
-        -f_partial_dtau * d->multibody.actuation->dtau_du;
+    actuation_->multiplyByStateJacobian(
+        d->multibody.actuation, f_partial_dtau, d->df_dx.topRows(nc), rmfrom);
+    d->df_du.topRows(nc).setZero();
+    actuation_->multiplyByControlJacobian(
+        d->multibody.actuation, f_partial_dtau, d->df_du.topRows(nc), rmfrom);
     contacts_->updateAccelerationDiff(d->multibody.contacts,
                                       d->Fx.bottomRows(nv));
     contacts_->updateForceDiff(d->multibody.contacts, d->df_dx.topRows(nc),
@@ -122,6 +122,29 @@ class DifferentialActionModelFreeFwdDynamicsTpl
       const std::shared_ptr<DifferentialActionDataAbstract>& data,
       const Eigen::Ref<const VectorXs>& x);
 
+  /**
+   * @brief Compute the system acceleration, cost value and their derivatives
+   *
+   * Without armature, the ABA derivatives provide the system acceleration as
+   * well, thus we avoid running the ABA forward pass.
+   *
+   * @param[in] data  Free forward-dynamics data
+   * @param[in] x     State point \f$\mathbf{x}\in\mathbb{R}^{ndx}\f$
+   * @param[in] u     Control input \f$\mathbf{u}\in\mathbb{R}^{nu}\f$
+   */
+  virtual void calcAndDiff(
+      const std::shared_ptr<DifferentialActionDataAbstract>& data,
+      const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u);
+
+  /**
+   * @brief @copydoc Base::calcAndDiff(const
+   * std::shared_ptr<DifferentialActionDataAbstract>& data, const
+   * Eigen::Ref<const VectorXs>& x)
+   */
+  virtual void calcAndDiff(
+      const std::shared_ptr<DifferentialActionDataAbstract>& data,
+      const Eigen::Ref<const VectorXs>& x);
+
   /**
    * @brief Create the free forward-dynamics data
    *
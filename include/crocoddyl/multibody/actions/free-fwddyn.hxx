@@ -157,8 +157,12 @@ void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::calcDiff(
     pinocchio::computeABADerivatives(
         pinocchio_, d->pinocchio, q, v, d->multibody.actuation->tau,
         d->Fx.leftCols(nv), d->Fx.rightCols(nv), d->pinocchio.Minv);
-    d->Fx.noalias() += d->pinocchio.Minv * d->multibody.actuation->dtau_dx;
-    d->Fu.noalias() = d->pinocchio.Minv * d->multibody.actuation->dtau_du;
+    // Minv is symmetric and row-major, so its transpose is passed to avoid a
+    // copy
+    actuation_->multiplyByStateJacobian(
+        d->multibody.actuation, d->pinocchio.Minv.transpose(), d->Fx, addto);
+    actuation_->multiplyByControlJacobian(
+        d->multibody.actuation, d->pinocchio.Minv.transpose(), d->Fu);
   } else {
     pinocchio::computeRNEADerivatives(pinocchio_, d->pinocchio, q, v, d->xout);
     d->dtau_dx.leftCols(nv) =
@@ -166,7 +170,8 @@ void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::calcDiff(
     d->dtau_dx.rightCols(nv) =
         d->multibody.actuation->dtau_dx.rightCols(nv) - d->pinocchio.dtau_dv;
     d->Fx.noalias() = d->Minv * d->dtau_dx;
-    d->Fu.noalias() = d->Minv * d->multibody.actuation->dtau_du;
+    actuation_->multiplyByControlJacobian(d->multibody.actuation, d->Minv,
+                                          d->Fu);
   }
   d->multibody.joint->da_dx = d->Fx;
   d->multibody.joint->da_du = d->Fu;
@@ -193,6 +198,106 @@ void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::calcDiff(
   }
 }
 
+template <typename Scalar>
+void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<DifferentialActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x, const Eigen::Ref<const VectorXs>& u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (static_cast<std::size_t>(u.size()) != nu_) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(nu_) + ")");
+  }
+
+  const std::size_t nv = state_->get_nv();
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> q =
+      x.head(state_->get_nq());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> v =
+      x.tail(nv);
+
+  Data* d = static_cast<Data*>(data.get());
+
+  actuation_->calc(d->multibody.actuation, x, u);
+  actuation_->calcDiff(d->multibody.actuation, x, u);
+
+  // Computing the dynamics and its derivatives
+  if (without_armature_) {
+    // The ABA derivatives also compute the system acceleration, so we do not
+    // need to run the ABA algorithm beforehand
+    pinocchio::computeABADerivatives(
+        pinocchio_, d->pinocchio, q, v, d->multibody.actuation->tau,
+        d->Fx.leftCols(nv), d->Fx.rightCols(nv), d->pinocchio.Minv);
+    pinocchio::updateGlobalPlacements(pinocchio_, d->pinocchio);
+    d->xout = d->pinocchio.ddq;
+    // Minv is symmetric and row-major, so its transpose is passed to avoid a
+    // copy
+    actuation_->multiplyByStateJacobian(
+        d->multibody.actuation, d->pinocchio.Minv.transpose(), d->Fx, addto);
+    actuation_->multiplyByControlJacobian(
+        d->multibody.actuation, d->pinocchio.Minv.transpose(), d->Fu);
+  } else {
+    pinocchio::computeAllTerms(pinocchio_, d->pinocchio, q, v);
+    d->pinocchio.M.diagonal() += armature_;
+    pinocchio::cholesky::decompose(pinocchio_, d->pinocchio);
+    d->Minv.setZero();
+    pinocchio::cholesky::computeMinv(pinocchio_, d->pinocchio, d->Minv);
+    d->u_drift = d->multibody.actuation->tau - d->pinocchio.nle;
+    d->xout.noalias() = d->Minv * d->u_drift;
+    pinocchio::computeRNEADerivatives(pinocchio_, d->pinocchio, q, v, d->xout);
+    d->dtau_dx.leftCols(nv) =
+        d->multibody.actuation->dtau_dx.leftCols(nv) - d->pinocchio.dtau_dq;
+    d->dtau_dx.rightCols(nv) =
+        d->multibody.actuation->dtau_dx.rightCols(nv) - d->pinocchio.dtau_dv;
+    d->Fx.noalias() = d->Minv * d->dtau_dx;
+    actuation_->multiplyByControlJacobian(d->multibody.actuation, d->Minv,
+                                          d->Fu);
+  }
+  d->multibody.joint->a = d->xout;
+  d->multibody.joint->tau = u;
+  d->multibody.joint->da_dx = d->Fx;
+  d->multibody.joint->da_du = d->Fu;
+  costs_->calc(d->costs, x, u);
+  costs_->calcDiff(d->costs, x, u);
+  d->cost = d->costs->cost;
+  if (constraints_ != nullptr) {
+    d->constraints->resize(this, d);
+    constraints_->calc(d->constraints, x, u);
+    constraints_->calcDiff(d->constraints, x, u);
+  }
+}
+
+template <typename Scalar>
+void DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::calcAndDiff(
+    const std::shared_ptr<DifferentialActionDataAbstract>& data,
+    const Eigen::Ref<const VectorXs>& x) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+
+  Data* d = static_cast<Data*>(data.get());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> q =
+      x.head(state_->get_nq());
+  const Eigen::VectorBlock<const Eigen::Ref<const VectorXs>, Eigen::Dynamic> v =
+      x.tail(state_->get_nv());
+
+  pinocchio::computeAllTerms(pinocchio_, d->pinocchio, q, v);
+
+  costs_->calc(d->costs, x);
+  costs_->calcDiff(d->costs, x);
+  d->cost = d->costs->cost;
+  if (constraints_ != nullptr) {
+    d->constraints->resize(this, d, false);
+    constraints_->calc(d->constraints, x);
+    constraints_->calcDiff(d->constraints, x);
+  }
+}
+
 template <typename Scalar>
 std::shared_ptr<DifferentialActionDataAbstractTpl<Scalar> >
 DifferentialActionModelFreeFwdDynamicsTpl<Scalar>::createData() {
@@ -58,7 +58,9 @@ class ActuationModelFloatingBaseTpl
                          state->get_pinocchio()->existJointName("root_joint")
                              ? state->get_pinocchio()->getJointId("root_joint")
                              : 0)]
-                     .nv()) {};
+                     .nv()) {
+    structure_ = ActuationSelection;
+  };
   virtual ~ActuationModelFloatingBaseTpl() {};
 
   /**
@@ -157,6 +159,7 @@ class ActuationModelFloatingBaseTpl
  protected:
   using Base::nu_;
   using Base::state_;
+  using Base::structure_;
 
 #ifndef NDEBUG
  private:
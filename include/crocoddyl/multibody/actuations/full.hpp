@@ -43,7 +43,9 @@ class ActuationModelFullTpl : public ActuationModelAbstractTpl<_Scalar> {
    * @param[in] state  State of the dynamical system
    */
   explicit ActuationModelFullTpl(std::shared_ptr<StateAbstract> state)
-      : Base(state, state->get_nv()) {};
+      : Base(state, state->get_nv()) {
+    structure_ = ActuationIdentity;
+  };
   virtual ~ActuationModelFullTpl() {};
 
   /**
@@ -129,6 +131,7 @@ class ActuationModelFullTpl : public ActuationModelAbstractTpl<_Scalar> {
  protected:
   using Base::nu_;
   using Base::state_;
+  using Base::structure_;
 };
 
 }  // namespace crocoddyl
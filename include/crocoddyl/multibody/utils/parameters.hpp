@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CROCODDYL_MULTIBODY_UTILS_PARAMETERS_HPP_
+#define CROCODDYL_MULTIBODY_UTILS_PARAMETERS_HPP_
+
+#include <pinocchio/spatial/force.hpp>
+#include <pinocchio/spatial/motion.hpp>
+#include <pinocchio/spatial/se3.hpp>
+
+#include "crocoddyl/core/mpc/parameters.hpp"
+
+namespace crocoddyl {
+
+/**
+ * @brief Conversion of placement references
+ *
+ * The parameter vector is the translation followed by the coefficients
+ * \f$(x,y,z,w)\f$ of the rotation quaternion, which is normalized.
+ */
+template <typename Scalar, int Options>
+struct ParameterReference<pinocchio::SE3Tpl<Scalar, Options> > {
+  typedef pinocchio::SE3Tpl<Scalar, Options> SE3;
+
+  static std::size_t size(const SE3&) { return 7; }
+
+  static void assign(const Eigen::Ref<const Eigen::VectorXd>& value,
+                     SE3& reference) {
+    Eigen::Quaternion<Scalar, Options> quaternion(
+        Eigen::Map<const Eigen::Matrix<Scalar, 4, 1> >(value.data() + 3));
+    quaternion.normalize();
+    reference.translation() = value.head<3>();
+    reference.rotation() = quaternion.toRotationMatrix();
+  }
+};
+
+/**
+ * @brief Conversion of spatial velocity references
+ *
+ * The parameter vector is the linear velocity followed by the angular one.
+ */
+template <typename Scalar, int Options>
+struct ParameterReference<pinocchio::MotionTpl<Scalar, Options> > {
+  typedef pinocchio::MotionTpl<Scalar, Options> Motion;
+
+  static std::size_t size(const Motion&) { return 6; }
+
+  static void assign(const Eigen::Ref<const Eigen::VectorXd>& value,
+                     Motion& reference) {
+    reference.toVector() = value;
+  }
+};
+
+/**
+ * @brief Conversion of spatial force references
+ *
+ * The parameter vector is the linear force followed by the angular one.
+ */
+template <typename Scalar, int Options>
+struct ParameterReference<pinocchio::ForceTpl<Scalar, Options> > {
+  typedef pinocchio::ForceTpl<Scalar, Options> Force;
+
+  static std::size_t size(const Force&) { return 6; }
+
+  static void assign(const Eigen::Ref<const Eigen::VectorXd>& value,
+                     Force& reference) {
+    reference.toVector() = value;
+  }
+};
+
+}  // namespace crocoddyl
+
+#endif  // CROCODDYL_MULTIBODY_UTILS_PARAMETERS_HPP_
@@ -48,6 +48,18 @@ class SimpleQuadrupedGaitProblem {
       const double stepHeight, const double timeStep,
       const std::size_t stepKnots, const std::size_t supportKnots);
 
+  // Update a walking problem in place for replanning. The node models are
+  // taken from a pool of phase-typed models whose references are updated, and
+  // the problem's nodes are replaced with ShootingProblem::updateModel only
+  // when they are not the pooled ones. Then, replanning the same gait does not
+  // allocate models or datas. The problems updated by this generator share the
+  // pooled models.
+  void updateWalkingProblem(
+      const std::shared_ptr<crocoddyl::ShootingProblem>& problem,
+      const Eigen::VectorXd& x0, const double stepLength,
+      const double stepHeight, const double timeStep,
+      const std::size_t stepKnots, const std::size_t supportKnots);
+
   std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >
   createFootStepModels(const double timeStep, Eigen::Vector3d& comPos0,
                        std::vector<Eigen::Vector3d>& feetPos0,
@@ -84,6 +96,8 @@ class SimpleQuadrupedGaitProblem {
 
   const Eigen::VectorXd& get_defaultState() const;
 
+  std::size_t get_npooledModels() const;
+
  protected:
   pinocchio::Model rmodel_;
   pinocchio::Data rdata_;
@@ -92,6 +106,53 @@ class SimpleQuadrupedGaitProblem {
   std::shared_ptr<ActuationModelFloatingBase> actuation_;
   bool firtstep_;
   Eigen::VectorXd defaultstate_;
+
+ private:
+  // The walking gaits only switch feet with impulse models
+  enum GaitNodeType { SwingFootNode = 0, ImpulseNode };
+
+  // Pooled node model and the residuals whose references change between gaits
+  struct GaitNode {
+    std::shared_ptr<ActionModelAbstract> model;
+    std::shared_ptr<IntegratedActionModelAbstract> integrated;
+    std::shared_ptr<ResidualModelCoMPosition> com_residual;
+    std::vector<std::shared_ptr<ResidualModelFrameTranslation> > foot_residuals;
+  };
+
+  // Pooled node models of a phase, which are handed out in order
+  struct GaitPhase {
+    GaitNodeType type;
+    std::vector<pinocchio::FrameIndex> support_ids;
+    std::vector<pinocchio::FrameIndex> swing_ids;
+    bool com_task;
+    std::vector<GaitNode> nodes;
+    std::size_t next;
+  };
+
+  void createWalkingModels(
+      const Eigen::VectorXd& x0, const double stepLength,
+      const double stepHeight, const double timeStep,
+      const std::size_t stepKnots, const std::size_t supportKnots,
+      const bool pooled,
+      std::vector<std::shared_ptr<ActionModelAbstract> >& models);
+
+  std::vector<std::shared_ptr<ActionModelAbstract> > createFootStepModels(
+      const double timeStep, Eigen::Vector3d& comPos0,
+      std::vector<Eigen::Vector3d>& feetPos0, const double stepLength,
+      const double stepHeight, const std::size_t numKnots,
+      const std::vector<pinocchio::FrameIndex>& supportFootIds,
+      const std::vector<pinocchio::FrameIndex>& swingFootIds,
+      const bool pooled);
+
+  std::shared_ptr<ActionModelAbstract> getPooledModel(
+      const GaitNodeType type, const double timeStep,
+      const std::vector<pinocchio::FrameIndex>& supportFootIds,
+      const Eigen::Vector3d& comTask,
+      const std::vector<pinocchio::FrameIndex>& swingFootIds,
+      const std::vector<pinocchio::SE3>& swingFootTask);
+
+  std::vector<GaitPhase> pool_;
+  std::vector<std::shared_ptr<ActionModelAbstract> > pooled_models_;
 };
 }  // namespace crocoddyl
 
@@ -0,0 +1,215 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/mpc/horizon.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/integrator/implicit-euler.hpp"
+#include "crocoddyl/core/integrator/rk.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+HorizonBuilder::HorizonBuilder(
+    std::shared_ptr<DifferentialActionModelAbstract> running,
+    std::shared_ptr<DifferentialActionModelAbstract> terminal)
+    : running_(running), terminal_(terminal), ts_(1, 0.) {}
+
+HorizonBuilder::~HorizonBuilder() {}
+
+void HorizonBuilder::addUniformSegment(const std::size_t nnodes,
+                                       const double dt,
+                                       const HorizonIntegrator integrator) {
+  if (dt <= 0.) {
+    throw_pretty("Invalid argument: " << "dt has to be positive");
+  }
+  for (std::size_t i = 0; i < nnodes; ++i) {
+    dts_.push_back(dt);
+    integrators_.push_back(integrator);
+    ts_.push_back(ts_.back() + dt);
+  }
+}
+
+void HorizonBuilder::addGradedSegment(const double duration, const double dt0,
+                                      const double ratio,
+                                      const HorizonIntegrator integrator,
+                                      const double dt_max) {
+  if (duration <= 0.) {
+    throw_pretty("Invalid argument: " << "duration has to be positive");
+  }
+  if (dt0 <= 0. || dt_max < dt0) {
+    throw_pretty("Invalid argument: "
+                 << "dt0 has to be positive and lower than dt_max");
+  }
+  if (ratio < 1.) {
+    throw_pretty("Invalid argument: " << "ratio has to be greater than 1");
+  }
+  const std::size_t first = dts_.size();
+  double dt = dt0;
+  double covered = 0.;
+  // Append nodes while they reduce the gap to the duration
+  while (covered == 0. || covered + dt - duration < duration - covered) {
+    dts_.push_back(dt);
+    integrators_.push_back(integrator);
+    covered += dt;
+    dt = std::min(dt * ratio, dt_max);
+  }
+  // Scale the time steps to cover the duration exactly
+  const double scale = duration / covered;
+  for (std::size_t i = first; i < dts_.size(); ++i) {
+    dts_[i] *= scale;
+    ts_.push_back(ts_.back() + dts_[i]);
+  }
+}
+
+void HorizonBuilder::clear() {
+  dts_.clear();
+  integrators_.clear();
+  ts_.assign(1, 0.);
+}
+
+std::shared_ptr<ShootingProblem> HorizonBuilder::build(
+    const Eigen::VectorXd& x0) const {
+  const std::size_t T = dts_.size();
+  if (T == 0) {
+    throw_pretty("Invalid call: " << "the horizon has no nodes");
+  }
+  std::vector<std::shared_ptr<ActionModelAbstract> > models(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    if (i > 0 && dts_[i] == dts_[i - 1] &&
+        integrators_[i] == integrators_[i - 1]) {
+      models[i] = models[i - 1];
+    } else {
+      models[i] = createModel(dts_[i], integrators_[i]);
+    }
+  }
+  std::shared_ptr<ActionModelAbstract> terminal =
+      std::make_shared<IntegratedActionModelEuler>(terminal_, 0.);
+  return std::make_shared<ShootingProblem>(x0, models, terminal);
+}
+
+std::shared_ptr<ActionModelAbstract> HorizonBuilder::createModel(
+    const double dt, const HorizonIntegrator integrator) const {
+  switch (integrator) {
+    case HorizonEuler:
+      return std::make_shared<IntegratedActionModelEuler>(running_, dt);
+    case HorizonRK2:
+      return std::make_shared<IntegratedActionModelRK>(running_, two, dt);
+    case HorizonRK3:
+      return std::make_shared<IntegratedActionModelRK>(running_, three, dt);
+    case HorizonRK4:
+      return std::make_shared<IntegratedActionModelRK>(running_, four, dt);
+    case HorizonImplicitEuler:
+      return std::make_shared<IntegratedActionModelImplicitEuler>(
+          running_, Implicit, dt);
+    case HorizonSemiImplicitEuler:
+      return std::make_shared<IntegratedActionModelImplicitEuler>(
+          running_, SemiImplicit, dt);
+    default:
+      throw_pretty("Invalid argument: " << "unknown integrator");
+  }
+}
+
+const std::shared_ptr<DifferentialActionModelAbstract>&
+HorizonBuilder::get_running() const {
+  return running_;
+}
+
+const std::shared_ptr<DifferentialActionModelAbstract>&
+HorizonBuilder::get_terminal() const {
+  return terminal_;
+}
+
+std::size_t HorizonBuilder::get_T() const { return dts_.size(); }
+
+double HorizonBuilder::get_duration() const { return ts_.back(); }
+
+const std::vector<double>& HorizonBuilder::get_dts() const { return dts_; }
+
+const std::vector<HorizonIntegrator>& HorizonBuilder::get_integrators() const {
+  return integrators_;
+}
+
+const std::vector<double>& HorizonBuilder::get_ts() const { return ts_; }
+
+void interpolateTrajectory(const std::shared_ptr<StateAbstract>& state,
+                           const std::vector<double>& ts,
+                           const std::vector<Eigen::VectorXd>& xs,
+                           const std::vector<Eigen::VectorXd>& us,
+                           const std::vector<double>& ts_new,
+                           std::vector<Eigen::VectorXd>& xs_new,
+                           std::vector<Eigen::VectorXd>& us_new) {
+  const std::size_t T = us.size();
+  const std::size_t N = us_new.size();
+  if (T == 0 || ts.size() != T + 1 || xs.size() != T + 1) {
+    throw_pretty("Invalid argument: "
+                 << "ts, xs and us have inconsistent dimensions");
+  }
+  if (ts_new.size() != N + 1 || xs_new.size() != N + 1) {
+    throw_pretty("Invalid argument: "
+                 << "ts_new, xs_new and us_new have inconsistent dimensions");
+  }
+  Eigen::VectorXd dx(state->get_ndx());
+
+  // States are interpolated along the geodesic of each interval
+  for (std::size_t k = 0; k <= N; ++k) {
+    const double t = ts_new[k];
+    if (t <= ts.front()) {
+      xs_new[k] = xs.front();
+    } else if (t >= ts.back()) {
+      xs_new[k] = xs.back();
+    } else {
+      const std::size_t i =
+          std::upper_bound(ts.begin(), ts.end(), t) - ts.begin() - 1;
+      const double dt = ts[i + 1] - ts[i];
+      state->diff(xs[i], xs[i + 1], dx);
+      dx *= dt > 0. ? (t - ts[i]) / dt : 0.;
+      xs_new[k].resize(state->get_nx());
+      state->integrate(xs[i], dx, xs_new[k]);
+    }
+  }
+
+  // Controls are averaged over each interval, the first and last intervals
+  // being extended to cover times outside of the previous grid
+  std::size_t i0 = 0;
+  for (std::size_t k = 0; k < N; ++k) {
+    Eigen::VectorXd& u = us_new[k];
+    const double a = ts_new[k];
+    const double b = ts_new[k + 1];
+    while (i0 + 1 < T && ts[i0 + 1] <= a) {
+      ++i0;
+    }
+    u.setZero();
+    double weight = 0.;
+    for (std::size_t i = i0; i < T; ++i) {
+      const double lo = i == 0 ? -std::numeric_limits<double>::infinity()
+                               : ts[i];
+      const double hi =
+          i + 1 == T ? std::numeric_limits<double>::infinity() : ts[i + 1];
+      if (lo >= b) {
+        break;
+      }
+      const double overlap = std::min(b, hi) - std::max(a, lo);
+      if (overlap > 0. && us[i].size() == u.size()) {
+        u += overlap * us[i];
+        weight += overlap;
+      }
+    }
+    if (weight > 0.) {
+      u /= weight;
+    } else if (us[i0].size() == u.size()) {
+      // Zero-duration intervals take the control active at their time
+      u = us[i0];
+    }
+  }
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/mpc/parameters.hpp"
+
+#include <algorithm>
+
+#include "crocoddyl/core/utils/stop-watch.hpp"
+
+namespace crocoddyl {
+
+ProblemParameters::ProblemParameters(std::shared_ptr<ShootingProblem> problem)
+    : problem_(problem) {
+  if (!problem_) {
+    throw_pretty("Invalid argument: " << "problem is null");
+  }
+  const std::size_t T = problem_->get_T();
+  values_.resize(T + 1, 0);
+  bindings_.resize(T + 1);
+  changed_.resize(T + 1, false);
+}
+
+ProblemParameters::~ProblemParameters() {}
+
+std::size_t ProblemParameters::addParameter(
+    const std::string& name, const Eigen::Ref<const Eigen::VectorXd>& value) {
+  if (name.empty()) {
+    throw_pretty("Invalid argument: " << "the parameter name is empty");
+  }
+  if (index_.find(name) != index_.end()) {
+    throw_pretty("Invalid argument: " << "the parameter \"" + name +
+                                             "\" already exists");
+  }
+  if (value.size() == 0) {
+    throw_pretty("Invalid argument: " << "the parameter value is empty");
+  }
+  for (std::size_t t = 0; t < bindings_.size(); ++t) {
+    for (std::size_t i = 0; i < bindings_[t].size(); ++i) {
+      if (bindings_[t][i].dim == 0) {
+        throw_pretty("Invalid argument: "
+                     << "the parameters cannot be added after binding an "
+                        "environment vector");
+      }
+    }
+  }
+  const std::size_t offset = get_nparams();
+  const std::size_t dim = static_cast<std::size_t>(value.size());
+  values_.conservativeResize(Eigen::NoChange, offset + dim);
+  values_.rightCols(dim).rowwise() = value.transpose();
+  index_[name] = names_.size();
+  names_.push_back(name);
+  offsets_.push_back(offset);
+  dims_.push_back(dim);
+  return offset;
+}
+
+void ProblemParameters::bind(const std::string& name, const std::size_t t,
+                             Binding binding) {
+  const std::size_t i = find(name);
+  checkNode(t);
+  if (!binding) {
+    throw_pretty("Invalid argument: " << "the binding is empty");
+  }
+  NodeBinding node = {offsets_[i], dims_[i], binding};
+  bindings_[t].push_back(node);
+  changed_[t] = true;
+}
+
+void ProblemParameters::bindNode(const std::size_t t, Binding binding) {
+  checkNode(t);
+  NodeBinding node = {0, 0, binding};
+  bindings_[t].push_back(node);
+  changed_[t] = true;
+}
+
+void ProblemParameters::set(const std::string& name,
+                            const Eigen::Ref<const MatrixXdRowMajor>& values) {
+  const std::size_t i = find(name);
+  const Eigen::Index nnodes = values_.rows();
+  const Eigen::Index dim = static_cast<Eigen::Index>(dims_[i]);
+  if ((values.rows() != nnodes && values.rows() != 1) || values.cols() != dim) {
+    throw_pretty("Invalid argument: "
+                 << "values has wrong dimension (it should be " +
+                        std::to_string(nnodes) + "x" + std::to_string(dim) +
+                        " or 1x" + std::to_string(dim) + ")");
+  }
+  const Eigen::Index offset = static_cast<Eigen::Index>(offsets_[i]);
+  if (values.rows() == 1) {
+    values_.middleCols(offset, dim).rowwise() = values.row(0);
+  } else {
+    values_.middleCols(offset, dim) = values;
+  }
+  std::fill(changed_.begin(), changed_.end(), true);
+}
+
+void ProblemParameters::set(const std::string& name, const std::size_t t,
+                            const Eigen::Ref<const Eigen::VectorXd>& value) {
+  const std::size_t i = find(name);
+  checkNode(t);
+  if (static_cast<std::size_t>(value.size()) != dims_[i]) {
+    throw_pretty("Invalid argument: "
+                 << "value has wrong dimension (it should be " +
+                        std::to_string(dims_[i]) + ")");
+  }
+  values_.row(t).segment(offsets_[i], dims_[i]) = value.transpose();
+  changed_[t] = true;
+}
+
+void ProblemParameters::set_values(
+    const Eigen::Ref<const MatrixXdRowMajor>& values) {
+  if (values.rows() != values_.rows() || values.cols() != values_.cols()) {
+    throw_pretty("Invalid argument: "
+                 << "values has wrong dimension (it should be " +
+                        std::to_string(values_.rows()) + "x" +
+                        std::to_string(values_.cols()) + ")");
+  }
+  values_ = values;
+  std::fill(changed_.begin(), changed_.end(), true);
+}
+
+void ProblemParameters::set_values(
+    const std::size_t t, const Eigen::Ref<const Eigen::VectorXd>& value) {
+  checkNode(t);
+  if (value.size() != values_.cols()) {
+    throw_pretty("Invalid argument: "
+                 << "value has wrong dimension (it should be " +
+                        std::to_string(values_.cols()) + ")");
+  }
+  values_.row(t) = value.transpose();
+  changed_[t] = true;
+}
+
+void ProblemParameters::update() {
+  START_PROFILER("ProblemParameters::update");
+  for (std::size_t t = 0; t < bindings_.size(); ++t) {
+    if (!changed_[t]) {
+      continue;
+    }
+    const std::vector<NodeBinding>& bindings = bindings_[t];
+    for (std::size_t i = 0; i < bindings.size(); ++i) {
+      const NodeBinding& node = bindings[i];
+      if (node.dim == 0) {
+        node.binding(problem_, t, values_.row(t).transpose());
+      } else {
+        node.binding(problem_, t,
+                     values_.row(t).segment(node.offset, node.dim).transpose());
+      }
+    }
+    changed_[t] = false;
+  }
+  STOP_PROFILER("ProblemParameters::update");
+}
+
+void ProblemParameters::updateAll() {
+  std::fill(changed_.begin(), changed_.end(), true);
+  update();
+}
+
+Eigen::Block<const ProblemParameters::MatrixXdRowMajor> ProblemParameters::get(
+    const std::string& name) const {
+  const std::size_t i = find(name);
+  return values_.block(0, offsets_[i], values_.rows(), dims_[i]);
+}
+
+const ProblemParameters::MatrixXdRowMajor& ProblemParameters::get_values()
+    const {
+  return values_;
+}
+
+const std::vector<std::string>& ProblemParameters::get_names() const {
+  return names_;
+}
+
+std::size_t ProblemParameters::get_offset(const std::string& name) const {
+  return offsets_[find(name)];
+}
+
+std::size_t ProblemParameters::get_dim(const std::string& name) const {
+  return dims_[find(name)];
+}
+
+std::size_t ProblemParameters::get_nparams() const {
+  return static_cast<std::size_t>(values_.cols());
+}
+
+std::size_t ProblemParameters::get_nbindings() const {
+  std::size_t nbindings = 0;
+  for (std::size_t t = 0; t < bindings_.size(); ++t) {
+    nbindings += bindings_[t].size();
+  }
+  return nbindings;
+}
+
+const std::shared_ptr<ShootingProblem>& ProblemParameters::get_problem()
+    const {
+  return problem_;
+}
+
+std::size_t ProblemParameters::find(const std::string& name) const {
+  std::map<std::string, std::size_t>::const_iterator it = index_.find(name);
+  if (it == index_.end()) {
+    throw_pretty("Invalid argument: " << "the parameter \"" + name +
+                                             "\" does not exist");
+  }
+  return it->second;
+}
+
+void ProblemParameters::checkNode(const std::size_t t) const {
+  if (t >= bindings_.size()) {
+    throw_pretty("Invalid argument: "
+                 << "t is out of range (it should be lower or equal than " +
+                        std::to_string(bindings_.size() - 1) + ")");
+  }
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,352 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/mpc/runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "crocoddyl/core/integ-action-base.hpp"
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+MPCRuntime::MPCRuntime(std::shared_ptr<SolverAbstract> solver,
+                       const double dt, const std::size_t maxiter)
+    : solver_(solver),
+      ddp_(dynamic_cast<SolverDDP*>(solver.get())),
+      state_(solver->get_problem()->get_terminalModel()->get_state()),
+      dt_(dt),
+      maxiter_(maxiter),
+      idle_time_(1e-4),
+      shift_policy_(RepeatLast),
+      warmstart_(ShiftNodes),
+      nsolves_(0),
+      running_(false),
+      has_policy_(false),
+      has_solved_(false),
+      dx_(Eigen::VectorXd::Zero(state_->get_ndx())),
+      xref_(Eigen::VectorXd::Zero(state_->get_nx())) {
+  if (dt <= 0.) {
+    throw_pretty("Invalid argument: " << "dt has to be positive");
+  }
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+  StateSample sample;
+  sample.x = problem->get_x0();
+  sample.t = 0.;
+  state_buffer_.reset(sample);
+  allocateData();
+  computeTimeGrid(0.);
+  ts_ = ts_ws_;
+  MPCPolicy policy;
+  policy.ts = ts_;
+  policy.xs = solver_->get_xs();
+  policy.us = solver_->get_us();
+  policy.K.resize(problem->get_T());
+  for (std::size_t i = 0; i < problem->get_T(); ++i) {
+    policy.K[i].setZero(policy.us[i].size(), state_->get_ndx());
+  }
+  policy_buffer_.reset(policy);
+}
+
+MPCRuntime::~MPCRuntime() {
+  running_ = false;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void MPCRuntime::start() {
+  if (running_) {
+    throw_pretty("Invalid call: the MPC runtime is already running");
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  error_ = nullptr;
+  running_ = true;
+  thread_ = std::thread(&MPCRuntime::run, this);
+}
+
+void MPCRuntime::stop() {
+  running_ = false;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  if (error_) {
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+bool MPCRuntime::step() {
+  if (!state_buffer_.update()) {
+    return false;
+  }
+  START_PROFILER("MPCRuntime::step");
+  const StateSample& sample = state_buffer_.front();
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+
+  // Count the nodes elapsed since the previous solve
+  std::size_t nshift = 0;
+  if (has_solved_ && warmstart_ == ShiftNodes) {
+    const std::size_t T = ts_.size() - 1;
+    while (nshift < T && ts_[nshift + 1] <= sample.t + 1e-9) {
+      ++nshift;
+    }
+  }
+
+  // Shift the previous solution to warm-start the solver
+  if (warmstart_ == ShiftNodes) {
+    solver_->shift(nshift, shift_policy_);
+  }
+  if (update_) {
+    update_(problem, nshift, sample.t);
+  }
+  problem->set_x0(sample.x);
+  allocateData();
+  const std::size_t T = problem->get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem->get_runningModels();
+  const std::vector<Eigen::VectorXd>& xs = solver_->get_xs();
+  const std::vector<Eigen::VectorXd>& us = solver_->get_us();
+  computeTimeGrid(sample.t);
+  if (has_solved_ && warmstart_ == InterpolateTime && ts_.size() == xs.size()) {
+    // Interpolate the previous solution at the new node times
+    for (std::size_t i = 0; i < T; ++i) {
+      us_ws_[i].resize(models[i]->get_nu());
+    }
+    interpolateTrajectory(state_, ts_, xs, us, ts_ws_, xs_ws_, us_ws_);
+  } else {
+    for (std::size_t i = 0; i < T; ++i) {
+      const std::size_t nu = models[i]->get_nu();
+      if (i < us.size() && static_cast<std::size_t>(us[i].size()) == nu) {
+        us_ws_[i] = us[i];
+      } else {
+        us_ws_[i].setZero(nu);
+      }
+      xs_ws_[i] = xs[std::min(i, xs.size() - 1)];
+    }
+    xs_ws_[T] = xs[std::min(T, xs.size() - 1)];
+  }
+  xs_ws_[0] = sample.x;
+
+  solver_->solve(xs_ws_, us_ws_, maxiter_, false);
+
+  // Publish the new policy
+  ts_ = ts_ws_;
+  MPCPolicy& policy = policy_buffer_.back();
+  policy.t0 = sample.t;
+  policy.ts = ts_;
+  policy.xs = solver_->get_xs();
+  policy.us = solver_->get_us();
+  if (ddp_ != nullptr) {
+    policy.K = ddp_->get_K();
+  } else {
+    policy.K.resize(T);
+    for (std::size_t i = 0; i < T; ++i) {
+      policy.K[i].setZero(models[i]->get_nu(), state_->get_ndx());
+    }
+  }
+  policy.cost = solver_->get_cost();
+  policy.iter = solver_->get_iter();
+  policy.id = nsolves_ + 1;
+  policy_buffer_.publish();
+  ++nsolves_;
+  has_solved_ = true;
+  STOP_PROFILER("MPCRuntime::step");
+  return true;
+}
+
+void MPCRuntime::setState(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          const double t) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  StateSample& sample = state_buffer_.back();
+  sample.x = x;
+  sample.t = t;
+  state_buffer_.publish();
+}
+
+bool MPCRuntime::computeControl(const double t,
+                                const Eigen::Ref<const Eigen::VectorXd>& x,
+                                Eigen::Ref<Eigen::VectorXd> u) {
+  if (static_cast<std::size_t>(x.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "x has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (policy_buffer_.update()) {
+    has_policy_ = true;
+  }
+  if (!has_policy_) {
+    return false;
+  }
+  const MPCPolicy& policy = policy_buffer_.front();
+  double alpha;
+  const std::size_t k = locate(policy, t, alpha);
+  if (u.size() != policy.us[k].size()) {
+    throw_pretty(
+        "Invalid argument: " << "u has wrong dimension (it should be " +
+                                    std::to_string(policy.us[k].size()) + ")");
+  }
+  interpolate(policy, k, alpha, u);
+  state_->diff(xref_, x, dx_);
+  u.noalias() -= policy.K[k] * dx_;
+  return true;
+}
+
+bool MPCRuntime::computeReference(const double t,
+                                  Eigen::Ref<Eigen::VectorXd> xref,
+                                  Eigen::Ref<Eigen::VectorXd> uref) {
+  if (static_cast<std::size_t>(xref.size()) != state_->get_nx()) {
+    throw_pretty(
+        "Invalid argument: " << "xref has wrong dimension (it should be " +
+                                    std::to_string(state_->get_nx()) + ")");
+  }
+  if (policy_buffer_.update()) {
+    has_policy_ = true;
+  }
+  if (!has_policy_) {
+    return false;
+  }
+  const MPCPolicy& policy = policy_buffer_.front();
+  double alpha;
+  const std::size_t k = locate(policy, t, alpha);
+  if (uref.size() != policy.us[k].size()) {
+    throw_pretty(
+        "Invalid argument: " << "uref has wrong dimension (it should be " +
+                                    std::to_string(policy.us[k].size()) + ")");
+  }
+  interpolate(policy, k, alpha, uref);
+  xref = xref_;
+  return true;
+}
+
+void MPCRuntime::allocateData() {
+  const std::size_t T = solver_->get_problem()->get_T();
+  if (ts_ws_.size() != T + 1) {
+    ts_ws_.resize(T + 1);
+    xs_ws_.resize(T + 1);
+    us_ws_.resize(T);
+  }
+}
+
+void MPCRuntime::computeTimeGrid(const double t0) {
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      solver_->get_problem()->get_runningModels();
+  ts_ws_[0] = t0;
+  for (std::size_t i = 0; i < models.size(); ++i) {
+    const IntegratedActionModelAbstract* model =
+        dynamic_cast<const IntegratedActionModelAbstract*>(models[i].get());
+    ts_ws_[i + 1] = ts_ws_[i] + (model != nullptr ? model->get_dt() : dt_);
+  }
+}
+
+std::size_t MPCRuntime::locate(const MPCPolicy& policy, const double t,
+                               double& alpha) const {
+  const std::size_t T = policy.us.size();
+  if (t <= policy.ts.front()) {
+    alpha = 0.;
+    return 0;
+  }
+  if (t >= policy.ts.back()) {
+    alpha = 1.;
+    return T - 1;
+  }
+  const std::size_t k =
+      std::upper_bound(policy.ts.begin(), policy.ts.end(), t) -
+      policy.ts.begin() - 1;
+  const double dt = policy.ts[k + 1] - policy.ts[k];
+  alpha = dt > 0. ? (t - policy.ts[k]) / dt : 0.;
+  return k;
+}
+
+void MPCRuntime::interpolate(const MPCPolicy& policy, const std::size_t k,
+                             const double alpha,
+                             Eigen::Ref<Eigen::VectorXd> uref) {
+  state_->diff(policy.xs[k], policy.xs[k + 1], dx_);
+  dx_ *= alpha;
+  state_->integrate(policy.xs[k], dx_, xref_);
+  if (k + 1 < policy.us.size() &&
+      policy.us[k + 1].size() == policy.us[k].size()) {
+    uref = (1. - alpha) * policy.us[k] + alpha * policy.us[k + 1];
+  } else {
+    uref = policy.us[k];
+  }
+}
+
+void MPCRuntime::run() {
+  try {
+    while (running_) {
+      if (!step()) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(idle_time_));
+      }
+    }
+  } catch (...) {
+    error_ = std::current_exception();
+    running_ = false;
+  }
+}
+
+const std::shared_ptr<SolverAbstract>& MPCRuntime::get_solver() const {
+  return solver_;
+}
+
+const MPCPolicy& MPCRuntime::get_policy() const {
+  return policy_buffer_.front();
+}
+
+double MPCRuntime::get_dt() const { return dt_; }
+
+std::size_t MPCRuntime::get_maxiter() const { return maxiter_; }
+
+std::size_t MPCRuntime::get_nsolves() const { return nsolves_; }
+
+double MPCRuntime::get_idle_time() const { return idle_time_; }
+
+bool MPCRuntime::is_running() const { return running_; }
+
+void MPCRuntime::set_dt(const double dt) {
+  if (dt <= 0.) {
+    throw_pretty("Invalid argument: " << "dt has to be positive");
+  }
+  dt_ = dt;
+}
+
+void MPCRuntime::set_maxiter(const std::size_t maxiter) { maxiter_ = maxiter; }
+
+void MPCRuntime::set_idle_time(const double idle_time) {
+  if (idle_time < 0.) {
+    throw_pretty("Invalid argument: " << "idle_time has to be positive");
+  }
+  idle_time_ = idle_time;
+}
+
+ShiftPolicy MPCRuntime::get_shiftPolicy() const { return shift_policy_; }
+
+void MPCRuntime::set_shiftPolicy(const ShiftPolicy policy) {
+  shift_policy_ = policy;
+}
+
+MPCWarmStart MPCRuntime::get_warmStart() const { return warmstart_; }
+
+void MPCRuntime::set_warmStart(const MPCWarmStart warmstart) {
+  warmstart_ = warmstart;
+}
+
+void MPCRuntime::set_problemUpdate(const ProblemUpdate& update) {
+  update_ = update;
+}
+
+}  // namespace crocoddyl
@@ -11,6 +11,9 @@
 #include <omp.h>
 #endif  // CROCODDYL_WITH_MULTITHREADING
 
+#include <algorithm>
+#include <limits>
+
 #include "crocoddyl/core/solver-base.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 
@@ -43,7 +46,14 @@ SolverAbstract::SolverAbstract(std::shared_ptr<ShootingProblem> problem)
       th_gaptol_(1e-16),
       feasnorm_(LInf),
       iter_(0),
-      tmp_feas_(0.) {
+      tmp_feas_(0.),
+      time_budget_(std::numeric_limits<double>::infinity()),
+      deadline_status_(DeadlineNone),
+      direction_time_(0.),
+      trystep_time_(0.),
+      nsolves_(0),
+      nstats_(0) {
+  set_stats_capacity(100);
   // Allocate common data
   const std::size_t ndx = problem_->get_ndx();
   const std::size_t T = problem_->get_T();
@@ -210,6 +220,136 @@ double SolverAbstract::computeEqualityFeasibility() {
   return tmp_feas_;
 }
 
+void SolverAbstract::shift(const std::size_t n, const ShiftPolicy policy) {
+  const std::size_t T = problem_->get_T();
+  if (n > T) {
+    throw_pretty("Invalid argument: "
+                 << "n is bigger than the allocated horizon (it should be less "
+                    "than or equal to " +
+                        std::to_string(T) + ")");
+  }
+  if (n == 0) {
+    return;
+  }
+  START_PROFILER("SolverAbstract::shift");
+  problem_->shift(n);
+  shiftData(n);
+
+  // Initialize the appended nodes from the last shifted one
+  const std::size_t m = T - n;
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem_->get_runningModels();
+  const std::vector<std::shared_ptr<ActionDataAbstract> >& datas =
+      problem_->get_runningDatas();
+  for (std::size_t t = m; t < T; ++t) {
+    const std::shared_ptr<ActionModelAbstract>& model = models[t];
+    const std::shared_ptr<ActionDataAbstract>& data = datas[t];
+    const std::size_t nu = model->get_nu();
+    if (static_cast<std::size_t>(us_[t].size()) != nu) {
+      us_[t].resize(nu);
+    }
+    switch (policy) {
+      case RepeatLast:
+        if (m > 0 && static_cast<std::size_t>(us_[m - 1].size()) == nu) {
+          us_[t] = us_[m - 1];
+        } else {
+          us_[t].setZero();
+        }
+        xs_[t + 1] = xs_[m];
+        break;
+      case QuasiStatic:
+        if (m > 0 && static_cast<std::size_t>(us_[m - 1].size()) == nu) {
+          us_[t] = us_[m - 1];
+        } else {
+          us_[t].setZero();
+        }
+        model->quasiStatic(data, us_[t], xs_[t]);
+        xs_[t + 1] = xs_[m];
+        break;
+      case TerminalRollout:
+        if (m > 0 && static_cast<std::size_t>(us_[m - 1].size()) == nu) {
+          rolloutPolicy(m - 1, xs_[t], us_[t]);
+        } else {
+          us_[t].setZero();
+        }
+        model->calc(data, xs_[t], us_[t]);
+        xs_[t + 1] = data->xnext;
+        break;
+    }
+  }
+  STOP_PROFILER("SolverAbstract::shift");
+}
+
+void SolverAbstract::rolloutPolicy(const std::size_t t,
+                                   const Eigen::Ref<const Eigen::VectorXd>&,
+                                   Eigen::Ref<Eigen::VectorXd> u) {
+  u = us_[t];
+}
+
+void SolverAbstract::shiftData(const std::size_t n) {
+  std::rotate(xs_.begin(), xs_.begin() + n, xs_.end());
+  std::rotate(us_.begin(), us_.begin() + n, us_.end());
+  std::rotate(fs_.begin(), fs_.begin() + n, fs_.end());
+  std::rotate(g_adj_.begin(), g_adj_.begin() + n, g_adj_.end() - 1);
+}
+
+void SolverAbstract::startClock() {
+  start_time_ = std::chrono::steady_clock::now();
+  deadline_status_ = DeadlineNone;
+  ++nsolves_;
+}
+
+void SolverAbstract::startIterationStats() {
+  iter_stats_.start_time = elapsedTime();
+  iter_stats_.calc_time = 0.;
+  iter_stats_.backward_time = 0.;
+  iter_stats_.trial_times.clear();
+}
+
+void SolverAbstract::reserveIterationStats(const std::size_t ntrials) {
+  iter_stats_.trial_times.reserve(ntrials);
+  for (std::size_t i = 0; i < stats_.size(); ++i) {
+    stats_[i].trial_times.reserve(ntrials);
+  }
+}
+
+void SolverAbstract::recordIterationStats() {
+  if (stats_.empty()) {
+    return;
+  }
+  iter_stats_.solve = nsolves_;
+  iter_stats_.iter = iter_;
+  iter_stats_.iteration_time = elapsedTime() - iter_stats_.start_time;
+  iter_stats_.cost = cost_;
+  iter_stats_.merit = merit_;
+  iter_stats_.stop = stop_;
+  iter_stats_.steplength = steplength_;
+  iter_stats_.dV = dV_;
+  iter_stats_.dVexp = dVexp_;
+  iter_stats_.feas = feas_;
+  iter_stats_.ffeas = ffeas_;
+  iter_stats_.gfeas = gfeas_;
+  iter_stats_.hfeas = hfeas_;
+  iter_stats_.is_feasible = is_feasible_;
+  iter_stats_.deadline_status = deadline_status_;
+  // The assignment reuses the memory of the overwritten statistics
+  stats_[nstats_ % stats_.size()] = iter_stats_;
+  ++nstats_;
+}
+
+double SolverAbstract::elapsedTime() const {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start_time_)
+      .count();
+}
+
+bool SolverAbstract::isDeadlineReached(const double phase_time) const {
+  if (time_budget_ == std::numeric_limits<double>::infinity()) {
+    return false;
+  }
+  return elapsedTime() + phase_time >= time_budget_;
+}
+
 void SolverAbstract::setCandidate(const std::vector<Eigen::VectorXd>& xs_warm,
                                   const std::vector<Eigen::VectorXd>& us_warm,
                                   bool is_feasible) {
@@ -292,6 +432,8 @@ SolverAbstract::getCallbacks() const {
   return callbacks_;
 }
 
+void SolverAbstract::clearStats() { nstats_ = 0; }
+
 const std::shared_ptr<ShootingProblem>& SolverAbstract::get_problem() const {
   return problem_;
 }
@@ -366,6 +508,29 @@ FeasibilityNorm SolverAbstract::get_feasnorm() const { return feasnorm_; }
 
 std::size_t SolverAbstract::get_iter() const { return iter_; }
 
+double SolverAbstract::get_time_budget() const { return time_budget_; }
+
+DeadlineStatus SolverAbstract::get_deadline_status() const {
+  return deadline_status_;
+}
+
+std::size_t SolverAbstract::get_stats_capacity() const { return stats_.size(); }
+
+std::size_t SolverAbstract::get_nstats() const {
+  return std::min(nstats_, stats_.size());
+}
+
+const SolverIterationStats& SolverAbstract::get_stats(
+    const std::size_t i) const {
+  const std::size_t nstats = get_nstats();
+  if (i >= nstats) {
+    throw_pretty("Invalid argument: "
+                 << "i is bigger than the number of recorded statistics (" +
+                        std::to_string(nstats) + ")");
+  }
+  return stats_[(nstats_ - nstats + i) % stats_.size()];
+}
+
 void SolverAbstract::set_xs(const std::vector<Eigen::VectorXd>& xs) {
   const std::size_t T = problem_->get_T();
   if (xs.size() != T + 1) {
@@ -474,6 +639,20 @@ void SolverAbstract::set_feasnorm(const FeasibilityNorm feasnorm) {
   feasnorm_ = feasnorm;
 }
 
+void SolverAbstract::set_time_budget(const double time_budget) {
+  if (time_budget <= 0.) {
+    throw_pretty(
+        "Invalid argument: " << "time_budget value has to higher than 0.");
+  }
+  time_budget_ = time_budget;
+}
+
+void SolverAbstract::set_stats_capacity(const std::size_t capacity) {
+  stats_.assign(capacity, SolverIterationStats());
+  nstats_ = 0;
+  reserveIterationStats(iter_stats_.trial_times.capacity());
+}
+
 bool raiseIfNaN(const double value) {
   if (std::isnan(value) || std::isinf(value) || value >= 1e30) {
     return true;
@@ -8,6 +8,7 @@
 
 #include "crocoddyl/core/solvers/box-fddp.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 #include "crocoddyl/core/utils/exception.hpp"
@@ -18,6 +19,8 @@ SolverBoxFDDP::SolverBoxFDDP(std::shared_ptr<ShootingProblem> problem)
     : SolverFDDP(problem),
       qp_(problem->get_runningModels()[0]->get_nu(), 100, 0.1, 1e-5, 0.) {
   allocateData();
+  // The feedback gains are computed from the Cholesky factor of the box QP
+  qp_.set_with_inverse(false);
 
   const std::size_t n_alphas = 10;
   alphas_.resize(n_alphas);
@@ -43,18 +46,24 @@ void SolverBoxFDDP::resizeData() {
   for (std::size_t t = 0; t < T; ++t) {
     const std::shared_ptr<ActionModelAbstract>& model = models[t];
     const std::size_t nu = model->get_nu();
-    Quu_inv_[t].conservativeResize(nu, nu);
     du_lb_[t].conservativeResize(nu);
     du_ub_[t].conservativeResize(nu);
   }
   STOP_PROFILER("SolverBoxFDDP::resizeData");
 }
 
+void SolverBoxFDDP::shiftData(const std::size_t n) {
+  START_PROFILER("SolverBoxFDDP::shiftData");
+  SolverFDDP::shiftData(n);
+  std::rotate(du_lb_.begin(), du_lb_.begin() + n, du_lb_.end());
+  std::rotate(du_ub_.begin(), du_ub_.begin() + n, du_ub_.end());
+  STOP_PROFILER("SolverBoxFDDP::shiftData");
+}
+
 void SolverBoxFDDP::allocateData() {
   SolverFDDP::allocateData();
 
   const std::size_t T = problem_->get_T();
-  Quu_inv_.resize(T);
   du_lb_.resize(T);
   du_ub_.resize(T);
   const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
@@ -62,7 +71,6 @@ void SolverBoxFDDP::allocateData() {
   for (std::size_t t = 0; t < T; ++t) {
     const std::shared_ptr<ActionModelAbstract>& model = models[t];
     const std::size_t nu = model->get_nu();
-    Quu_inv_[t] = Eigen::MatrixXd::Zero(nu, nu);
     du_lb_[t] = Eigen::VectorXd::Zero(nu);
     du_ub_[t] = Eigen::VectorXd::Zero(nu);
   }
@@ -84,15 +92,10 @@ void SolverBoxFDDP::computeGains(const std::size_t t) {
     const BoxQPSolution& boxqp_sol =
         qp_.solve(Quu_[t], Qu_[t], du_lb_[t], du_ub_[t], k_[t]);
 
-    // Compute controls
-    Quu_inv_[t].setZero();
-    for (std::size_t i = 0; i < boxqp_sol.free_idx.size(); ++i) {
-      for (std::size_t j = 0; j < boxqp_sol.free_idx.size(); ++j) {
-        Quu_inv_[t](boxqp_sol.free_idx[i], boxqp_sol.free_idx[j]) =
-            boxqp_sol.Hff_inv(i, j);
-      }
-    }
-    K_[t].noalias() = Quu_inv_[t] * Qxu_[t].transpose();
+    // Compute controls by triangular solves with the Cholesky factor of the
+    // free space Hessian
+    K_[t] = Qxu_[t].transpose();
+    qp_.solveFreeInPlace(K_[t]);
     k_[t] = -boxqp_sol.x;
 
     // The box-QP clamped the gradient direction; this is important for
@@ -197,7 +200,9 @@ void SolverBoxFDDP::forwardPass(const double steplength) {
 }
 
 const std::vector<Eigen::MatrixXd>& SolverBoxFDDP::get_Quu_inv() const {
-  return Quu_inv_;
+  throw_pretty("Invalid call: "
+               << "the inverse of Quu is not computed anymore, the feedback "
+                  "gains are computed by triangular solves in the box QP");
 }
 
 }  // namespace crocoddyl
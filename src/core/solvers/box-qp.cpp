@@ -8,6 +8,8 @@
 
 #include "crocoddyl/core/solvers/box-qp.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "crocoddyl/core/utils/exception.hpp"
@@ -23,14 +25,19 @@ BoxQP::BoxQP(const std::size_t nx, const std::size_t maxiter,
       reg_(reg),
       fold_(0.),
       fnew_(0.),
+      nf_(0),
+      nc_(0),
       x_(nx),
       xnew_(nx),
       g_(nx),
       dx_(nx),
-      xo_(nx),
       dxo_(nx),
       qo_(nx),
-      Ho_(nx, nx) {
+      with_inverse_(true),
+      clamped_(nx, false),
+      changes_(nx),
+      L_(nx, nx),
+      w_(nx) {
   // Check if values have a proper range
   if (0. >= th_acceptstep && th_acceptstep >= 0.5) {
     std::cerr << "Warning: th_acceptstep value should between 0 and 0.5"
@@ -48,10 +55,10 @@ BoxQP::BoxQP(const std::size_t nx, const std::size_t maxiter,
   xnew_.setZero();
   g_.setZero();
   dx_.setZero();
-  xo_.setZero();
   dxo_.setZero();
   qo_.setZero();
-  Ho_.setZero();
+  L_.setZero();
+  w_.setZero();
 
   // Reserve the space and compute alphas
   solution_.x = Eigen::VectorXd::Zero(nx);
@@ -103,63 +110,61 @@ const BoxQPSolution& BoxQP::solve(const Eigen::MatrixXd& H,
     x_(i) = std::max(std::min(xinit(i), ub(i)), lb(i));
   }
 
-  // Start the numerical iterations
+  // Start the numerical iterations. The Cholesky factor of the free space
+  // Hessian is computed in the first iteration, and then it is modified as
+  // the active set changes
+  bool factorized = false;
   for (std::size_t k = 0; k < maxiter_; ++k) {
-    solution_.clamped_idx.clear();
-    solution_.free_idx.clear();
     // Compute the Cauchy point and active set
     g_ = q;
     g_.noalias() += H * x_;
+    std::size_t nchanges = 0;
     for (std::size_t j = 0; j < nx_; ++j) {
       const double gj = g_(j);
       const double xj = x_(j);
-      const double lbj = lb(j);
-      const double ubj = ub(j);
-      if ((xj == lbj && gj > 0.) || (xj == ubj && gj < 0.)) {
-        solution_.clamped_idx.push_back(j);
-      } else {
-        solution_.free_idx.push_back(j);
+      const bool clamped =
+          (xj == lb(j) && gj > 0.) || (xj == ub(j) && gj < 0.);
+      if (clamped != clamped_[j]) {
+        clamped_[j] = clamped;
+        changes_[nchanges++] = j;
       }
     }
 
+    // Each rank-one modification has a quadratic cost, then we refactorize
+    // when many variables change their status
+    bool success = factorized && 3 * nchanges <= nf_;
+    if (success) {
+      // Remove variables first since updates cannot fail
+      for (std::size_t i = 0; i < nchanges; ++i) {
+        if (clamped_[changes_[i]]) {
+          removeFree(changes_[i]);
+        }
+      }
+      for (std::size_t i = 0; i < nchanges && success; ++i) {
+        if (!clamped_[changes_[i]]) {
+          success = addFree(H, changes_[i]);
+        }
+      }
+    }
+    if (!success) {
+      if (!factorize(H)) {
+        throw_pretty("backward_error");
+      }
+      factorized = true;
+    }
+
     // Compute the search direction as Newton step along the free space
-    nf_ = solution_.free_idx.size();
-    nc_ = solution_.clamped_idx.size();
-    Eigen::VectorBlock<Eigen::VectorXd> xf = xo_.head(nf_);
-    Eigen::VectorBlock<Eigen::VectorXd> xc = xo_.tail(nc_);
+    nc_ = nx_ - nf_;
     Eigen::VectorBlock<Eigen::VectorXd> dxf = dxo_.head(nf_);
     Eigen::VectorBlock<Eigen::VectorXd> qf = qo_.head(nf_);
-    Eigen::Block<Eigen::MatrixXd> Hff = Ho_.topLeftCorner(nf_, nf_);
-    Eigen::Block<Eigen::MatrixXd> Hfc = Ho_.topRightCorner(nf_, nc_);
+    const Eigen::Block<Eigen::MatrixXd> Lff = L_.topLeftCorner(nf_, nf_);
     for (std::size_t i = 0; i < nf_; ++i) {
       const std::size_t fi = solution_.free_idx[i];
-      qf(i) = q(fi);
-      xf(i) = x_(fi);
-      for (std::size_t j = 0; j < nf_; ++j) {
-        Hff(i, j) = H(fi, solution_.free_idx[j]);
-      }
-      for (std::size_t j = 0; j < nc_; ++j) {
-        const std::size_t cj = solution_.clamped_idx[j];
-        xc(j) = x_(cj);
-        Hfc(i, j) = H(fi, cj);
-      }
-    }
-    if (reg_ != 0.) {
-      Hff.diagonal().array() += reg_;
-    }
-    Hff_inv_llt_.compute(Hff);
-    const Eigen::ComputationInfo& info = Hff_inv_llt_.info();
-    if (info != Eigen::Success) {
-      throw_pretty("backward_error");
-    }
-    solution_.Hff_inv.setIdentity(nf_, nf_);
-    Hff_inv_llt_.solveInPlace(solution_.Hff_inv);
-    qf.noalias() += Hff * xf;
-    if (nc_ != 0) {
-      qf.noalias() += Hfc * xc;
+      qf(i) = g_(fi) + reg_ * x_(fi);
     }
     dxf = -qf;
-    Hff_inv_llt_.solveInPlace(dxf);
+    Lff.triangularView<Eigen::Lower>().solveInPlace(dxf);
+    Lff.transpose().triangularView<Eigen::Upper>().solveInPlace(dxf);
     dx_.setZero();
     for (std::size_t i = 0; i < nf_; ++i) {
       dx_(solution_.free_idx[i]) = dxf(i);
@@ -184,14 +189,153 @@ const BoxQPSolution& BoxQP::solve(const Eigen::MatrixXd& H,
 
     // Check convergence
     if (qf.lpNorm<Eigen::Infinity>() <= th_grad_) {
-      solution_.x = x_;
-      return solution_;
+      break;
     }
   }
   solution_.x = x_;
+  solution_.clamped_idx.clear();
+  for (std::size_t j = 0; j < nx_; ++j) {
+    if (clamped_[j]) {
+      solution_.clamped_idx.push_back(j);
+    }
+  }
+  if (with_inverse_) {
+    const Eigen::Block<Eigen::MatrixXd> Lff = L_.topLeftCorner(nf_, nf_);
+    solution_.Hff_inv.setIdentity(nf_, nf_);
+    Lff.triangularView<Eigen::Lower>().solveInPlace(solution_.Hff_inv);
+    Lff.transpose().triangularView<Eigen::Upper>().solveInPlace(
+        solution_.Hff_inv);
+  }
   return solution_;
 }
 
+void BoxQP::solveFreeInPlace(Eigen::Ref<MatrixXdRowMajor> B) {
+  if (static_cast<std::size_t>(B.rows()) != nx_) {
+    throw_pretty("Invalid argument: "
+                 << "B has wrong number of rows (it should be " +
+                        std::to_string(nx_) + ")");
+  }
+  if (Bf_.rows() != B.rows() || Bf_.cols() != B.cols()) {
+    Bf_.resize(B.rows(), B.cols());
+  }
+  Eigen::Ref<MatrixXdRowMajor> Bf = Bf_.topRows(nf_);
+  for (std::size_t i = 0; i < nf_; ++i) {
+    Bf.row(i) = B.row(solution_.free_idx[i]);
+  }
+  const Eigen::Block<Eigen::MatrixXd> Lff = L_.topLeftCorner(nf_, nf_);
+  Lff.triangularView<Eigen::Lower>().solveInPlace(Bf);
+  Lff.transpose().triangularView<Eigen::Upper>().solveInPlace(Bf);
+  B.setZero();
+  for (std::size_t i = 0; i < nf_; ++i) {
+    B.row(solution_.free_idx[i]) = Bf.row(i);
+  }
+}
+
+bool BoxQP::factorize(const Eigen::MatrixXd& H) {
+  solution_.free_idx.clear();
+  for (std::size_t j = 0; j < nx_; ++j) {
+    if (!clamped_[j]) {
+      solution_.free_idx.push_back(j);
+    }
+  }
+  nf_ = solution_.free_idx.size();
+  // Only the lower triangular part is used by the Cholesky decomposition
+  for (std::size_t j = 0; j < nf_; ++j) {
+    const std::size_t fj = solution_.free_idx[j];
+    for (std::size_t i = j; i < nf_; ++i) {
+      L_(i, j) = H(solution_.free_idx[i], fj);
+    }
+    L_(j, j) += reg_;
+  }
+  Eigen::Ref<Eigen::MatrixXd> Lff = L_.topLeftCorner(nf_, nf_);
+  const Eigen::LLT<Eigen::Ref<Eigen::MatrixXd> > llt(Lff);
+  return llt.info() == Eigen::Success;
+}
+
+void BoxQP::removeFree(const std::size_t j) {
+  std::vector<std::size_t>& free_idx = solution_.free_idx;
+  const std::size_t p =
+      std::lower_bound(free_idx.begin(), free_idx.end(), j) - free_idx.begin();
+  const std::size_t m = nf_ - p - 1;
+  w_.head(m) = L_.col(p).segment(p + 1, m);
+  // Delete the p-th row and column of the factor
+  for (std::size_t c = 0; c < p; ++c) {
+    for (std::size_t r = p; r + 1 < nf_; ++r) {
+      L_(r, c) = L_(r + 1, c);
+    }
+  }
+  for (std::size_t c = p; c + 1 < nf_; ++c) {
+    for (std::size_t r = c; r + 1 < nf_; ++r) {
+      L_(r, c) = L_(r + 1, c + 1);
+    }
+  }
+  rankUpdate(L_.block(p, p, m, m), w_.head(m), 1.);
+  free_idx.erase(free_idx.begin() + p);
+  --nf_;
+}
+
+bool BoxQP::addFree(const Eigen::MatrixXd& H, const std::size_t j) {
+  std::vector<std::size_t>& free_idx = solution_.free_idx;
+  const std::size_t p =
+      std::lower_bound(free_idx.begin(), free_idx.end(), j) - free_idx.begin();
+  const std::size_t m = nf_ - p;
+  // Make room for the p-th row and column of the factor
+  for (std::size_t c = 0; c < p; ++c) {
+    for (std::size_t r = nf_; r-- > p;) {
+      L_(r + 1, c) = L_(r, c);
+    }
+  }
+  for (std::size_t c = nf_; c-- > p;) {
+    for (std::size_t r = nf_; r-- > c;) {
+      L_(r + 1, c + 1) = L_(r, c);
+    }
+  }
+  // Compute the new row by forward substitution
+  Eigen::VectorBlock<Eigen::VectorXd> l = w_.head(p);
+  for (std::size_t i = 0; i < p; ++i) {
+    l(i) = H(free_idx[i], j);
+  }
+  L_.topLeftCorner(p, p).triangularView<Eigen::Lower>().solveInPlace(l);
+  L_.row(p).head(p) = l.transpose();
+  const double d2 = H(j, j) + reg_ - l.squaredNorm();
+  if (d2 <= 0.) {
+    return false;
+  }
+  const double d = std::sqrt(d2);
+  L_(p, p) = d;
+  // Compute the new column and downdate the trailing factor
+  Eigen::VectorBlock<Eigen::VectorXd> v = w_.segment(p, m);
+  for (std::size_t i = 0; i < m; ++i) {
+    v(i) = (H(free_idx[p + i], j) - L_.row(p + 1 + i).head(p).dot(l)) / d;
+  }
+  L_.col(p).segment(p + 1, m) = v;
+  free_idx.insert(free_idx.begin() + p, j);
+  ++nf_;
+  return rankUpdate(L_.block(p + 1, p + 1, m, m), v, -1.);
+}
+
+bool BoxQP::rankUpdate(Eigen::Ref<Eigen::MatrixXd> L,
+                       Eigen::Ref<Eigen::VectorXd> w, const double sigma) {
+  const Eigen::Index n = w.size();
+  for (Eigen::Index i = 0; i < n; ++i) {
+    const double Lii = L(i, i);
+    const double r2 = Lii * Lii + sigma * w(i) * w(i);
+    if (r2 <= 0.) {
+      return false;
+    }
+    const double r = std::sqrt(r2);
+    const double c = r / Lii;
+    const double s = w(i) / Lii;
+    L(i, i) = r;
+    const Eigen::Index m = n - i - 1;
+    if (m > 0) {
+      L.col(i).tail(m) = (L.col(i).tail(m) + sigma * s * w.tail(m)) / c;
+      w.tail(m) = c * w.tail(m) - s * L.col(i).tail(m);
+    }
+  }
+  return true;
+}
+
 const BoxQPSolution& BoxQP::get_solution() const { return solution_; }
 
 std::size_t BoxQP::get_nx() const { return nx_; }
@@ -206,16 +350,23 @@ double BoxQP::get_reg() const { return reg_; }
 
 const std::vector<double>& BoxQP::get_alphas() const { return alphas_; }
 
+bool BoxQP::get_with_inverse() const { return with_inverse_; }
+
 void BoxQP::set_nx(const std::size_t nx) {
   nx_ = nx;
   x_.conservativeResize(nx);
   xnew_.conservativeResize(nx);
   g_.conservativeResize(nx);
   dx_.conservativeResize(nx);
-  xo_.conservativeResize(nx);
   dxo_.conservativeResize(nx);
   qo_.conservativeResize(nx);
-  Ho_.conservativeResize(nx, nx);
+  clamped_.assign(nx, false);
+  changes_.resize(nx);
+  L_.conservativeResize(nx, nx);
+  w_.conservativeResize(nx);
+  solution_.free_idx.reserve(nx);
+  solution_.clamped_idx.reserve(nx);
+  nf_ = 0;
 }
 
 void BoxQP::set_maxiter(const std::size_t maxiter) { maxiter_ = maxiter; }
@@ -261,4 +412,8 @@ void BoxQP::set_alphas(const std::vector<double>& alphas) {
   alphas_ = alphas;
 }
 
+void BoxQP::set_with_inverse(const bool with_inverse) {
+  with_inverse_ = with_inverse;
+}
+
 }  // namespace crocoddyl
@@ -9,6 +9,7 @@
 
 #include "crocoddyl/core/solvers/ddp.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 #include "crocoddyl/core/utils/exception.hpp"
@@ -32,6 +33,7 @@ SolverDDP::SolverDDP(std::shared_ptr<ShootingProblem> problem)
   for (std::size_t n = 0; n < n_alphas; ++n) {
     alphas_[n] = 1. / pow(2., static_cast<double>(n));
   }
+  reserveIterationStats(n_alphas);
   if (th_stepinc_ < alphas_[n_alphas - 1]) {
     th_stepinc_ = alphas_[n_alphas - 1];
     std::cerr << "Warning: th_stepinc has higher value than lowest alpha "
@@ -47,6 +49,7 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
                       const std::size_t maxiter, const bool is_feasible,
                       const double init_reg) {
   START_PROFILER("SolverDDP::solve");
+  startClock();
   if (problem_->is_updated()) {
     resizeData();
   }
@@ -65,6 +68,12 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
 
   bool recalcDiff = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isDeadlineReached(direction_time_)) {
+      deadline_status_ = DeadlineIteration;
+      break;
+    }
+    startIterationStats();
+    double tic = elapsedTime();
     while (true) {
       try {
         computeDirection(recalcDiff);
@@ -72,6 +81,8 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
         recalcDiff = false;
         increaseRegularization();
         if (preg_ == reg_max_) {
+          recordIterationStats();
+          STOP_PROFILER("SolverDDP::solve");
           return false;
         } else {
           continue;
@@ -79,17 +90,32 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
       break;
     }
+    direction_time_ = elapsedTime() - tic;
     expectedImprovement();
 
+    if (isDeadlineReached(trystep_time_)) {
+      deadline_status_ = DeadlineBackwardPass;
+      recordIterationStats();
+      break;
+    }
+
     // We need to recalculate the derivatives when the step length passes
     recalcDiff = false;
     for (std::vector<double>::const_iterator it = alphas_.begin();
          it != alphas_.end(); ++it) {
       steplength_ = *it;
+      if (it != alphas_.begin() && isDeadlineReached(trystep_time_)) {
+        deadline_status_ = DeadlineLineSearch;
+        break;
+      }
+      tic = elapsedTime();
 
       try {
         dV_ = tryStep(steplength_);
+        trystep_time_ = elapsedTime() - tic;
+        iter_stats_.trial_times.push_back(trystep_time_);
       } catch (std::exception& e) {
+        iter_stats_.trial_times.push_back(elapsedTime() - tic);
         continue;
       }
       dVexp_ = steplength_ * (d_[0] + 0.5 * steplength_ * d_[1]);
@@ -106,17 +132,23 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
     }
 
+    if (deadline_status_ != DeadlineNone) {
+      recordIterationStats();
+      break;
+    }
     if (steplength_ > th_stepdec_) {
       decreaseRegularization();
     }
     if (steplength_ <= th_stepinc_) {
       increaseRegularization();
       if (preg_ == reg_max_) {
+        recordIterationStats();
         STOP_PROFILER("SolverDDP::solve");
         return false;
       }
     }
     stoppingCriteria();
+    recordIterationStats();
 
     const std::size_t n_callbacks = callbacks_.size();
     for (std::size_t c = 0; c < n_callbacks; ++c) {
@@ -135,10 +167,23 @@ bool SolverDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
 
 void SolverDDP::computeDirection(const bool recalcDiff) {
   START_PROFILER("SolverDDP::computeDirection");
+  double tic = elapsedTime();
   if (recalcDiff) {
     calcDiff();
-  }
-  backwardPass();
+    const double toc = elapsedTime();
+    iter_stats_.calc_time += toc - tic;
+    tic = toc;
+  }
+  iter_stats_.preg = preg_;
+  iter_stats_.dreg = dreg_;
+  try {
+    backwardPass();
+  } catch (std::exception& e) {
+    iter_stats_.backward_time += elapsedTime() - tic;
+    STOP_PROFILER("SolverDDP::computeDirection");
+    throw;
+  }
+  iter_stats_.backward_time += elapsedTime() - tic;
   STOP_PROFILER("SolverDDP::computeDirection");
 }
 
@@ -199,12 +244,57 @@ void SolverDDP::resizeData() {
   STOP_PROFILER("SolverDDP::resizeData");
 }
 
+void SolverDDP::rolloutPolicy(const std::size_t t,
+                              const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::Ref<Eigen::VectorXd> u) {
+  problem_->get_runningModels()[t]->get_state()->diff(xs_[t], x, dx_[t]);
+  u = us_[t];
+  u.noalias() -= K_[t] * dx_[t];
+}
+
+void SolverDDP::shiftData(const std::size_t n) {
+  START_PROFILER("SolverDDP::shiftData");
+  SolverAbstract::shiftData(n);
+  std::rotate(xs_try_.begin(), xs_try_.begin() + n, xs_try_.end());
+  std::rotate(Vxx_.begin(), Vxx_.begin() + n, Vxx_.end());
+  std::rotate(Vx_.begin(), Vx_.begin() + n, Vx_.end());
+  std::rotate(Qxx_.begin(), Qxx_.begin() + n, Qxx_.end());
+  std::rotate(Qxu_.begin(), Qxu_.begin() + n, Qxu_.end());
+  std::rotate(Quu_.begin(), Quu_.begin() + n, Quu_.end());
+  std::rotate(Qx_.begin(), Qx_.begin() + n, Qx_.end());
+  std::rotate(Qu_.begin(), Qu_.begin() + n, Qu_.end());
+  std::rotate(K_.begin(), K_.begin() + n, K_.end());
+  std::rotate(k_.begin(), k_.begin() + n, k_.end());
+  std::rotate(us_try_.begin(), us_try_.begin() + n, us_try_.end());
+  std::rotate(dx_.begin(), dx_.begin() + n, dx_.end());
+  std::rotate(FuTVxx_p_.begin(), FuTVxx_p_.begin() + n, FuTVxx_p_.end());
+  std::rotate(Quuk_.begin(), Quuk_.begin() + n, Quuk_.end());
+
+  // The appended nodes reuse the gains of the last shifted node, and the
+  // terminal value function approximates their value function
+  const std::size_t T = problem_->get_T();
+  const std::size_t m = T - n;
+  for (std::size_t t = m; t < T; ++t) {
+    const std::size_t nu = problem_->get_runningModels()[t]->get_nu();
+    if (m > 0 && static_cast<std::size_t>(K_[m - 1].rows()) == nu) {
+      K_[t] = K_[m - 1];
+    } else {
+      K_[t].setZero(nu, K_[t].cols());
+    }
+    k_[t].setZero(nu);
+    Vxx_[t + 1] = Vxx_[m];
+    Vx_[t + 1] = Vx_[m];
+  }
+  STOP_PROFILER("SolverDDP::shiftData");
+}
+
 double SolverDDP::calcDiff() {
   START_PROFILER("SolverDDP::calcDiff");
   if (iter_ == 0) {
-    problem_->calc(xs_, us_);
+    cost_ = problem_->calcAndDiff(xs_, us_);
+  } else {
+    cost_ = problem_->calcDiff(xs_, us_);
   }
-  cost_ = problem_->calcDiff(xs_, us_);
 
   ffeas_ = computeDynamicFeasibility();
   gfeas_ = computeInequalityFeasibility();
@@ -515,6 +605,41 @@ SolverDDP::get_K() const {
 
 const std::vector<Eigen::VectorXd>& SolverDDP::get_k() const { return k_; }
 
+void SolverDDP::set_K(const std::vector<MatrixXdRowMajor>& K) {
+  const std::size_t T = problem_->get_T();
+  if (K.size() != T) {
+    throw_pretty("Invalid argument: " << "K list has to be of length " +
+                                             std::to_string(T));
+  }
+  for (std::size_t t = 0; t < T; ++t) {
+    if (K[t].rows() != K_[t].rows() || K[t].cols() != K_[t].cols()) {
+      throw_pretty("Invalid argument: "
+                   << "K[" + std::to_string(t) + "] has wrong dimension ("
+                   << K[t].rows() << "x" << K[t].cols()
+                   << " provided - it should be " << K_[t].rows() << "x"
+                   << K_[t].cols() << ")")
+    }
+  }
+  K_ = K;
+}
+
+void SolverDDP::set_k(const std::vector<Eigen::VectorXd>& k) {
+  const std::size_t T = problem_->get_T();
+  if (k.size() != T) {
+    throw_pretty("Invalid argument: " << "k list has to be of length " +
+                                             std::to_string(T));
+  }
+  for (std::size_t t = 0; t < T; ++t) {
+    if (k[t].size() != k_[t].size()) {
+      throw_pretty("Invalid argument: "
+                   << "k[" + std::to_string(t) + "] has wrong dimension ("
+                   << k[t].size()
+                   << " provided - it should be " << k_[t].size() << ")")
+    }
+  }
+  k_ = k;
+}
+
 void SolverDDP::set_reg_incfactor(const double regfactor) {
   if (regfactor <= 1.) {
     throw_pretty(
@@ -584,6 +709,7 @@ void SolverDDP::set_alphas(const std::vector<double>& alphas) {
     prev_alpha = alpha;
   }
   alphas_ = alphas;
+  reserveIterationStats(alphas_.size());
 }
 
 void SolverDDP::set_th_stepdec(const double th_stepdec) {
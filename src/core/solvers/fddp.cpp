@@ -26,6 +26,7 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
                        const std::size_t maxiter, const bool is_feasible,
                        const double init_reg) {
   START_PROFILER("SolverFDDP::solve");
+  startClock();
   if (problem_->is_updated()) {
     resizeData();
   }
@@ -44,6 +45,12 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
 
   bool recalcDiff = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isDeadlineReached(direction_time_)) {
+      deadline_status_ = DeadlineIteration;
+      break;
+    }
+    startIterationStats();
+    double tic = elapsedTime();
     while (true) {
       try {
         computeDirection(recalcDiff);
@@ -51,6 +58,8 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
         recalcDiff = false;
         increaseRegularization();
         if (preg_ == reg_max_) {
+          recordIterationStats();
+          STOP_PROFILER("SolverFDDP::solve");
           return false;
         } else {
           continue;
@@ -58,17 +67,32 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
       break;
     }
+    direction_time_ = elapsedTime() - tic;
     updateExpectedImprovement();
 
+    if (isDeadlineReached(trystep_time_)) {
+      deadline_status_ = DeadlineBackwardPass;
+      recordIterationStats();
+      break;
+    }
+
     // We need to recalculate the derivatives when the step length passes
     recalcDiff = false;
     for (std::vector<double>::const_iterator it = alphas_.begin();
          it != alphas_.end(); ++it) {
       steplength_ = *it;
+      if (it != alphas_.begin() && isDeadlineReached(trystep_time_)) {
+        deadline_status_ = DeadlineLineSearch;
+        break;
+      }
+      tic = elapsedTime();
 
       try {
         dV_ = tryStep(steplength_);
+        trystep_time_ = elapsedTime() - tic;
+        iter_stats_.trial_times.push_back(trystep_time_);
       } catch (std::exception& e) {
+        iter_stats_.trial_times.push_back(elapsedTime() - tic);
         continue;
       }
       expectedImprovement();
@@ -94,17 +118,23 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
     }
 
+    if (deadline_status_ != DeadlineNone) {
+      recordIterationStats();
+      break;
+    }
     if (steplength_ > th_stepdec_) {
       decreaseRegularization();
     }
     if (steplength_ <= th_stepinc_) {
       increaseRegularization();
       if (preg_ == reg_max_) {
+        recordIterationStats();
         STOP_PROFILER("SolverFDDP::solve");
         return false;
       }
     }
     stoppingCriteria();
+    recordIterationStats();
 
     const std::size_t n_callbacks = callbacks_.size();
     for (std::size_t c = 0; c < n_callbacks; ++c) {
@@ -121,6 +151,60 @@ bool SolverFDDP::solve(const std::vector<Eigen::VectorXd>& init_xs,
   return false;
 }
 
+bool SolverFDDP::prepareRTI() {
+  START_PROFILER("SolverFDDP::prepareRTI");
+  if (problem_->is_updated()) {
+    resizeData();
+  }
+  if (std::isnan(preg_) || preg_ < reg_min_) {
+    preg_ = reg_min_;
+    dreg_ = reg_min_;
+  }
+  // The guess might not be evaluated (e.g., after a shift), so the derivatives
+  // are computed together with the dynamics and costs
+  iter_ = 0;
+  bool recalcDiff = true;
+  while (true) {
+    try {
+      computeDirection(recalcDiff);
+    } catch (std::exception& e) {
+      recalcDiff = false;
+      increaseRegularization();
+      if (preg_ == reg_max_) {
+        STOP_PROFILER("SolverFDDP::prepareRTI");
+        return false;
+      } else {
+        continue;
+      }
+    }
+    break;
+  }
+  updateExpectedImprovement();
+  STOP_PROFILER("SolverFDDP::prepareRTI");
+  return true;
+}
+
+bool SolverFDDP::feedbackRTI(const Eigen::VectorXd& x0) {
+  START_PROFILER("SolverFDDP::feedbackRTI");
+  problem_->set_x0(x0);
+  try {
+    dV_ = tryStep(1.);
+  } catch (std::exception& e) {
+    STOP_PROFILER("SolverFDDP::feedbackRTI");
+    return false;
+  }
+  // Accept the rollout without copying the trajectories
+  steplength_ = 1.;
+  was_feasible_ = is_feasible_;
+  xs_.swap(xs_try_);
+  us_.swap(us_try_);
+  is_feasible_ = true;
+  cost_ = cost_try_;
+  decreaseRegularization();
+  STOP_PROFILER("SolverFDDP::feedbackRTI");
+  return true;
+}
+
 const Eigen::Vector2d& SolverFDDP::expectedImprovement() {
   dv_ = 0;
   const std::size_t T = this->problem_->get_T();
@@ -8,7 +8,9 @@
 
 #include "crocoddyl/core/solvers/intro.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 #include "crocoddyl/core/utils/exception.hpp"
 #include "crocoddyl/core/utils/stop-watch.hpp"
@@ -36,12 +38,14 @@ SolverIntro::SolverIntro(std::shared_ptr<ShootingProblem> problem)
   ks_.resize(T);
   Ks_.resize(T);
   QuuinvHuT_.resize(T);
-  Qzz_llt_.resize(T);
   Hu_lu_.resize(T);
   Hu_qr_.resize(T);
   Hy_lu_.resize(T);
+  Hu_cache_.resize(T);
+  YZ_ws_.resize(T);
 
   const std::size_t ndx = problem_->get_ndx();
+  std::size_t nz_max = 0;
   const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
       problem_->get_runningModels();
   for (std::size_t t = 0; t < T; ++t) {
@@ -61,11 +65,17 @@ SolverIntro::SolverIntro(std::shared_ptr<ShootingProblem> problem)
     ks_[t] = Eigen::VectorXd::Zero(nh);
     Ks_[t] = Eigen::MatrixXd::Zero(nh, ndx);
     QuuinvHuT_[t] = Eigen::MatrixXd::Zero(nu, nh);
-    Qzz_llt_[t] = Eigen::LLT<Eigen::MatrixXd>(nh);
     Hu_lu_[t] = Eigen::FullPivLU<Eigen::MatrixXd>(nh, nu);
     Hu_qr_[t] = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>(nu, nh);
     Hy_lu_[t] = Eigen::PartialPivLU<Eigen::MatrixXd>(nh);
+    // NaN values never match a control Jacobian, then the first call to
+    // calcDiff always computes the span and kernel matrices
+    Hu_cache_[t] = Eigen::MatrixXd::Constant(
+        nh, nu, std::numeric_limits<double>::quiet_NaN());
+    YZ_ws_[t] = Eigen::MatrixXd::Zero(nu, nu);
+    nz_max = std::max(nz_max, std::max(nu, nh));
   }
+  Qzz_L_ = Eigen::MatrixXd::Zero(nz_max, nz_max);
 }
 
 SolverIntro::~SolverIntro() {}
@@ -75,6 +85,7 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
                         const std::size_t maxiter, const bool is_feasible,
                         const double init_reg) {
   START_PROFILER("SolverIntro::solve");
+  startClock();
   if (problem_->is_updated()) {
     resizeData();
   }
@@ -96,6 +107,12 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
 
   bool recalcDiff = true;
   for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isDeadlineReached(direction_time_)) {
+      deadline_status_ = DeadlineIteration;
+      break;
+    }
+    startIterationStats();
+    double tic = elapsedTime();
     while (true) {
       try {
         computeDirection(recalcDiff);
@@ -103,6 +120,8 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
         recalcDiff = false;
         increaseRegularization();
         if (preg_ == reg_max_) {
+          recordIterationStats();
+          STOP_PROFILER("SolverIntro::solve");
           return false;
         } else {
           continue;
@@ -110,6 +129,7 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
       break;
     }
+    direction_time_ = elapsedTime() - tic;
     updateExpectedImprovement();
     expectedImprovement();
 
@@ -121,16 +141,30 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
           std::max(upsilon_, (d_[0] + .5 * d_[1]) / ((1 - rho_) * hfeas_));
     }
 
+    if (isDeadlineReached(trystep_time_)) {
+      deadline_status_ = DeadlineBackwardPass;
+      recordIterationStats();
+      break;
+    }
+
     // We need to recalculate the derivatives when the step length passes
     recalcDiff = false;
     for (std::vector<double>::const_iterator it = alphas_.begin();
          it != alphas_.end(); ++it) {
       steplength_ = *it;
+      if (it != alphas_.begin() && isDeadlineReached(trystep_time_)) {
+        deadline_status_ = DeadlineLineSearch;
+        break;
+      }
+      tic = elapsedTime();
       try {
         dV_ = tryStep(steplength_);
+        trystep_time_ = elapsedTime() - tic;
+        iter_stats_.trial_times.push_back(trystep_time_);
         dfeas_ = hfeas_ - hfeas_try_;
         dPhi_ = dV_ + upsilon_ * dfeas_;
       } catch (std::exception& e) {
+        iter_stats_.trial_times.push_back(elapsedTime() - tic);
         continue;
       }
       expectedImprovement();
@@ -160,7 +194,13 @@ bool SolverIntro::solve(const std::vector<Eigen::VectorXd>& init_xs,
       }
     }
 
+    if (deadline_status_ != DeadlineNone) {
+      recordIterationStats();
+      break;
+    }
+
     stoppingCriteria();
+    recordIterationStats();
     const std::size_t n_callbacks = callbacks_.size();
     for (std::size_t c = 0; c < n_callbacks; ++c) {
       CallbackAbstract& callback = *callbacks_[c];
@@ -206,6 +246,7 @@ void SolverIntro::resizeData() {
   const std::size_t ndx = problem_->get_ndx();
   const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
       problem_->get_runningModels();
+  std::size_t nz_max = 0;
   for (std::size_t t = 0; t < T; ++t) {
     const std::shared_ptr<ActionModelAbstract>& model = models[t];
     const std::size_t nu = model->get_nu();
@@ -222,10 +263,45 @@ void SolverIntro::resizeData() {
     ks_[t].conservativeResize(nh);
     Ks_[t].conservativeResize(nh, ndx);
     QuuinvHuT_[t].conservativeResize(nu, nh);
+    Hu_cache_[t].setConstant(nh, nu, std::numeric_limits<double>::quiet_NaN());
+    YZ_ws_[t].conservativeResize(nu, nu);
+    nz_max = std::max(nz_max, std::max(nu, nh));
   }
+  Qzz_L_.conservativeResize(nz_max, nz_max);
   STOP_PROFILER("SolverIntro::resizeData");
 }
 
+void SolverIntro::shiftData(const std::size_t n) {
+  START_PROFILER("SolverIntro::shiftData");
+  SolverFDDP::shiftData(n);
+  std::rotate(Hu_rank_.begin(), Hu_rank_.begin() + n, Hu_rank_.end());
+  std::rotate(KQuu_tmp_.begin(), KQuu_tmp_.begin() + n, KQuu_tmp_.end());
+  std::rotate(YZ_.begin(), YZ_.begin() + n, YZ_.end());
+  std::rotate(Hy_.begin(), Hy_.begin() + n, Hy_.end());
+  std::rotate(Qz_.begin(), Qz_.begin() + n, Qz_.end());
+  std::rotate(Qzz_.begin(), Qzz_.begin() + n, Qzz_.end());
+  std::rotate(Qxz_.begin(), Qxz_.begin() + n, Qxz_.end());
+  std::rotate(Quz_.begin(), Quz_.begin() + n, Quz_.end());
+  std::rotate(kz_.begin(), kz_.begin() + n, kz_.end());
+  std::rotate(Kz_.begin(), Kz_.begin() + n, Kz_.end());
+  std::rotate(ks_.begin(), ks_.begin() + n, ks_.end());
+  std::rotate(Ks_.begin(), Ks_.begin() + n, Ks_.end());
+  std::rotate(QuuinvHuT_.begin(), QuuinvHuT_.begin() + n, QuuinvHuT_.end());
+  std::rotate(Hu_cache_.begin(), Hu_cache_.begin() + n, Hu_cache_.end());
+  std::rotate(YZ_ws_.begin(), YZ_ws_.begin() + n, YZ_ws_.end());
+  std::rotate(Hu_lu_.begin(), Hu_lu_.begin() + n, Hu_lu_.end());
+  std::rotate(Hu_qr_.begin(), Hu_qr_.begin() + n, Hu_qr_.end());
+  std::rotate(Hy_lu_.begin(), Hy_lu_.begin() + n, Hy_lu_.end());
+
+  // The appended nodes are usually replaced, so their span and kernel
+  // matrices are recomputed
+  const std::size_t T = problem_->get_T();
+  for (std::size_t t = T - n; t < T; ++t) {
+    Hu_cache_[t].setConstant(std::numeric_limits<double>::quiet_NaN());
+  }
+  STOP_PROFILER("SolverIntro::shiftData");
+}
+
 double SolverIntro::calcDiff() {
   START_PROFILER("SolverIntro::calcDiff");
   SolverFDDP::calcDiff();
@@ -244,18 +320,34 @@ double SolverIntro::calcDiff() {
             models[t];
         const std::shared_ptr<crocoddyl::ActionDataAbstract>& data = datas[t];
         if (model->get_nu() > 0 && model->get_nh() > 0) {
-          Hu_lu_[t].compute(data->Hu);
-          YZ_[t] << Hu_lu_[t].matrixLU().transpose(), Hu_lu_[t].kernel();
-          Hu_rank_[t] = Hu_lu_[t].rank();
+          // The span and kernel matrices are reused when the control Jacobian
+          // has not changed since the previous iteration
+          if (data->Hu != Hu_cache_[t]) {
+            Hu_cache_[t] = data->Hu;
+            Hu_lu_[t].compute(data->Hu);
+            const Eigen::MatrixXd& LU = Hu_lu_[t].matrixLU();
+            const std::size_t rank = Hu_lu_[t].rank();
+            const std::size_t nullity = data->Hu.cols() - rank;
+            Hu_rank_[t] = rank;
+            YZ_[t].leftCols(rank) = LU.topRows(rank).transpose();
+            // Kernel from the upper-triangular factor, i.e.,
+            // Z = Q [-U11^{-1} U12; I]
+            Eigen::Block<Eigen::MatrixXd> W =
+                YZ_ws_[t].topLeftCorner(data->Hu.cols(), nullity);
+            W.topRows(rank) = -LU.topRightCorner(rank, nullity);
+            LU.topLeftCorner(rank, rank)
+                .triangularView<Eigen::Upper>()
+                .solveInPlace(W.topRows(rank));
+            W.bottomRows(nullity).setIdentity();
+            YZ_[t].rightCols(nullity) = Hu_lu_[t].permutationQ() * W;
+            Hy_[t].noalias() = data->Hu * YZ_[t].leftCols(rank);
+            Hy_lu_[t].compute(Hy_[t]);
+          }
           const Eigen::Block<Eigen::MatrixXd, Eigen::Dynamic, Eigen::Dynamic,
                              Eigen::RowMajor>
-              Y = YZ_[t].leftCols(Hu_lu_[t].rank());
-          Hy_[t].noalias() = data->Hu * Y;
-          Hy_lu_[t].compute(Hy_[t]);
-          const Eigen::Inverse<Eigen::PartialPivLU<Eigen::MatrixXd> > Hy_inv =
-              Hy_lu_[t].inverse();
-          ks_[t].noalias() = Hy_inv * data->h;
-          Ks_[t].noalias() = Hy_inv * data->Hx;
+              Y = YZ_[t].leftCols(Hu_rank_[t]);
+          ks_[t] = Hy_lu_[t].solve(data->h);
+          Ks_[t] = Hy_lu_[t].solve(data->Hx);
           kz_[t].noalias() = Y * ks_[t];
           Kz_[t].noalias() = Y * Ks_[t];
         }
@@ -270,18 +362,21 @@ double SolverIntro::calcDiff() {
             models[t];
         const std::shared_ptr<crocoddyl::ActionDataAbstract>& data = datas[t];
         if (model->get_nu() > 0 && model->get_nh() > 0) {
-          Hu_qr_[t].compute(data->Hu.transpose());
-          YZ_[t] = Hu_qr_[t].householderQ();
-          Hu_rank_[t] = Hu_qr_[t].rank();
+          if (data->Hu != Hu_cache_[t]) {
+            Hu_cache_[t] = data->Hu;
+            Hu_qr_[t].compute(data->Hu.transpose());
+            Eigen::Block<Eigen::MatrixXd, Eigen::Dynamic, 1, true> ws =
+                YZ_ws_[t].col(0);
+            Hu_qr_[t].householderQ().evalTo(YZ_[t], ws);
+            Hu_rank_[t] = Hu_qr_[t].rank();
+            Hy_[t].noalias() = data->Hu * YZ_[t].leftCols(Hu_rank_[t]);
+            Hy_lu_[t].compute(Hy_[t]);
+          }
           const Eigen::Block<Eigen::MatrixXd, Eigen::Dynamic, Eigen::Dynamic,
                              Eigen::RowMajor>
-              Y = YZ_[t].leftCols(Hu_qr_[t].rank());
-          Hy_[t].noalias() = data->Hu * Y;
-          Hy_lu_[t].compute(Hy_[t]);
-          const Eigen::Inverse<Eigen::PartialPivLU<Eigen::MatrixXd> > Hy_inv =
-              Hy_lu_[t].inverse();
-          ks_[t].noalias() = Hy_inv * data->h;
-          Ks_[t].noalias() = Hy_inv * data->Hx;
+              Y = YZ_[t].leftCols(Hu_rank_[t]);
+          ks_[t] = Hy_lu_[t].solve(data->h);
+          Ks_[t] = Hy_lu_[t].solve(data->Hx);
           kz_[t].noalias() = Y * ks_[t];
           Kz_[t].noalias() = Y * Ks_[t];
         }
@@ -348,22 +443,24 @@ void SolverIntro::computeGains(const std::size_t t) {
             Z = YZ_[t].rightCols(nullity);
         Quz_[t].noalias() = Quu_[t] * Z;
         Qzz_[t].noalias() = Z.transpose() * Quz_[t];
-        Qzz_llt_[t].compute(Qzz_[t]);
+        Eigen::Ref<Eigen::MatrixXd> Lzz =
+            Qzz_L_.topLeftCorner(nullity, nullity);
+        Lzz = Qzz_[t];
+        const Eigen::LLT<Eigen::Ref<Eigen::MatrixXd> > Qzz_llt(Lzz);
         STOP_PROFILER("SolverIntro::Qzz_inv");
-        const Eigen::ComputationInfo& info = Qzz_llt_[t].info();
-        if (info != Eigen::Success) {
+        if (Qzz_llt.info() != Eigen::Success) {
           throw_pretty("backward error");
         }
 
         k_[t] = kz_[t];
         K_[t] = Kz_[t];
         Eigen::Transpose<Eigen::MatrixXd> QzzinvQzu = Quz_[t].transpose();
-        Qzz_llt_[t].solveInPlace(QzzinvQzu);
+        Qzz_llt.solveInPlace(QzzinvQzu);
         Qz_[t].noalias() = Z.transpose() * Qu_[t];
-        Qzz_llt_[t].solveInPlace(Qz_[t]);
+        Qzz_llt.solveInPlace(Qz_[t]);
         Qxz_[t].noalias() = Qxu_[t] * Z;
         Eigen::Transpose<Eigen::MatrixXd> Qzx = Qxz_[t].transpose();
-        Qzz_llt_[t].solveInPlace(Qzx);
+        Qzz_llt.solveInPlace(Qzx);
         Qz_[t].noalias() -= QzzinvQzu * kz_[t];
         Qzx.noalias() -= QzzinvQzu * Kz_[t];
         k_[t].noalias() += Z * Qz_[t];
@@ -379,20 +476,21 @@ void SolverIntro::computeGains(const std::size_t t) {
         QuuinvHuT_[t] = data->Hu.transpose();
         Quu_llt_[t].solveInPlace(QuuinvHuT_[t]);
         Qzz_[t].noalias() = data->Hu * QuuinvHuT_[t];
-        Qzz_llt_[t].compute(Qzz_[t]);
+        Eigen::Ref<Eigen::MatrixXd> Lzz = Qzz_L_.topLeftCorner(nh, nh);
+        Lzz = Qzz_[t];
+        const Eigen::LLT<Eigen::Ref<Eigen::MatrixXd> > Qzz_llt(Lzz);
         STOP_PROFILER("SolverIntro::Qzz_inv");
-        const Eigen::ComputationInfo& info = Qzz_llt_[t].info();
-        if (info != Eigen::Success) {
+        if (Qzz_llt.info() != Eigen::Success) {
           throw_pretty("backward error");
         }
         Eigen::Transpose<Eigen::MatrixXd> HuQuuinv = QuuinvHuT_[t].transpose();
-        Qzz_llt_[t].solveInPlace(HuQuuinv);
+        Qzz_llt.solveInPlace(HuQuuinv);
         ks_[t] = data->h;
         ks_[t].noalias() -= data->Hu * k_[t];
         Ks_[t] = data->Hx;
         Ks_[t].noalias() -= data->Hu * K_[t];
         k_[t].noalias() += QuuinvHuT_[t] * ks_[t];
-        K_[t] += QuuinvHuT_[t] * Ks_[t];
+        K_[t].noalias() += QuuinvHuT_[t] * Ks_[t];
       }
       break;
   }
@@ -443,6 +541,11 @@ const std::vector<Eigen::MatrixXd>& SolverIntro::get_Ks() const { return Ks_; }
 
 void SolverIntro::set_equality_solver(const EqualitySolverType type) {
   eq_solver_ = type;
+  // The span and kernel matrices depend on the equality solver
+  const std::size_t T = problem_->get_T();
+  for (std::size_t t = 0; t < T; ++t) {
+    Hu_cache_[t].setConstant(std::numeric_limits<double>::quiet_NaN());
+  }
 }
 
 void SolverIntro::set_th_feas(const double th_feas) { th_feas_ = th_feas; }
@@ -318,8 +318,7 @@ bool IpoptInterface::eval_grad_f(Ipopt::Index, const Ipopt::Number* x, bool,
     model->get_state()->integrate(xs_[t], datas_[t]->dx, datas_[t]->x);
     model->get_state()->Jintegrate(xs_[t], datas_[t]->dx, datas_[t]->Jint_dx,
                                    datas_[t]->Jint_dx, second, setto);
-    model->calc(data, datas_[t]->x, datas_[t]->u);
-    model->calcDiff(data, datas_[t]->x, datas_[t]->u);
+    model->calcAndDiff(data, datas_[t]->x, datas_[t]->u);
     datas_[t]->Ldx.noalias() = datas_[t]->Jint_dx.transpose() * data->Lx;
   }
   for (std::size_t t = 0; t < T; ++t) {
@@ -346,8 +345,7 @@ bool IpoptInterface::eval_grad_f(Ipopt::Index, const Ipopt::Number* x, bool,
   model->get_state()->integrate(xs_[T], datas_[T]->dx, datas_[T]->x);
   model->get_state()->Jintegrate(xs_[T], datas_[T]->dx, datas_[T]->Jint_dx,
                                  datas_[T]->Jint_dx, second, setto);
-  model->calc(data, datas_[T]->x);
-  model->calcDiff(data, datas_[T]->x);
+  model->calcAndDiff(data, datas_[T]->x);
   datas_[T]->Ldx.noalias() = datas_[T]->Jint_dx.transpose() * data->Lx;
   for (std::size_t j = 0; j < ndxi; ++j) {
     grad_f[ixu_.back() + j] = datas_[T]->Ldx(j);
@@ -693,8 +691,7 @@ bool IpoptInterface::eval_h(Ipopt::Index, const Ipopt::Number* x, bool,
     datas_[T]->dx = Eigen::VectorXd::Map(x + ixu_.back(), ndxi);
 
     model->get_state()->integrate(xs_[T], datas_[T]->dx, datas_[T]->x);
-    model->calc(data, datas_[T]->x);
-    model->calcDiff(data, datas_[T]->x);
+    model->calcAndDiff(data, datas_[T]->x);
     model->get_state()->Jintegrate(xs_[T], datas_[T]->dx, datas_[T]->Jint_dx,
                                    datas_[T]->Jint_dx, second, setto);
     datas_[T]->Ldxdx.noalias() =
@@ -193,8 +193,7 @@ std::size_t SolverKKT::get_ndx() const { return ndx_; }
 std::size_t SolverKKT::get_nu() const { return nu_; }
 
 double SolverKKT::calcDiff() {
-  cost_ = problem_->calc(xs_, us_);
-  cost_ = problem_->calcDiff(xs_, us_);
+  cost_ = problem_->calcAndDiff(xs_, us_);
 
   // offset on constraint xnext = f(x,u) due to x0 = ref.
   const std::size_t cx0 =
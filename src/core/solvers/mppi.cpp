@@ -0,0 +1,334 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#include <omp.h>
+#endif  // CROCODDYL_WITH_MULTITHREADING
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "crocoddyl/core/solvers/mppi.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+SolverMPPI::SolverMPPI(std::shared_ptr<ShootingProblem> problem,
+                       const std::size_t nsamples, const double noise,
+                       const double temperature, const unsigned int seed)
+    : SolverAbstract(problem),
+      cost_try_(0.),
+      nsamples_(nsamples),
+      noise_(noise),
+      temperature_(temperature),
+      seed_(seed) {
+  if (nsamples == 0) {
+    throw_pretty("Invalid argument: " << "nsamples should be positive");
+  }
+  if (noise < 0.) {
+    throw_pretty("Invalid argument: " << "noise should be non-negative");
+  }
+  if (temperature <= 0.) {
+    throw_pretty("Invalid argument: " << "temperature should be positive");
+  }
+  allocateData();
+  // A single rollout is tried per iteration
+  reserveIterationStats(1);
+}
+
+SolverMPPI::~SolverMPPI() {}
+
+bool SolverMPPI::solve(const std::vector<Eigen::VectorXd>& init_xs,
+                       const std::vector<Eigen::VectorXd>& init_us,
+                       const std::size_t maxiter, const bool,
+                       const double) {
+  START_PROFILER("SolverMPPI::solve");
+  startClock();
+  if (problem_->is_updated()) {
+    resizeData();
+  }
+  setCandidate(init_xs, init_us, false);
+
+  // The state trajectory is obtained by rolling out the control sequence
+  cost_ = rollout(us_, xs_);
+  merit_ = cost_;
+  is_feasible_ = true;
+  was_feasible_ = true;
+  preg_ = 0.;
+  dreg_ = 0.;
+  for (iter_ = 0; iter_ < maxiter; ++iter_) {
+    if (isDeadlineReached(direction_time_)) {
+      deadline_status_ = DeadlineIteration;
+      break;
+    }
+    startIterationStats();
+    double tic = elapsedTime();
+    try {
+      computeDirection(true);
+    } catch (std::exception& e) {
+      // All the samples diverged, so the iteration fails without reaching the
+      // stopping criteria, and new samples are drawn in the next one
+      direction_time_ = elapsedTime() - tic;
+      stop_ = std::numeric_limits<double>::infinity();
+      recordIterationStats();
+      continue;
+    }
+    direction_time_ = elapsedTime() - tic;
+
+    if (isDeadlineReached(trystep_time_)) {
+      deadline_status_ = DeadlineBackwardPass;
+      recordIterationStats();
+      break;
+    }
+
+    steplength_ = 1.;
+    tic = elapsedTime();
+    dV_ = tryStep(steplength_);
+    trystep_time_ = elapsedTime() - tic;
+    iter_stats_.trial_times.push_back(trystep_time_);
+    dVexp_ = 0.;
+
+    // Accept the rollout without copying the trajectories
+    if (dV_ >= 0.) {
+      xs_.swap(xs_try_);
+      us_.swap(us_try_);
+      cost_ = cost_try_;
+      merit_ = cost_;
+    }
+    stoppingCriteria();
+    recordIterationStats();
+
+    const std::size_t n_callbacks = callbacks_.size();
+    for (std::size_t c = 0; c < n_callbacks; ++c) {
+      CallbackAbstract& callback = *callbacks_[c];
+      callback(*this);
+    }
+
+    if (stop_ < th_stop_) {
+      STOP_PROFILER("SolverMPPI::solve");
+      return true;
+    }
+  }
+  STOP_PROFILER("SolverMPPI::solve");
+  return false;
+}
+
+void SolverMPPI::computeDirection(const bool) {
+  START_PROFILER("SolverMPPI::computeDirection");
+  const std::size_t T = problem_->get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem_->get_runningModels();
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(rngs_.size()) schedule(static)
+#endif
+  for (std::size_t k = 0; k < nsamples_; ++k) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    std::mt19937& rng = rngs_[static_cast<std::size_t>(omp_get_thread_num())];
+#else
+    std::mt19937& rng = rngs_[0];
+#endif
+    std::normal_distribution<double> normal(0., noise_);
+    std::vector<Eigen::VectorXd>& us = us_samples_[k];
+    for (std::size_t t = 0; t < T; ++t) {
+      const std::shared_ptr<ActionModelAbstract>& model = models[t];
+      Eigen::VectorXd& u = us[t];
+      const Eigen::Index nu = u.size();
+      for (Eigen::Index i = 0; i < nu; ++i) {
+        u[i] = us_[t][i] + normal(rng);
+      }
+      if (model->get_has_control_limits()) {
+        u = u.cwiseMax(model->get_u_lb()).cwiseMin(model->get_u_ub());
+      }
+    }
+  }
+  problem_->rollouts(us_samples_, DEFAULT_VECTOR, xs_samples_, costs_);
+
+  // Diverged rollouts have a zero weight
+  double cost_min = std::numeric_limits<double>::infinity();
+  for (std::size_t k = 0; k < nsamples_; ++k) {
+    if (std::isfinite(costs_[k]) && costs_[k] < cost_min) {
+      cost_min = costs_[k];
+    }
+  }
+  double weight_sum = 0.;
+  for (std::size_t k = 0; k < nsamples_; ++k) {
+    weights_[k] = std::isfinite(costs_[k])
+                      ? std::exp(-(costs_[k] - cost_min) / temperature_)
+                      : 0.;
+    weight_sum += weights_[k];
+  }
+  if (weight_sum == 0.) {
+    STOP_PROFILER("SolverMPPI::computeDirection");
+    throw_pretty("sampling_error");
+  }
+  for (std::size_t k = 0; k < nsamples_; ++k) {
+    weights_[k] /= weight_sum;
+  }
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(problem_->get_nthreads())
+#endif
+  for (std::size_t t = 0; t < T; ++t) {
+    Eigen::VectorXd& du = dus_[t];
+    du.setZero();
+    for (std::size_t k = 0; k < nsamples_; ++k) {
+      if (weights_[k] > 0.) {
+        du += weights_[k] * (us_samples_[k][t] - us_[t]);
+      }
+    }
+  }
+  STOP_PROFILER("SolverMPPI::computeDirection");
+}
+
+double SolverMPPI::tryStep(const double steplength) {
+  if (steplength > 1. || steplength < 0.) {
+    throw_pretty("Invalid argument: "
+                 << "invalid step length, value is between 0. to 1.");
+  }
+  START_PROFILER("SolverMPPI::tryStep");
+  const std::size_t T = problem_->get_T();
+  for (std::size_t t = 0; t < T; ++t) {
+    us_try_[t] = us_[t] + steplength * dus_[t];
+  }
+  cost_try_ = rollout(us_try_, xs_try_);
+  STOP_PROFILER("SolverMPPI::tryStep");
+  return cost_ - cost_try_;
+}
+
+double SolverMPPI::stoppingCriteria() {
+  stop_ = 0.;
+  const std::size_t T = problem_->get_T();
+  for (std::size_t t = 0; t < T; ++t) {
+    stop_ += dus_[t].squaredNorm();
+  }
+  return stop_;
+}
+
+const Eigen::Vector2d& SolverMPPI::expectedImprovement() {
+  d_.setZero();
+  return d_;
+}
+
+void SolverMPPI::resizeData() {
+  START_PROFILER("SolverMPPI::resizeData");
+  SolverAbstract::resizeData();
+  const std::size_t T = problem_->get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem_->get_runningModels();
+  for (std::size_t t = 0; t < T; ++t) {
+    const std::size_t nu = models[t]->get_nu();
+    if (static_cast<std::size_t>(dus_[t].size()) != nu) {
+      dus_[t] = Eigen::VectorXd::Zero(nu);
+      us_try_[t] = Eigen::VectorXd::Zero(nu);
+      for (std::size_t k = 0; k < nsamples_; ++k) {
+        us_samples_[k][t] = Eigen::VectorXd::Zero(nu);
+      }
+    }
+  }
+  STOP_PROFILER("SolverMPPI::resizeData");
+}
+
+std::size_t SolverMPPI::get_nsamples() const { return nsamples_; }
+
+double SolverMPPI::get_noise() const { return noise_; }
+
+double SolverMPPI::get_temperature() const { return temperature_; }
+
+const std::vector<Eigen::VectorXd>& SolverMPPI::get_dus() const {
+  return dus_;
+}
+
+const std::vector<std::vector<Eigen::VectorXd> >&
+SolverMPPI::get_us_samples() const {
+  return us_samples_;
+}
+
+const std::vector<std::vector<Eigen::VectorXd> >&
+SolverMPPI::get_xs_samples() const {
+  return xs_samples_;
+}
+
+const std::vector<double>& SolverMPPI::get_costs() const { return costs_; }
+
+const std::vector<double>& SolverMPPI::get_weights() const {
+  return weights_;
+}
+
+void SolverMPPI::set_nsamples(const std::size_t nsamples) {
+  if (nsamples == 0) {
+    throw_pretty("Invalid argument: " << "nsamples should be positive");
+  }
+  nsamples_ = nsamples;
+  allocateData();
+}
+
+void SolverMPPI::set_noise(const double noise) {
+  if (noise < 0.) {
+    throw_pretty("Invalid argument: " << "noise should be non-negative");
+  }
+  noise_ = noise;
+}
+
+void SolverMPPI::set_temperature(const double temperature) {
+  if (temperature <= 0.) {
+    throw_pretty("Invalid argument: " << "temperature should be positive");
+  }
+  temperature_ = temperature;
+}
+
+void SolverMPPI::set_seed(const unsigned int seed) {
+  seed_ = seed;
+  for (std::size_t w = 0; w < rngs_.size(); ++w) {
+    rngs_[w].seed(seed_ + static_cast<unsigned int>(w));
+  }
+}
+
+void SolverMPPI::allocateData() {
+  const std::size_t T = problem_->get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem_->get_runningModels();
+  xs_try_.resize(T + 1);
+  us_try_.resize(T);
+  dus_.resize(T);
+  for (std::size_t t = 0; t < T; ++t) {
+    const std::size_t nu = models[t]->get_nu();
+    xs_try_[t] = models[t]->get_state()->zero();
+    us_try_[t] = Eigen::VectorXd::Zero(nu);
+    dus_[t] = Eigen::VectorXd::Zero(nu);
+  }
+  xs_try_.back() = problem_->get_terminalModel()->get_state()->zero();
+  us_samples_.resize(nsamples_);
+  for (std::size_t k = 0; k < nsamples_; ++k) {
+    us_samples_[k] = us_try_;
+  }
+  costs_.resize(nsamples_);
+  weights_.resize(nsamples_);
+#ifdef CROCODDYL_WITH_MULTITHREADING
+  rngs_.resize(problem_->get_nthreads());
+#else
+  rngs_.resize(1);
+#endif
+  set_seed(seed_);
+}
+
+double SolverMPPI::rollout(const std::vector<Eigen::VectorXd>& us,
+                           std::vector<Eigen::VectorXd>& xs) {
+  problem_->rollout(us, xs);
+  const std::size_t T = problem_->get_T();
+  const std::vector<std::shared_ptr<ActionDataAbstract> >& datas =
+      problem_->get_runningDatas();
+  double cost = 0.;
+  for (std::size_t t = 0; t < T; ++t) {
+    cost += datas[t]->cost;
+  }
+  return cost + problem_->get_terminalData()->cost;
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/binary-log.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+namespace {
+
+// Read a 8-byte unsigned integer and return the next word
+const char* readBinaryLogWord(const char* p, std::uint64_t& value) {
+  std::memcpy(&value, p, sizeof(value));
+  return p + sizeof(value);
+}
+
+// Read a block of a binary log and return the end of the block
+template <typename Matrix>
+const char* readBinaryLogBlock(const char* p, const char* end,
+                               std::vector<Matrix>& block) {
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                        Eigen::RowMajor>
+      MatrixXdRowMajor;
+  std::uint64_t n;
+  p = readBinaryLogWord(p, n);
+  if (n > static_cast<std::uint64_t>(end - p) / (2 * sizeof(std::uint64_t))) {
+    throw_pretty("Invalid argument: " << "corrupted binary log");
+  }
+  const char* data = p + 2 * n * sizeof(std::uint64_t);
+  block.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint64_t rows, cols;
+    p = readBinaryLogWord(p, rows);
+    p = readBinaryLogWord(p, cols);
+    if (rows * cols > static_cast<std::uint64_t>(end - data) / sizeof(double)) {
+      throw_pretty("Invalid argument: " << "corrupted binary log");
+    }
+    block[i] = Eigen::Map<const MatrixXdRowMajor>(
+        reinterpret_cast<const double*>(data), rows, cols);
+    data += rows * cols * sizeof(double);
+  }
+  return data;
+}
+
+}  // namespace
+
+BinaryLogReader::BinaryLogReader(const std::string& filename)
+    : filename_(filename), data_(NULL), size_(0) {
+  reload();
+}
+
+BinaryLogReader::~BinaryLogReader() { unmap(); }
+
+void BinaryLogReader::reload() {
+  unmap();
+  offsets_.clear();
+#ifndef WIN32
+  const int fd = open(filename_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw_pretty("Invalid argument: " << "cannot open " + filename_);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    throw_pretty("Invalid argument: " << "cannot read " + filename_);
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0) {
+    void* data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      size_ = 0;
+      throw_pretty("Invalid argument: " << "cannot map " + filename_);
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  close(fd);
+#else
+  std::FILE* f = std::fopen(filename_.c_str(), "rb");
+  if (f == NULL) {
+    throw_pretty("Invalid argument: " << "cannot open " + filename_);
+  }
+  std::fseek(f, 0, SEEK_END);
+  buffer_.resize(static_cast<std::size_t>(std::ftell(f)));
+  std::fseek(f, 0, SEEK_SET);
+  size_ = std::fread(buffer_.data(), 1, buffer_.size(), f);
+  std::fclose(f);
+  data_ = buffer_.data();
+#endif
+  if (size_ < sizeof(BINARY_LOG_MAGIC) ||
+      std::memcmp(data_, BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC)) != 0) {
+    unmap();
+    throw_pretty("Invalid argument: " << filename_ + " is not a binary log");
+  }
+  // Index the complete records, a truncated record at the end is ignored
+  std::size_t offset = sizeof(BINARY_LOG_MAGIC);
+  while (offset + sizeof(BinaryLogHeader) <= size_) {
+    std::uint64_t nbytes;
+    readBinaryLogWord(data_ + offset, nbytes);
+    if (nbytes < sizeof(BinaryLogHeader) || nbytes > size_ - offset) {
+      break;
+    }
+    offsets_.push_back(offset);
+    offset += nbytes;
+  }
+}
+
+BinaryLogRecord BinaryLogReader::read(const std::size_t i) const {
+  BinaryLogRecord record;
+  read(i, record);
+  return record;
+}
+
+void BinaryLogReader::read(const std::size_t i,
+                           BinaryLogRecord& record) const {
+  if (i >= offsets_.size()) {
+    throw_pretty("Invalid argument: " << "i is out of range (it should be "
+                                         "lower than " +
+                                             std::to_string(offsets_.size()) +
+                                             ")");
+  }
+  BinaryLogHeader header;
+  const char* p = data_ + offsets_[i];
+  std::memcpy(&header, p, sizeof(header));
+  const char* end = p + header.size;
+  p += sizeof(header);
+  record.sequence = static_cast<std::size_t>(header.sequence);
+  record.time = header.time;
+  record.iter = static_cast<std::size_t>(header.iter);
+  record.cost = header.cost;
+  record.merit = header.merit;
+  record.stop = header.stop;
+  record.steplength = header.steplength;
+  record.preg = header.preg;
+  record.dreg = header.dreg;
+  record.ffeas = header.ffeas;
+  record.gfeas = header.gfeas;
+  record.hfeas = header.hfeas;
+  p = readBinaryLogBlock(p, end, record.xs);
+  p = readBinaryLogBlock(p, end, record.us);
+  readBinaryLogBlock(p, end, record.Ks);
+}
+
+const std::string& BinaryLogReader::get_filename() const { return filename_; }
+
+std::size_t BinaryLogReader::get_nrecords() const { return offsets_.size(); }
+
+void BinaryLogReader::unmap() {
+#ifndef WIN32
+  if (data_ != NULL) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#else
+  buffer_.clear();
+#endif
+  data_ = NULL;
+  size_ = 0;
+}
+
+}  // namespace crocoddyl
@@ -9,6 +9,15 @@
 
 #include "crocoddyl/core/utils/callbacks.hpp"
 
+#include <chrono>
+#include <cstring>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/utils/binary-log.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 
 namespace crocoddyl {
@@ -238,4 +247,233 @@ void CallbackVerbose::operator()(SolverAbstract& solver) {
   std::cout << std::flush;
 }
 
+namespace {
+
+// Return the number of 8-byte words of a block of a binary log
+template <typename Matrix>
+std::size_t binaryLogBlockWords(const std::vector<Matrix>& block) {
+  std::size_t nwords = 1 + 2 * block.size();
+  for (std::size_t i = 0; i < block.size(); ++i) {
+    nwords += static_cast<std::size_t>(block[i].size());
+  }
+  return nwords;
+}
+
+// Write a block of a binary log and return the end of the block
+template <typename Matrix>
+char* writeBinaryLogBlock(char* p, const std::vector<Matrix>& block) {
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                        Eigen::RowMajor>
+      MatrixXdRowMajor;
+  const std::uint64_t n = block.size();
+  std::memcpy(p, &n, sizeof(n));
+  p += sizeof(n);
+  for (std::size_t i = 0; i < block.size(); ++i) {
+    const std::uint64_t dims[2] = {static_cast<std::uint64_t>(block[i].rows()),
+                                   static_cast<std::uint64_t>(block[i].cols())};
+    std::memcpy(p, dims, sizeof(dims));
+    p += sizeof(dims);
+  }
+  for (std::size_t i = 0; i < block.size(); ++i) {
+    const Eigen::Index rows = block[i].rows();
+    const Eigen::Index cols = block[i].cols();
+    Eigen::Map<MatrixXdRowMajor>(reinterpret_cast<double*>(p), rows, cols) =
+        block[i];
+    p += rows * cols * sizeof(double);
+  }
+  return p;
+}
+
+}  // namespace
+
+CallbackBinaryLogger::CallbackBinaryLogger(const std::string& filename,
+                                           const std::size_t capacity,
+                                           const bool with_gains)
+    : CallbackAbstract(),
+      filename_(filename),
+      file_(NULL),
+      with_gains_(with_gains),
+      slots_(capacity),
+      head_(0),
+      tail_(0),
+      nwritten_(0),
+      ndropped_(0),
+      sequence_(0),
+      running_(true) {
+  if (capacity == 0) {
+    throw_pretty("Invalid argument: " << "capacity has to be positive");
+  }
+  // Find the complete records of an existing log, as a crash could have left
+  // a truncated record at its end
+  std::size_t size = 0, valid = 0;
+  if (std::FILE* f = std::fopen(filename.c_str(), "rb")) {
+    std::fseek(f, 0, SEEK_END);
+    size = static_cast<std::size_t>(std::ftell(f));
+    std::fseek(f, 0, SEEK_SET);
+    if (size > 0) {
+      char magic[sizeof(BINARY_LOG_MAGIC)];
+      if (std::fread(magic, 1, sizeof(magic), f) != sizeof(magic) ||
+          std::memcmp(magic, BINARY_LOG_MAGIC, sizeof(magic)) != 0) {
+        std::fclose(f);
+        throw_pretty("Invalid argument: " << filename + " is not a binary log");
+      }
+      valid = sizeof(BINARY_LOG_MAGIC);
+      std::uint64_t nbytes;
+      while (valid + sizeof(BinaryLogHeader) <= size &&
+             std::fread(&nbytes, sizeof(nbytes), 1, f) == 1 &&
+             nbytes >= sizeof(BinaryLogHeader) && nbytes <= size - valid) {
+        valid += nbytes;
+        std::fseek(f, static_cast<long>(valid), SEEK_SET);
+      }
+    }
+    std::fclose(f);
+  }
+  if (valid < size) {
+#ifndef WIN32
+    if (truncate(filename.c_str(), static_cast<off_t>(valid)) != 0) {
+      throw_pretty("Invalid argument: " << "cannot truncate " + filename);
+    }
+#else
+    throw_pretty("Invalid argument: " << filename +
+                                             " ends with a truncated record");
+#endif
+  }
+  file_ = std::fopen(filename.c_str(), "ab");
+  if (file_ == NULL) {
+    throw_pretty("Invalid argument: " << "cannot open " + filename);
+  }
+  if (valid == 0) {
+    std::fwrite(BINARY_LOG_MAGIC, 1, sizeof(BINARY_LOG_MAGIC), file_);
+    std::fflush(file_);
+  }
+  thread_ = std::thread(&CallbackBinaryLogger::run, this);
+}
+
+CallbackBinaryLogger::~CallbackBinaryLogger() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_.store(false, std::memory_order_release);
+  }
+  queued_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  std::fclose(file_);
+}
+
+void CallbackBinaryLogger::operator()(SolverAbstract& solver) {
+  const std::size_t sequence = sequence_++;
+  const std::size_t head = head_.load(std::memory_order_relaxed);
+  if (head - tail_.load(std::memory_order_acquire) == slots_.size()) {
+    ndropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const std::vector<Eigen::VectorXd>& xs = solver.get_xs();
+  const std::vector<Eigen::VectorXd>& us = solver.get_us();
+  const std::vector<SolverDDP::MatrixXdRowMajor> no_gains;
+  const SolverDDP* ddp =
+      with_gains_ ? dynamic_cast<const SolverDDP*>(&solver) : NULL;
+  const std::vector<SolverDDP::MatrixXdRowMajor>& Ks =
+      ddp != NULL ? ddp->get_K() : no_gains;
+
+  // The slots keep their memory, so the queue does not allocate once all of
+  // them were used with the problem dimension
+  std::vector<char>& slot = slots_[head % slots_.size()];
+  BinaryLogHeader header;
+  header.size = sizeof(BinaryLogHeader) +
+                (binaryLogBlockWords(xs) + binaryLogBlockWords(us) +
+                 binaryLogBlockWords(Ks)) *
+                    sizeof(std::uint64_t);
+  header.sequence = sequence;
+  header.time = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  header.iter = solver.get_iter();
+  header.cost = solver.get_cost();
+  header.merit = solver.get_merit();
+  header.stop = solver.get_stop();
+  header.steplength = solver.get_steplength();
+  header.preg = solver.get_preg();
+  header.dreg = solver.get_dreg();
+  header.ffeas = solver.get_ffeas();
+  header.gfeas = solver.get_gfeas();
+  header.hfeas = solver.get_hfeas();
+  slot.resize(header.size);
+  std::memcpy(slot.data(), &header, sizeof(header));
+  char* p = slot.data() + sizeof(header);
+  p = writeBinaryLogBlock(p, xs);
+  p = writeBinaryLogBlock(p, us);
+  writeBinaryLogBlock(p, Ks);
+  head_.store(head + 1, std::memory_order_release);
+  // The writer checks the queue while holding the mutex, then taking it
+  // before the notification prevents a lost wakeup. It is only contended
+  // while the writer goes to sleep.
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  queued_.notify_one();
+}
+
+void CallbackBinaryLogger::flush() {
+  const std::size_t head = head_.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(mutex_);
+  drained_.wait(lock, [this, head] {
+    return tail_.load(std::memory_order_acquire) >= head;
+  });
+}
+
+void CallbackBinaryLogger::run() {
+  while (true) {
+    // Records queued before the logger stops are still written
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t head = head_.load(std::memory_order_acquire);
+    if (tail == head) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      queued_.wait(lock, [this, tail] {
+        return head_.load(std::memory_order_acquire) != tail ||
+               !running_.load(std::memory_order_acquire);
+      });
+      head = head_.load(std::memory_order_acquire);
+      if (tail == head) {
+        break;
+      }
+    }
+    for (std::size_t i = tail; i != head; ++i) {
+      const std::vector<char>& slot = slots_[i % slots_.size()];
+      if (std::fwrite(slot.data(), 1, slot.size(), file_) == slot.size()) {
+        nwritten_.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        ndropped_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    std::fflush(file_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tail_.store(head, std::memory_order_release);
+    }
+    drained_.notify_all();
+  }
+}
+
+const std::string& CallbackBinaryLogger::get_filename() const {
+  return filename_;
+}
+
+std::size_t CallbackBinaryLogger::get_capacity() const {
+  return slots_.size();
+}
+
+std::size_t CallbackBinaryLogger::get_nrecords() const {
+  return nwritten_.load(std::memory_order_acquire);
+}
+
+std::size_t CallbackBinaryLogger::get_ndropped() const {
+  return ndropped_.load(std::memory_order_relaxed);
+}
+
+bool CallbackBinaryLogger::get_with_gains() const { return with_gains_; }
+
+void CallbackBinaryLogger::set_with_gains(const bool with_gains) {
+  with_gains_ = with_gains;
+}
+
 }  // namespace crocoddyl
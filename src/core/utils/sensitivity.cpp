@@ -0,0 +1,273 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/sensitivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "crocoddyl/core/solvers/box-ddp.hpp"
+#include "crocoddyl/core/solvers/box-fddp.hpp"
+#include "crocoddyl/core/solvers/intro.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+#include "crocoddyl/core/utils/stop-watch.hpp"
+
+namespace crocoddyl {
+
+SolutionSensitivity::SolutionSensitivity(
+    std::shared_ptr<SolverDDP> solver,
+    std::shared_ptr<ProblemParameters> params)
+    : solver_(solver),
+      params_(params),
+      disturbance_(std::sqrt(2.0 * std::numeric_limits<double>::epsilon())) {
+  if (!solver_) {
+    throw_pretty("Invalid argument: " << "solver is null");
+  }
+  // Their gains are not the ones of the unconstrained Hessians Quu, as they
+  // project them onto the free controls or the null space of the equalities
+  if (std::dynamic_pointer_cast<SolverBoxDDP>(solver_) ||
+      std::dynamic_pointer_cast<SolverBoxFDDP>(solver_) ||
+      std::dynamic_pointer_cast<SolverIntro>(solver_)) {
+    throw_pretty("Invalid argument: "
+                 << "the sensitivities are not supported by the SolverBoxDDP, "
+                    "SolverBoxFDDP and SolverIntro solvers");
+  }
+  if (params_ && params_->get_problem() != solver_->get_problem()) {
+    throw_pretty("Invalid argument: "
+                 << "the parameters have to belong to the solver's problem");
+  }
+  resizeData();
+}
+
+SolutionSensitivity::~SolutionSensitivity() {}
+
+void SolutionSensitivity::compute(const bool recalc) {
+  START_PROFILER("SolutionSensitivity::compute");
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+  const std::vector<Eigen::VectorXd>& xs = solver_->get_xs();
+  const std::vector<Eigen::VectorXd>& us = solver_->get_us();
+  if (params_) {
+    params_->update();
+  }
+  if (recalc) {
+    problem->calc(xs, us);
+    solver_->computeDirection(true);
+  } else {
+    problem->calcAndDiff(xs, us);
+  }
+  resizeData();
+
+  const std::size_t T = problem->get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem->get_runningModels();
+  const std::vector<std::shared_ptr<ActionDataAbstract> >& datas =
+      problem->get_runningDatas();
+  const std::vector<SolverDDP::MatrixXdRowMajor>& K = solver_->get_K();
+
+  // Closed-loop propagation of a perturbation of the initial state
+  dxs_dx0_[0].setIdentity();
+  for (std::size_t t = 0; t < T; ++t) {
+    const std::shared_ptr<ActionDataAbstract>& d = datas[t];
+    dxs_dx0_[t + 1].noalias() = d->Fx * dxs_dx0_[t];
+    if (models[t]->get_nu() != 0) {
+      dus_dx0_[t].noalias() = -K[t] * dxs_dx0_[t];
+      dxs_dx0_[t + 1].noalias() += d->Fu * dus_dx0_[t];
+    }
+  }
+
+  if (!params_ || params_->get_nparams() == 0) {
+    STOP_PROFILER("SolutionSensitivity::compute");
+    return;
+  }
+  computeParameterDerivatives();
+
+  // Backward sweep of the parameter perturbations with the gains and Hessians
+  // of the solver
+  const std::vector<Eigen::MatrixXd>& Vxx = solver_->get_Vxx();
+  const std::vector<Eigen::MatrixXd>& Quu = solver_->get_Quu();
+  Vxp_.back() = Lxp_.back();
+  for (int t = static_cast<int>(T) - 1; t >= 0; --t) {
+    const std::shared_ptr<ActionDataAbstract>& d = datas[t];
+    Wp_ = Vxp_[t + 1];
+    Wp_.noalias() += Vxx[t + 1] * Fp_[t];
+    Vxp_[t] = Lxp_[t];
+    Vxp_[t].noalias() += d->Fx.transpose() * Wp_;
+    if (models[t]->get_nu() != 0) {
+      Qup_ = Lup_[t];
+      Qup_.noalias() += d->Fu.transpose() * Wp_;
+      Quu_llt_[t].compute(Quu[t]);
+      if (Quu_llt_[t].info() != Eigen::Success) {
+        STOP_PROFILER("SolutionSensitivity::compute");
+        throw_pretty("Invalid argument: "
+                     << "Quu is not positive definite at node " +
+                            std::to_string(t));
+      }
+      kp_[t] = Quu_llt_[t].solve(Qup_);
+      Vxp_[t].noalias() -= K[t].transpose() * Qup_;
+    }
+  }
+
+  // Forward sweep of the parameter perturbations
+  dxs_dp_[0].setZero();
+  for (std::size_t t = 0; t < T; ++t) {
+    const std::shared_ptr<ActionDataAbstract>& d = datas[t];
+    dxs_dp_[t + 1] = Fp_[t];
+    dxs_dp_[t + 1].noalias() += d->Fx * dxs_dp_[t];
+    if (models[t]->get_nu() != 0) {
+      dus_dp_[t] = -kp_[t];
+      dus_dp_[t].noalias() -= K[t] * dxs_dp_[t];
+      dxs_dp_[t + 1].noalias() += d->Fu * dus_dp_[t];
+    }
+  }
+  STOP_PROFILER("SolutionSensitivity::compute");
+}
+
+void SolutionSensitivity::computeParameterDerivatives() {
+  START_PROFILER("SolutionSensitivity::computeParameterDerivatives");
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+  const std::size_t T = problem->get_T();
+  const std::size_t np = params_->get_nparams();
+  for (std::size_t t = 0; t <= T; ++t) {
+    const std::shared_ptr<ActionModelAbstract>& m =
+        t < T ? problem->get_runningModels()[t] : problem->get_terminalModel();
+    const std::shared_ptr<ActionDataAbstract>& d =
+        t < T ? problem->get_runningDatas()[t] : problem->get_terminalData();
+    const bool has_control = t < T && m->get_nu() != 0;
+    dx_.resize(m->get_state()->get_ndx());
+
+    // The node's data holds the nominal evaluation at the solution
+    row_ = params_->get_values().row(t).transpose();
+    Lx_ = d->Lx;
+    if (t < T) {
+      xnext_ = d->xnext;
+    }
+    if (has_control) {
+      Lu_ = d->Lu;
+    }
+    for (std::size_t j = 0; j < np; ++j) {
+      const double value = row_(j);
+      const double h = disturbance_ * std::max(1., std::abs(value));
+      row_(j) = value + h;
+      params_->set_values(t, row_);
+      params_->update();
+      calcNode(t);
+      Lxp_[t].col(j) = (d->Lx - Lx_) / h;
+      if (t < T) {
+        m->get_state()->diff(xnext_, d->xnext, dx_);
+        Fp_[t].col(j) = dx_ / h;
+      }
+      if (has_control) {
+        Lup_[t].col(j) = (d->Lu - Lu_) / h;
+      }
+      row_(j) = value;
+    }
+
+    // Restore the parameters and the evaluation of the node
+    params_->set_values(t, row_);
+    params_->update();
+    calcNode(t);
+  }
+  STOP_PROFILER("SolutionSensitivity::computeParameterDerivatives");
+}
+
+void SolutionSensitivity::calcNode(const std::size_t t) {
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+  const std::vector<Eigen::VectorXd>& xs = solver_->get_xs();
+  const std::vector<Eigen::VectorXd>& us = solver_->get_us();
+  if (t == problem->get_T()) {
+    const std::shared_ptr<ActionModelAbstract>& m =
+        problem->get_terminalModel();
+    const std::shared_ptr<ActionDataAbstract>& d = problem->get_terminalData();
+    m->calc(d, xs[t]);
+    m->calcDiff(d, xs[t]);
+    return;
+  }
+  const std::shared_ptr<ActionModelAbstract>& m =
+      problem->get_runningModels()[t];
+  const std::shared_ptr<ActionDataAbstract>& d = problem->get_runningDatas()[t];
+  if (m->get_nu() != 0) {
+    m->calc(d, xs[t], us[t]);
+    m->calcDiff(d, xs[t], us[t]);
+  } else {
+    m->calc(d, xs[t]);
+    m->calcDiff(d, xs[t]);
+  }
+}
+
+void SolutionSensitivity::resizeData() {
+  const std::shared_ptr<ShootingProblem>& problem = solver_->get_problem();
+  const std::size_t T = problem->get_T();
+  const std::size_t ndx0 = problem->get_ndx();
+  const std::size_t np = params_ ? params_->get_nparams() : 0;
+  dxs_dx0_.resize(T + 1);
+  dus_dx0_.resize(T);
+  dxs_dp_.resize(T + 1);
+  dus_dp_.resize(T);
+  Lxp_.resize(T + 1);
+  Lup_.resize(T);
+  Fp_.resize(T);
+  Vxp_.resize(T + 1);
+  kp_.resize(T);
+  Quu_llt_.resize(T);
+  for (std::size_t t = 0; t <= T; ++t) {
+    const std::shared_ptr<ActionModelAbstract>& m =
+        t < T ? problem->get_runningModels()[t] : problem->get_terminalModel();
+    const std::size_t ndx = m->get_state()->get_ndx();
+    dxs_dx0_[t].resize(ndx, ndx0);
+    dxs_dp_[t].resize(ndx, np);
+    Lxp_[t].resize(ndx, np);
+    Vxp_[t].resize(ndx, np);
+    if (t < T) {
+      const std::size_t nu = m->get_nu();
+      dus_dx0_[t].resize(nu, ndx0);
+      dus_dp_[t].resize(nu, np);
+      Lup_[t].resize(nu, np);
+      Fp_[t].resize(ndx, np);
+      kp_[t].resize(nu, np);
+    }
+  }
+  row_.resize(np);
+}
+
+const std::vector<Eigen::MatrixXd>& SolutionSensitivity::get_dxs_dx0() const {
+  return dxs_dx0_;
+}
+
+const std::vector<Eigen::MatrixXd>& SolutionSensitivity::get_dus_dx0() const {
+  return dus_dx0_;
+}
+
+const std::vector<Eigen::MatrixXd>& SolutionSensitivity::get_dxs_dp() const {
+  return dxs_dp_;
+}
+
+const std::vector<Eigen::MatrixXd>& SolutionSensitivity::get_dus_dp() const {
+  return dus_dp_;
+}
+
+const std::shared_ptr<SolverDDP>& SolutionSensitivity::get_solver() const {
+  return solver_;
+}
+
+const std::shared_ptr<ProblemParameters>& SolutionSensitivity::get_parameters()
+    const {
+  return params_;
+}
+
+double SolutionSensitivity::get_disturbance() const { return disturbance_; }
+
+void SolutionSensitivity::set_disturbance(const double disturbance) {
+  if (disturbance <= 0.) {
+    throw_pretty("Invalid argument: " << "disturbance has to be positive");
+  }
+  disturbance_ = disturbance;
+}
+
+}  // namespace crocoddyl
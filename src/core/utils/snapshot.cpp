@@ -0,0 +1,394 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "crocoddyl/core/utils/snapshot.hpp"
+
+#include <boost/core/demangle.hpp>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <typeinfo>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "crocoddyl/core/solvers/ddp.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+namespace {
+
+enum SnapshotFlags { SnapshotFeasible = 1, SnapshotGains = 2 };
+
+// Fingerprint of the type of an action model (64-bit FNV-1a hash of its name)
+//
+// The mangled names depend on the compiler, so the demangled name is hashed
+// without the class keys and spaces that only some compilers print, e.g.,
+// "class crocoddyl::ActionModelLQRTpl<double>" and
+// "crocoddyl::ActionModelLQRTpl<double>" have the same fingerprint.
+std::uint64_t modelFingerprint(const ActionModelAbstract& model) {
+  const std::string name = boost::core::demangle(typeid(model).name());
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (std::size_t i = 0; i < name.size(); ++i) {
+    const bool is_begin =
+        i == 0 || !(std::isalnum(name[i - 1]) || name[i - 1] == '_');
+    if (is_begin && name.compare(i, 6, "class ") == 0) {
+      i += 5;
+    } else if (is_begin && name.compare(i, 7, "struct ") == 0) {
+      i += 6;
+    } else if (name[i] != ' ') {
+      hash ^= static_cast<unsigned char>(name[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+// Fill the structure of a node in the node table
+void describeNode(const ActionModelAbstract& model, SnapshotNode& node) {
+  node.model = modelFingerprint(model);
+  node.nx = model.get_state()->get_nx();
+  node.ndx = model.get_state()->get_ndx();
+  node.nu = model.get_nu();
+  node.nr = model.get_nr();
+  node.ng = model.get_ng();
+  node.nh = model.get_nh();
+  node.x = node.u = node.K = node.k = 0;
+}
+
+// Check that a block of n doubles is inside a snapshot of a given size
+bool checkSnapshotBlock(const std::uint64_t offset, const std::uint64_t n,
+                        const std::size_t size) {
+  return offset != 0 && offset % sizeof(double) == 0 && offset <= size &&
+         n <= (size - offset) / sizeof(double);
+}
+
+// Write a block and return the end of the block
+template <typename Matrix>
+char* writeSnapshotBlock(char* p, const Matrix& block) {
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                        Eigen::RowMajor>
+      MatrixXdRowMajor;
+  const Eigen::Index rows = block.rows();
+  const Eigen::Index cols = block.cols();
+  Eigen::Map<MatrixXdRowMajor>(reinterpret_cast<double*>(p), rows, cols) =
+      block;
+  return p + rows * cols * sizeof(double);
+}
+
+}  // namespace
+
+void saveSnapshot(const std::string& filename, const SolverAbstract& solver) {
+  const ShootingProblem& problem = *solver.get_problem();
+  const std::size_t T = problem.get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem.get_runningModels();
+  const std::vector<Eigen::VectorXd>& xs = solver.get_xs();
+  const std::vector<Eigen::VectorXd>& us = solver.get_us();
+  const SolverDDP* ddp = dynamic_cast<const SolverDDP*>(&solver);
+
+  // Compute the layout of the snapshot
+  SnapshotHeader header;
+  header.version = SNAPSHOT_VERSION;
+  header.T = T;
+  header.nx = problem.get_nx();
+  header.flags = solver.get_is_feasible() ? SnapshotFeasible : 0;
+  if (ddp != NULL) {
+    header.flags |= SnapshotGains;
+  }
+  header.iter = solver.get_iter();
+  header.cost = solver.get_cost();
+  header.merit = solver.get_merit();
+  header.stop = solver.get_stop();
+  header.preg = solver.get_preg();
+  header.dreg = solver.get_dreg();
+  header.ffeas = solver.get_ffeas();
+  std::vector<SnapshotNode> nodes(T + 1);
+  std::size_t offset = sizeof(SNAPSHOT_MAGIC) + sizeof(SnapshotHeader) +
+                       header.nx * sizeof(double) +
+                       (T + 1) * sizeof(SnapshotNode);
+  for (std::size_t t = 0; t < T; ++t) {
+    SnapshotNode& node = nodes[t];
+    describeNode(*models[t], node);
+    node.x = offset;
+    offset += xs[t].size() * sizeof(double);
+    node.u = offset;
+    offset += us[t].size() * sizeof(double);
+    if (ddp != NULL) {
+      node.K = offset;
+      offset += ddp->get_K()[t].size() * sizeof(double);
+      node.k = offset;
+      offset += ddp->get_k()[t].size() * sizeof(double);
+    }
+  }
+  describeNode(*problem.get_terminalModel(), nodes[T]);
+  nodes[T].x = offset;
+  offset += xs[T].size() * sizeof(double);
+  header.size = offset;
+
+  // Fill the snapshot
+  std::vector<char> buffer(header.size);
+  char* p = buffer.data();
+  std::memcpy(p, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  p += sizeof(SNAPSHOT_MAGIC);
+  std::memcpy(p, &header, sizeof(header));
+  p += sizeof(header);
+  p = writeSnapshotBlock(p, problem.get_x0());
+  std::memcpy(p, nodes.data(), nodes.size() * sizeof(SnapshotNode));
+  for (std::size_t t = 0; t < T; ++t) {
+    writeSnapshotBlock(buffer.data() + nodes[t].x, xs[t]);
+    writeSnapshotBlock(buffer.data() + nodes[t].u, us[t]);
+    if (ddp != NULL) {
+      writeSnapshotBlock(buffer.data() + nodes[t].K, ddp->get_K()[t]);
+      writeSnapshotBlock(buffer.data() + nodes[t].k, ddp->get_k()[t]);
+    }
+  }
+  writeSnapshotBlock(buffer.data() + nodes[T].x, xs[T]);
+
+  // Replace the snapshot only once it is completely written
+  const std::string tmp = filename + ".tmp";
+  std::FILE* file = std::fopen(tmp.c_str(), "wb");
+  if (file == NULL) {
+    throw_pretty("Invalid argument: " << "cannot open " + tmp);
+  }
+  const std::size_t written =
+      std::fwrite(buffer.data(), 1, buffer.size(), file);
+  if (std::fclose(file) != 0 || written != buffer.size()) {
+    std::remove(tmp.c_str());
+    throw_pretty("Invalid argument: " << "cannot write " + tmp);
+  }
+#ifdef WIN32
+  std::remove(filename.c_str());
+#endif
+  if (std::rename(tmp.c_str(), filename.c_str()) != 0) {
+    std::remove(tmp.c_str());
+    throw_pretty("Invalid argument: " << "cannot write " + filename);
+  }
+}
+
+SnapshotReader::SnapshotReader(const std::string& filename)
+    : filename_(filename), data_(NULL), size_(0), nodes_(NULL) {
+#ifndef WIN32
+  const int fd = open(filename_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw_pretty("Invalid argument: " << "cannot open " + filename_);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    throw_pretty("Invalid argument: " << "cannot read " + filename_);
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0) {
+    void* data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      size_ = 0;
+      throw_pretty("Invalid argument: " << "cannot map " + filename_);
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  close(fd);
+#else
+  std::FILE* f = std::fopen(filename_.c_str(), "rb");
+  if (f == NULL) {
+    throw_pretty("Invalid argument: " << "cannot open " + filename_);
+  }
+  std::fseek(f, 0, SEEK_END);
+  buffer_.resize(static_cast<std::size_t>(std::ftell(f)));
+  std::fseek(f, 0, SEEK_SET);
+  size_ = std::fread(buffer_.data(), 1, buffer_.size(), f);
+  std::fclose(f);
+  data_ = buffer_.data();
+#endif
+  if (size_ < sizeof(SNAPSHOT_MAGIC) + sizeof(SnapshotHeader) ||
+      std::memcmp(data_, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+    unmap();
+    throw_pretty("Invalid argument: " << filename_ + " is not a snapshot");
+  }
+  std::memcpy(&header_, data_ + sizeof(SNAPSHOT_MAGIC), sizeof(header_));
+  if (header_.version != SNAPSHOT_VERSION) {
+    unmap();
+    throw_pretty("Invalid argument: "
+                 << filename_ + " has an unsupported version (" +
+                        std::to_string(header_.version) + ")");
+  }
+
+  // Check that the node table and the blocks are inside the snapshot, so the
+  // accessors do not need to check them
+  std::size_t offset = sizeof(SNAPSHOT_MAGIC) + sizeof(SnapshotHeader);
+  const std::size_t nwords = (size_ - offset) / sizeof(double);
+  bool valid = header_.size == size_ && header_.nx <= nwords &&
+               header_.T < (nwords - header_.nx) / (sizeof(SnapshotNode) /
+                                                    sizeof(std::uint64_t));
+  if (valid) {
+    offset += header_.nx * sizeof(double);
+    nodes_ = reinterpret_cast<const SnapshotNode*>(data_ + offset);
+    for (std::size_t t = 0; t <= header_.T && valid; ++t) {
+      const SnapshotNode& node = nodes_[t];
+      const bool running = t < header_.T;
+      valid = node.nu <= nwords && node.ndx <= nwords &&
+              checkSnapshotBlock(node.x, node.nx, size_) &&
+              (!running || checkSnapshotBlock(node.u, node.nu, size_));
+      if (valid && running && get_has_gains()) {
+        valid = (node.nu == 0 || node.ndx <= nwords / node.nu) &&
+                checkSnapshotBlock(node.K, node.nu * node.ndx, size_) &&
+                checkSnapshotBlock(node.k, node.nu, size_);
+      }
+    }
+  }
+  if (!valid) {
+    unmap();
+    throw_pretty("Invalid argument: " << "corrupted snapshot " + filename_);
+  }
+}
+
+SnapshotReader::~SnapshotReader() { unmap(); }
+
+bool SnapshotReader::is_compatible(const ShootingProblem& problem) const {
+  const std::size_t T = problem.get_T();
+  if (T != header_.T || problem.get_nx() != header_.nx) {
+    return false;
+  }
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem.get_runningModels();
+  for (std::size_t t = 0; t <= T; ++t) {
+    SnapshotNode node;
+    describeNode(t < T ? *models[t] : *problem.get_terminalModel(), node);
+    const SnapshotNode& snapshot = nodes_[t];
+    if (node.model != snapshot.model || node.nx != snapshot.nx ||
+        node.ndx != snapshot.ndx || node.nu != snapshot.nu ||
+        node.nr != snapshot.nr || node.ng != snapshot.ng ||
+        node.nh != snapshot.nh) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SnapshotReader::restore(SolverAbstract& solver) const {
+  const std::shared_ptr<ShootingProblem>& problem = solver.get_problem();
+  if (!is_compatible(*problem)) {
+    throw_pretty("Invalid argument: "
+                 << "the problem is not compatible with " + filename_);
+  }
+  const std::size_t T = header_.T;
+  std::vector<Eigen::VectorXd> xs(T + 1);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t t = 0; t < T; ++t) {
+    xs[t] = get_x(t);
+    us[t] = get_u(t);
+  }
+  xs[T] = get_x(T);
+  problem->set_x0(get_x0());
+  solver.setCandidate(xs, us, get_is_feasible());
+  solver.set_preg(header_.preg);
+  solver.set_dreg(header_.dreg);
+  SolverDDP* ddp = dynamic_cast<SolverDDP*>(&solver);
+  if (ddp != NULL && get_has_gains()) {
+    std::vector<MatrixXdRowMajor> K(T);
+    std::vector<Eigen::VectorXd> k(T);
+    for (std::size_t t = 0; t < T; ++t) {
+      K[t] = get_K(t);
+      k[t] = get_k(t);
+    }
+    ddp->set_K(K);
+    ddp->set_k(k);
+  }
+}
+
+Eigen::Map<const Eigen::VectorXd> SnapshotReader::get_x0() const {
+  return Eigen::Map<const Eigen::VectorXd>(
+      block(sizeof(SNAPSHOT_MAGIC) + sizeof(SnapshotHeader)), header_.nx);
+}
+
+Eigen::Map<const Eigen::VectorXd> SnapshotReader::get_x(
+    const std::size_t t) const {
+  const SnapshotNode& node = get_node(t);
+  return Eigen::Map<const Eigen::VectorXd>(block(node.x), node.nx);
+}
+
+Eigen::Map<const Eigen::VectorXd> SnapshotReader::get_u(
+    const std::size_t t) const {
+  if (t >= header_.T) {
+    throw_pretty("Invalid argument: "
+                 << "t is out of range (it should be lower than " +
+                        std::to_string(header_.T) + ")");
+  }
+  const SnapshotNode& node = nodes_[t];
+  return Eigen::Map<const Eigen::VectorXd>(block(node.u), node.nu);
+}
+
+Eigen::Map<const SnapshotReader::MatrixXdRowMajor> SnapshotReader::get_K(
+    const std::size_t t) const {
+  if (t >= header_.T || !get_has_gains()) {
+    throw_pretty("Invalid argument: "
+                 << "t is out of range or the snapshot has no gains");
+  }
+  const SnapshotNode& node = nodes_[t];
+  return Eigen::Map<const MatrixXdRowMajor>(block(node.K), node.nu, node.ndx);
+}
+
+Eigen::Map<const Eigen::VectorXd> SnapshotReader::get_k(
+    const std::size_t t) const {
+  if (t >= header_.T || !get_has_gains()) {
+    throw_pretty("Invalid argument: "
+                 << "t is out of range or the snapshot has no gains");
+  }
+  const SnapshotNode& node = nodes_[t];
+  return Eigen::Map<const Eigen::VectorXd>(block(node.k), node.nu);
+}
+
+const SnapshotNode& SnapshotReader::get_node(const std::size_t t) const {
+  if (t > header_.T) {
+    throw_pretty("Invalid argument: "
+                 << "t is out of range (it should be lower than or equal to " +
+                        std::to_string(header_.T) + ")");
+  }
+  return nodes_[t];
+}
+
+const SnapshotHeader& SnapshotReader::get_header() const { return header_; }
+
+const std::string& SnapshotReader::get_filename() const { return filename_; }
+
+std::size_t SnapshotReader::get_T() const {
+  return static_cast<std::size_t>(header_.T);
+}
+
+bool SnapshotReader::get_is_feasible() const {
+  return (header_.flags & SnapshotFeasible) != 0;
+}
+
+bool SnapshotReader::get_has_gains() const {
+  return (header_.flags & SnapshotGains) != 0;
+}
+
+void SnapshotReader::unmap() {
+#ifndef WIN32
+  if (data_ != NULL) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#else
+  buffer_.clear();
+#endif
+  data_ = NULL;
+  size_ = 0;
+  nodes_ = NULL;
+}
+
+const double* SnapshotReader::block(const std::uint64_t offset) const {
+  return reinterpret_cast<const double*>(data_ + offset);
+}
+
+}  // namespace crocoddyl
@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#include <omp.h>
+#endif  // CROCODDYL_WITH_MULTITHREADING
+
+#include "crocoddyl/core/utils/solver-pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
+
+namespace crocoddyl {
+
+namespace {
+
+std::shared_ptr<SolverAbstract> createSolverFDDP(
+    std::shared_ptr<ShootingProblem> problem) {
+  return std::make_shared<SolverFDDP>(problem);
+}
+
+double elapsedSeconds(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+SolverPool::SolverPool(const std::size_t nworkers)
+    : factory_(createSolverFDDP), nworkers_(1), time_(0.) {
+  set_nworkers(nworkers);
+}
+
+SolverPool::SolverPool(SolverFactory factory, const std::size_t nworkers)
+    : factory_(factory), nworkers_(1), time_(0.) {
+  if (!factory_) {
+    throw_pretty("Invalid argument: " << "the solver factory is empty");
+  }
+  set_nworkers(nworkers);
+}
+
+SolverPool::~SolverPool() {}
+
+const std::vector<SolverPoolResult>& SolverPool::solve(
+    const std::vector<std::shared_ptr<ShootingProblem> >& problems,
+    const std::vector<std::vector<Eigen::VectorXd> >& init_xs,
+    const std::vector<std::vector<Eigen::VectorXd> >& init_us,
+    const std::size_t maxiter, const bool is_feasible, const double init_reg) {
+  START_PROFILER("SolverPool::solve");
+  const std::size_t np = problems.size();
+  const std::size_t nxs = init_xs.size();
+  const std::size_t nus = init_us.size();
+  const std::size_t K = std::max(np, std::max(nxs, nus));
+  if (np == 0) {
+    throw_pretty("Invalid argument: " << "problems is empty");
+  }
+  if (np != 1 && np != K) {
+    throw_pretty("Invalid argument: "
+                 << "problems has wrong dimension (it should be 1 or " +
+                        std::to_string(K) + ")");
+  }
+  if (nxs > 1 && nxs != K) {
+    throw_pretty("Invalid argument: "
+                 << "init_xs has wrong dimension (it should be 0, 1 or " +
+                        std::to_string(K) + ")");
+  }
+  if (nus > 1 && nus != K) {
+    throw_pretty("Invalid argument: "
+                 << "init_us has wrong dimension (it should be 0, 1 or " +
+                        std::to_string(K) + ")");
+  }
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  allocate(problems);
+
+  results_.resize(K);
+  std::exception_ptr error;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(std::min(nworkers_, K)) schedule(dynamic)
+#endif
+  for (std::size_t k = 0; k < K; ++k) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+    const std::size_t w = static_cast<std::size_t>(omp_get_thread_num());
+#else
+    const std::size_t w = 0;
+#endif
+    try {
+      solveJob(w, k, problems[np == 1 ? 0 : k],
+               nxs == 0 ? DEFAULT_VECTOR : init_xs[nxs == 1 ? 0 : k],
+               nus == 0 ? DEFAULT_VECTOR : init_us[nus == 1 ? 0 : k], maxiter,
+               is_feasible, init_reg);
+    } catch (...) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp critical(crocoddyl_solver_pool)
+#endif
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  time_ = elapsedSeconds(start);
+  STOP_PROFILER("SolverPool::solve");
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return results_;
+}
+
+void SolverPool::allocate(
+    const std::vector<std::shared_ptr<ShootingProblem> >& problems) {
+  // The solvers are created in the calling thread, as the factory might not be
+  // thread-safe
+  for (std::size_t i = 0; i < problems.size(); ++i) {
+    const std::shared_ptr<ShootingProblem>& problem = problems[i];
+    if (!problem) {
+      throw_pretty("Invalid argument: " << "problem " + std::to_string(i) +
+                                               " is null");
+    }
+    for (std::size_t w = 0; w < nworkers_; ++w) {
+      Worker& worker = workers_[w];
+      if (findSolver(worker, problem) >= 0) {
+        continue;
+      }
+      std::shared_ptr<ShootingProblem> worker_problem =
+          std::make_shared<ShootingProblem>(problem->get_x0(),
+                                            problem->get_runningModels(),
+                                            problem->get_terminalModel());
+#ifdef CROCODDYL_WITH_MULTITHREADING
+      worker_problem->set_nthreads(1);
+#endif
+      std::shared_ptr<SolverAbstract> solver = factory_(worker_problem);
+      if (!solver || solver->get_problem() != worker_problem) {
+        throw_pretty("Invalid argument: "
+                     << "the solver factory has to create a solver for the "
+                        "given problem");
+      }
+      worker.problems.push_back(worker_problem);
+      worker.solvers.push_back(solver);
+    }
+  }
+  // The models replaced by the jobs are then owned by the batch, so the jobs
+  // never release the last reference of a model
+  for (std::size_t w = 0; w < nworkers_; ++w) {
+    Worker& worker = workers_[w];
+    for (std::size_t j = 0; j < worker.problems.size(); ++j) {
+      for (std::size_t i = 0; i < problems.size(); ++i) {
+        if (findSolver(worker, problems[i]) == static_cast<int>(j)) {
+          syncProblem(*worker.problems[j], *problems[i]);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void SolverPool::syncProblem(ShootingProblem& worker_problem,
+                             const ShootingProblem& problem) {
+  const std::size_t T = problem.get_T();
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem.get_runningModels();
+  worker_problem.set_x0(problem.get_x0());
+  for (std::size_t t = 0; t < T; ++t) {
+    if (worker_problem.get_runningModels()[t] != models[t]) {
+      worker_problem.updateModel(t, models[t]);
+    }
+  }
+  if (worker_problem.get_terminalModel() != problem.get_terminalModel()) {
+    worker_problem.updateModel(T, problem.get_terminalModel());
+  }
+}
+
+void SolverPool::solveJob(const std::size_t w, const std::size_t k,
+                          const std::shared_ptr<ShootingProblem>& problem,
+                          const std::vector<Eigen::VectorXd>& init_xs,
+                          const std::vector<Eigen::VectorXd>& init_us,
+                          const std::size_t maxiter, const bool is_feasible,
+                          const double init_reg) {
+  Worker& worker = workers_[w];
+  const std::size_t i = static_cast<std::size_t>(findSolver(worker, problem));
+  ShootingProblem& worker_problem = *worker.problems[i];
+  SolverAbstract& solver = *worker.solvers[i];
+
+  syncProblem(worker_problem, *problem);
+
+  SolverPoolResult& result = results_[k];
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  result.converged =
+      solver.solve(init_xs, init_us, maxiter, is_feasible, init_reg);
+  result.time = elapsedSeconds(start);
+  result.is_feasible = solver.get_is_feasible();
+  result.iter = solver.get_iter();
+  result.cost = solver.get_cost();
+  result.stop = solver.get_stop();
+  result.ffeas = solver.get_ffeas();
+  result.worker = w;
+  result.xs = solver.get_xs();
+  result.us = solver.get_us();
+}
+
+int SolverPool::findSolver(const Worker& worker,
+                           const std::shared_ptr<ShootingProblem>& problem) {
+  for (std::size_t i = 0; i < worker.problems.size(); ++i) {
+    const ShootingProblem& worker_problem = *worker.problems[i];
+    if (worker_problem.get_T() == problem->get_T() &&
+        worker_problem.get_nx() == problem->get_nx() &&
+        worker_problem.get_ndx() == problem->get_ndx()) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+const std::vector<SolverPoolResult>& SolverPool::get_results() const {
+  return results_;
+}
+
+std::size_t SolverPool::get_nworkers() const { return nworkers_; }
+
+std::size_t SolverPool::get_nsolvers() const {
+  std::size_t nsolvers = 0;
+  for (std::size_t w = 0; w < workers_.size(); ++w) {
+    nsolvers += workers_[w].solvers.size();
+  }
+  return nsolvers;
+}
+
+const std::vector<std::shared_ptr<SolverAbstract> >& SolverPool::get_solvers(
+    const std::size_t w) const {
+  if (w >= nworkers_) {
+    throw_pretty("Invalid argument: "
+                 << "w is out of range (it should be lower than " +
+                        std::to_string(nworkers_) + ")");
+  }
+  return workers_[w].solvers;
+}
+
+double SolverPool::get_time() const { return time_; }
+
+void SolverPool::set_nworkers(const std::size_t nworkers) {
+#ifdef CROCODDYL_WITH_MULTITHREADING
+  nworkers_ = nworkers == 0 ? CROCODDYL_WITH_NTHREADS : nworkers;
+#else
+  if (nworkers > 1) {
+    std::cerr << "Warning: the number of workers won't affect the "
+                 "computational performance as multithreading support is not "
+                 "enabled."
+              << std::endl;
+  }
+  nworkers_ = 1;
+#endif
+  if (workers_.size() < nworkers_) {
+    workers_.resize(nworkers_);
+  }
+}
+
+}  // namespace crocoddyl
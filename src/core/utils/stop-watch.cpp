@@ -26,40 +26,267 @@
 #include <sys/time.h>
 #else
 #include <Windows.h>
-
-#include <iomanip>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
 #include <iomanip>  // std::setprecision
+#include <thread>
 
 #include "crocoddyl/core/utils/stop-watch.hpp"
 
-using std::map;
-using std::ostringstream;
 using std::string;
 
 namespace crocoddyl {
 
+namespace {
+
+const std::size_t kChunkSize = 16;   // Regions allocated at once per thread
+const std::size_t kMaxChunks = 256;  // Maximum number of region chunks
+const std::size_t kMaxDepth = 64;    // Maximum number of nested regions
+// Log-linear histogram with four buckets per power of two
+const std::size_t kHistogramSize = 256;
+
+std::atomic<std::uint64_t> stopwatch_serial(0);
+
+struct ThreadCache {
+  std::uint64_t serial;
+  void* records;
+};
+thread_local ThreadCache thread_cache = {0, nullptr};
+
+inline std::size_t histogram_bucket(std::uint64_t ns) {
+  if (ns < 4) return static_cast<std::size_t>(ns);
+  std::size_t msb;
+#if defined(__GNUC__) || defined(__clang__)
+  msb = 63 - static_cast<std::size_t>(__builtin_clzll(ns));
+#else
+  msb = 0;
+  for (std::uint64_t v = ns; v >>= 1;) ++msb;
+#endif
+  return 4 * (msb - 1) + static_cast<std::size_t>((ns >> (msb - 2)) & 3);
+}
+
+// Returns the middle point of a histogram bucket [ns]
+inline long double histogram_value(const std::size_t bucket) {
+  if (bucket < 4) return static_cast<long double>(bucket);
+  const std::size_t msb = bucket / 4 + 1;
+  const long double width = std::ldexp(1.0L, static_cast<int>(msb - 2));
+  return (4 + bucket % 4) * width + 0.5L * width;
+}
+
+// Updates a value only written by the owner thread
+inline void relaxed_add(std::atomic<std::uint64_t>& a, const std::uint64_t v) {
+  a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+}
+
+void write_json_string(std::ostream& output, const string& str) {
+  output << '"';
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        output << "\\\"";
+        break;
+      case '\\':
+        output << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          output << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                 << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          output << c;
+        }
+    }
+  }
+  output << '"';
+}
+
+}  // namespace
+
+/** @brief Performance data of a region in a single thread
+ *
+ * It is only written by its owner thread, then relaxed atomics let other
+ * threads read it without locks.
+ */
+struct Stopwatch::PerformanceData {
+  std::atomic<std::uint64_t> stops;        //!< Number of measurements
+  std::atomic<std::uint64_t> total_time;   //!< Cumulative total time [ns]
+  std::atomic<std::uint64_t> min_time;     //!< Minimum time [ns]
+  std::atomic<std::uint64_t> max_time;     //!< Maximum time [ns]
+  std::atomic<std::uint64_t> last_time;    //!< Last time [ns]
+  std::atomic<std::uint64_t> last_stop;    //!< Time of the last stop [ns]
+  std::atomic<std::uint64_t> clock_start;  //!< Start time [ns]
+  std::atomic<std::uint64_t> paused_time;  //!< Time before the pause [ns]
+  std::atomic<std::uint64_t> histogram[kHistogramSize];  //!< Time histogram
+};
+
+/** @brief Merged performance data of a region */
+struct Stopwatch::PerformanceSummary {
+  std::uint64_t stops;
+  std::uint64_t total_time;
+  std::uint64_t min_time;
+  std::uint64_t max_time;
+  std::uint64_t last_time;
+  std::uint64_t last_stop;
+  std::uint64_t histogram[kHistogramSize];
+};
+
+/** @brief Records of a single thread */
+struct Stopwatch::ThreadRecords {
+  struct Frame {
+    std::size_t id;       //!< Region ID
+    long node;            //!< Node index
+    std::uint64_t start;  //!< Start time [ns]
+  };
+
+  struct TraceEvent {
+    std::size_t id;       //!< Region ID
+    std::size_t depth;    //!< Nesting depth
+    long node;            //!< Node index
+    std::uint64_t begin;  //!< Start time [ns]
+    std::uint64_t end;    //!< Stop time [ns]
+  };
+
+  /** @brief Trace ring buffer
+   *
+   * The events and the capacity are swapped together, then a thread recording
+   * an event never indexes a buffer with the capacity of another one.
+   */
+  struct TraceBuffer {
+    explicit TraceBuffer(const std::size_t n)
+        : events(new TraceEvent[n]), capacity(n) {}
+    std::unique_ptr<TraceEvent[]> events;  //!< Recorded events
+    std::size_t capacity;                  //!< Number of events
+  };
+
+  ThreadRecords(const std::size_t index)
+      : index(index),
+        thread(std::this_thread::get_id()),
+        depth(0),
+        trace(nullptr),
+        nevents(0) {
+    for (std::size_t i = 0; i < kMaxChunks; ++i) {
+      chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~ThreadRecords() {
+    for (std::size_t i = 0; i < kMaxChunks; ++i) {
+      delete[] chunks[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  /** @brief Return the data of a region, allocated by the owner thread */
+  PerformanceData& get(const std::size_t id) {
+    std::atomic<PerformanceData*>& chunk = chunks[id / kChunkSize];
+    PerformanceData* data = chunk.load(std::memory_order_relaxed);
+    if (data == nullptr) {
+      data = new PerformanceData[kChunkSize]();
+      chunk.store(data, std::memory_order_release);
+    }
+    return data[id % kChunkSize];
+  }
+
+  /** @brief Return the data of a region if it exists */
+  PerformanceData* find(const std::size_t id) const {
+    PerformanceData* data =
+        chunks[id / kChunkSize].load(std::memory_order_acquire);
+    return data == nullptr ? nullptr : &data[id % kChunkSize];
+  }
+
+  /** @brief Select the trace ring buffer with a given capacity
+   *
+   * The owner thread may be recording an event in the current buffer, then
+   * the replaced buffers are kept until the records are destroyed. A buffer
+   * is allocated once per capacity, and it is reused when the capacity is
+   * selected again.
+   */
+  void allocate_trace(const std::size_t n) {
+    const TraceBuffer* current = trace.load(std::memory_order_relaxed);
+    if (current != nullptr && current->capacity == n) {
+      return;
+    }
+    TraceBuffer* buffer = nullptr;
+    for (std::size_t i = 0; i < buffers.size(); ++i) {
+      if (buffers[i]->capacity == n) {
+        buffer = buffers[i].get();
+        break;
+      }
+    }
+    if (buffer == nullptr) {
+      buffers.emplace_back(new TraceBuffer(n));
+      buffer = buffers.back().get();
+    }
+    nevents.store(0, std::memory_order_relaxed);
+    trace.store(buffer, std::memory_order_release);
+  }
+
+  std::size_t index;              //!< Index of the thread in the trace
+  std::thread::id thread;         //!< Owner thread
+  Frame stack[kMaxDepth];         //!< Stack of open regions
+  std::size_t depth;              //!< Number of open regions
+  std::atomic<PerformanceData*> chunks[kMaxChunks];  //!< Region data
+  std::atomic<TraceBuffer*> trace;  //!< Current trace ring buffer
+  std::vector<std::unique_ptr<TraceBuffer> >
+      buffers;                         //!< Allocated trace ring buffers
+  std::atomic<std::uint64_t> nevents;  //!< Number of recorded events
+};
+
 Stopwatch& getProfiler() {
   static Stopwatch s(REAL_TIME);  // alternatives are CPU_TIME and REAL_TIME
   return s;
 }
 
 Stopwatch::Stopwatch(StopwatchMode _mode)
-    : active(true), mode(_mode), profiler_active(false) {
-  records_of = new map<string, PerformanceData>();
+    : active(true),
+      mode(_mode),
+      profiler_active(false),
+      trace_active(false),
+      trace_capacity(65536),
+      serial(++stopwatch_serial),
+      origin(take_time_ns()) {}
+
+Stopwatch::~Stopwatch() {}
+
+void Stopwatch::enable_profiler() {
+  profiler_active.store(true, std::memory_order_relaxed);
 }
 
-Stopwatch::~Stopwatch() { delete records_of; }
+void Stopwatch::disable_profiler() {
+  profiler_active.store(false, std::memory_order_relaxed);
+}
 
-void Stopwatch::enable_profiler() { profiler_active = true; }
+void Stopwatch::enable_trace(const std::size_t capacity) {
+  if (capacity == 0) {
+    throw StopwatchException("Trace capacity has to be positive.");
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    records_of[i]->allocate_trace(capacity);
+  }
+  trace_capacity = capacity;
+  trace_active.store(true, std::memory_order_release);
+}
 
-void Stopwatch::disable_profiler() { profiler_active = false; }
+void Stopwatch::disable_trace() {
+  trace_active.store(false, std::memory_order_relaxed);
+}
 
 void Stopwatch::set_mode(StopwatchMode new_mode) { mode = new_mode; }
 
 bool Stopwatch::performance_exists(string perf_name) {
-  return (records_of->find(perf_name) != records_of->end());
+  std::lock_guard<std::mutex> lock(mutex);
+  return (ids.find(perf_name) != ids.end());
+}
+
+std::uint64_t Stopwatch::take_time_ns() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
 }
 
 long double Stopwatch::take_time() {
@@ -102,91 +329,208 @@ long double Stopwatch::take_time() {
   }
 }
 
-Stopwatch::PerformanceData& Stopwatch::get_or_create_perf(
-    const string& perf_name) {
-  const auto it = records_of->insert(make_pair(perf_name, PerformanceData()));
-  return it.first->second;
+Stopwatch::ThreadRecords& Stopwatch::get_thread_records() {
+  if (thread_cache.serial == serial) {
+    return *static_cast<ThreadRecords*>(thread_cache.records);
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  const std::thread::id thread = std::this_thread::get_id();
+  ThreadRecords* records = nullptr;
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    if (records_of[i]->thread == thread) {
+      records = records_of[i].get();
+      break;
+    }
+  }
+  if (records == nullptr) {
+    records_of.emplace_back(new ThreadRecords(records_of.size()));
+    records = records_of.back().get();
+    if (trace_active.load(std::memory_order_relaxed)) {
+      records->allocate_trace(trace_capacity);
+    }
+  }
+  thread_cache.serial = serial;
+  thread_cache.records = records;
+  return *records;
 }
 
-void Stopwatch::start(const string& perf_name) {
-  if (!active) return;
+std::size_t Stopwatch::intern(const string& perf_name) {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto it = ids.find(perf_name);
+  if (it != ids.end()) {
+    return it->second;
+  }
+  if (names.size() == kChunkSize * kMaxChunks) {
+    throw StopwatchException("Maximum number of performances reached.");
+  }
+  ids.insert(std::make_pair(perf_name, names.size()));
+  names.push_back(perf_name);
+  return names.size() - 1;
+}
 
-  PerformanceData& perf_info = get_or_create_perf(perf_name);
+std::size_t Stopwatch::get_id(const string& perf_name) {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto it = ids.find(perf_name);
+  if (it == ids.end()) {
+    throw StopwatchException("Performance not initialized.");
+  }
+  return it->second;
+}
 
-  // Take ctime
-  perf_info.clock_start = take_time();
+void Stopwatch::start(const string& perf_name) { start(intern(perf_name)); }
 
-  // If this is a new start (i.e. not a restart)
-  //  if (!perf_info.paused)
-  //    perf_info.last_time = 0;
+void Stopwatch::start(const std::size_t id, const long node) {
+  if (!active) return;
 
-  perf_info.paused = false;
+  ThreadRecords& records = get_thread_records();
+  const std::uint64_t clock_start = take_time_ns();
+
+  // An open region with the same ID has not been stopped (e.g., due to an
+  // exception), then it is closed together with its nested regions
+  std::size_t depth = records.depth;
+  for (std::size_t i = depth; i-- > 0;) {
+    if (records.stack[i].id == id) {
+      depth = i;
+      break;
+    }
+  }
+  if (depth == kMaxDepth) return;
+  ThreadRecords::Frame& frame = records.stack[depth];
+  frame.id = id;
+  frame.node = node;
+  frame.start = clock_start;
+  records.depth = depth + 1;
+  records.get(id).clock_start.store(clock_start, std::memory_order_relaxed);
 }
 
 void Stopwatch::stop(const string& perf_name) {
   if (!active) return;
-
-  long double clock_end = take_time();
-
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  stop_perf(perf_info, clock_end);
+  stop(get_id(perf_name));
 }
 
-void Stopwatch::stop_perf(PerformanceData& perf_info, long double clock_end) {
-  // check whether the performance has been reset
-  if (perf_info.clock_start == 0) return;
-
-  perf_info.stops++;
-  long double lapse = clock_end - perf_info.clock_start;
-
-  if (mode == CPU_TIME) lapse /= (double)CLOCKS_PER_SEC;
-
-  // Update last time
-  perf_info.last_time = lapse;
+void Stopwatch::stop(const std::size_t id) {
+  if (!active) return;
 
-  // Update min/max time
-  if (lapse >= perf_info.max_time)
-    perf_info.max_time = lapse;
-  else if (lapse <= perf_info.min_time)
-    perf_info.min_time = lapse;
+  const std::uint64_t clock_end = take_time_ns();
+  ThreadRecords& records = get_thread_records();
 
-  // Update total time
-  perf_info.total_time += lapse;
+  // Close the region and the ones opened inside it
+  std::size_t depth = records.depth;
+  while (depth > 0 && records.stack[depth - 1].id != id) {
+    --depth;
+  }
+  if (depth == 0) return;
+  const ThreadRecords::Frame& frame = records.stack[depth - 1];
+  records.depth = depth - 1;
+
+  PerformanceData& perf_info = records.get(id);
+  const std::uint64_t lapse =
+      clock_end - frame.start +
+      perf_info.paused_time.load(std::memory_order_relaxed);
+  perf_info.paused_time.store(0, std::memory_order_relaxed);
+
+  const std::uint64_t stops = perf_info.stops.load(std::memory_order_relaxed);
+  if (stops == 0 ||
+      lapse < perf_info.min_time.load(std::memory_order_relaxed)) {
+    perf_info.min_time.store(lapse, std::memory_order_relaxed);
+  }
+  if (lapse > perf_info.max_time.load(std::memory_order_relaxed)) {
+    perf_info.max_time.store(lapse, std::memory_order_relaxed);
+  }
+  relaxed_add(perf_info.total_time, lapse);
+  relaxed_add(perf_info.histogram[histogram_bucket(lapse)], 1);
+  perf_info.last_time.store(lapse, std::memory_order_relaxed);
+  perf_info.last_stop.store(clock_end, std::memory_order_relaxed);
+  perf_info.stops.store(stops + 1, std::memory_order_relaxed);
+
+  if (trace_active.load(std::memory_order_relaxed)) {
+    ThreadRecords::TraceBuffer* trace =
+        records.trace.load(std::memory_order_acquire);
+    if (trace != nullptr) {
+      const std::uint64_t n = records.nevents.load(std::memory_order_relaxed);
+      ThreadRecords::TraceEvent& event = trace->events[n % trace->capacity];
+      event.id = id;
+      event.depth = depth - 1;
+      event.node = frame.node;
+      event.begin = frame.start;
+      event.end = clock_end;
+      records.nevents.store(n + 1, std::memory_order_release);
+    }
+  }
 }
 
 void Stopwatch::pause(const string& perf_name) {
   if (!active) return;
 
-  long double clock_end = (long double)clock();
-
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
+  const std::size_t id = get_id(perf_name);
+  const std::uint64_t clock_end = take_time_ns();
+  ThreadRecords& records = get_thread_records();
 
-  // check whether the performance has been reset
-  if (perf_info.clock_start == 0) return;
+  std::size_t depth = records.depth;
+  while (depth > 0 && records.stack[depth - 1].id != id) {
+    --depth;
+  }
+  if (depth == 0) return;
+  records.depth = depth - 1;
 
-  long double lapse = clock_end - perf_info.clock_start;
+  // The lapse is added to the next measurement of this performance
+  PerformanceData& perf_info = records.get(id);
+  const std::uint64_t lapse = clock_end - records.stack[depth - 1].start;
+  relaxed_add(perf_info.paused_time, lapse);
+}
 
-  // Update total time
-  perf_info.last_time += lapse;
-  perf_info.total_time += lapse;
+void Stopwatch::summarize(const std::size_t id, PerformanceSummary& summary) {
+  summary.stops = 0;
+  summary.total_time = 0;
+  summary.min_time = std::numeric_limits<std::uint64_t>::max();
+  summary.max_time = 0;
+  summary.last_time = 0;
+  summary.last_stop = 0;
+  std::fill(summary.histogram, summary.histogram + kHistogramSize, 0);
+  std::lock_guard<std::mutex> lock(mutex);
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    const PerformanceData* perf_info = records_of[i]->find(id);
+    if (perf_info == nullptr) continue;
+    const std::uint64_t stops =
+        perf_info->stops.load(std::memory_order_relaxed);
+    if (stops == 0) continue;
+    summary.stops += stops;
+    summary.total_time +=
+        perf_info->total_time.load(std::memory_order_relaxed);
+    summary.min_time = std::min(
+        summary.min_time, perf_info->min_time.load(std::memory_order_relaxed));
+    summary.max_time = std::max(
+        summary.max_time, perf_info->max_time.load(std::memory_order_relaxed));
+    const std::uint64_t last_stop =
+        perf_info->last_stop.load(std::memory_order_relaxed);
+    if (last_stop >= summary.last_stop) {
+      summary.last_stop = last_stop;
+      summary.last_time = perf_info->last_time.load(std::memory_order_relaxed);
+    }
+    for (std::size_t k = 0; k < kHistogramSize; ++k) {
+      summary.histogram[k] +=
+          perf_info->histogram[k].load(std::memory_order_relaxed);
+    }
+  }
+  if (summary.stops == 0) {
+    summary.min_time = 0;
+  }
 }
 
 void Stopwatch::reset_all() {
   if (!active) return;
 
-  map<string, PerformanceData>::iterator it;
-
-  for (it = records_of->begin(); it != records_of->end(); ++it) {
-    reset(it->first);
+  std::vector<string> perf_names;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    perf_names = names;
+  }
+  for (std::size_t i = 0; i < perf_names.size(); ++i) {
+    reset(perf_names[i]);
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    records_of[i]->nevents.store(0, std::memory_order_relaxed);
   }
 }
 
@@ -202,34 +546,48 @@ void Stopwatch::report_all(int precision, std::ostream& output) {
          << " ";
   output << std::setw(STOP_WATCH_TIME_WIDTH) << "max"
          << " ";
+  output << std::setw(STOP_WATCH_TIME_WIDTH) << "p50"
+         << " ";
+  output << std::setw(STOP_WATCH_TIME_WIDTH) << "p99"
+         << " ";
   output << std::setw(STOP_WATCH_TIME_WIDTH) << "lastTime"
          << " ";
   output << std::setw(STOP_WATCH_TIME_WIDTH) << "nSamples"
          << " ";
   output << std::setw(STOP_WATCH_TIME_WIDTH) << "totalTime"
          << " ***\n";
-  map<string, PerformanceData>::iterator it;
-  for (it = records_of->begin(); it != records_of->end(); ++it) {
-    if (it->second.stops > 0) report(it->first, precision, output);
+  std::vector<string> perf_names;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    perf_names = names;
+  }
+  std::sort(perf_names.begin(), perf_names.end());
+  for (std::size_t i = 0; i < perf_names.size(); ++i) {
+    if (get_total_time(perf_names[i]) > 0) {
+      report(perf_names[i], precision, output);
+    }
   }
 }
 
 void Stopwatch::reset(const string& perf_name) {
   if (!active) return;
 
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  perf_info.clock_start = 0;
-  perf_info.total_time = 0;
-  perf_info.min_time = 0;
-  perf_info.max_time = 0;
-  perf_info.last_time = 0;
-  perf_info.paused = false;
-  perf_info.stops = 0;
+  const std::size_t id = get_id(perf_name);
+  std::lock_guard<std::mutex> lock(mutex);
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    PerformanceData* perf_info = records_of[i]->find(id);
+    if (perf_info == nullptr) continue;
+    perf_info->stops.store(0, std::memory_order_relaxed);
+    perf_info->total_time.store(0, std::memory_order_relaxed);
+    perf_info->min_time.store(0, std::memory_order_relaxed);
+    perf_info->max_time.store(0, std::memory_order_relaxed);
+    perf_info->last_time.store(0, std::memory_order_relaxed);
+    perf_info->last_stop.store(0, std::memory_order_relaxed);
+    perf_info->paused_time.store(0, std::memory_order_relaxed);
+    for (std::size_t k = 0; k < kHistogramSize; ++k) {
+      perf_info->histogram[k].store(0, std::memory_order_relaxed);
+    }
+  }
 }
 
 void Stopwatch::turn_on() {
@@ -246,121 +604,154 @@ void Stopwatch::report(const string& perf_name, int precision,
                        std::ostream& output) {
   if (!active) return;
 
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
+  const std::size_t id = get_id(perf_name);
+  PerformanceSummary perf_info;
+  summarize(id, perf_info);
 
   output << std::setw(STOP_WATCH_MAX_NAME_LENGTH) << std::left << perf_name;
   output << std::fixed << std::setprecision(precision)
-         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.min_time * 1e3)
+         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.min_time * 1e-6L)
          << " ";
   output << std::fixed << std::setprecision(precision)
          << std::setw(STOP_WATCH_TIME_WIDTH)
-         << (perf_info.total_time * 1e3 / (long double)perf_info.stops) << " ";
+         << (perf_info.total_time * 1e-6L / (long double)perf_info.stops)
+         << " ";
   output << std::fixed << std::setprecision(precision)
-         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.max_time * 1e3)
+         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.max_time * 1e-6L)
          << " ";
   output << std::fixed << std::setprecision(precision)
-         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.last_time * 1e3)
+         << std::setw(STOP_WATCH_TIME_WIDTH)
+         << get_percentile_time(perf_name, 50.) * 1e3L << " ";
+  output << std::fixed << std::setprecision(precision)
+         << std::setw(STOP_WATCH_TIME_WIDTH)
+         << get_percentile_time(perf_name, 99.) * 1e3L << " ";
+  output << std::fixed << std::setprecision(precision)
+         << std::setw(STOP_WATCH_TIME_WIDTH) << (perf_info.last_time * 1e-6L)
          << " ";
   output << std::fixed << std::setprecision(precision)
          << std::setw(STOP_WATCH_TIME_WIDTH) << perf_info.stops << " ";
   output << std::fixed << std::setprecision(precision)
-         << std::setw(STOP_WATCH_TIME_WIDTH) << perf_info.total_time * 1e3
+         << std::setw(STOP_WATCH_TIME_WIDTH) << perf_info.total_time * 1e-6L
          << std::endl;
 }
 
-long double Stopwatch::get_time_so_far(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  long double lapse =
-      (take_time() - (records_of->find(perf_name)->second).clock_start);
+void Stopwatch::export_chrome_trace(std::ostream& output) {
+  std::vector<string> perf_names;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    perf_names = names;
+  }
+  output << "{\"traceEvents\":[";
+  bool first = true;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (std::size_t i = 0; i < records_of.size(); ++i) {
+    const ThreadRecords& records = *records_of[i];
+    output << (first ? "\n" : ",\n")
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+           << records.index
+           << ",\"args\":{\"name\":\"thread " << records.index << "\"}}";
+    first = false;
+    const ThreadRecords::TraceBuffer* trace =
+        records.trace.load(std::memory_order_acquire);
+    if (trace == nullptr) continue;
+    const std::uint64_t capacity = trace->capacity;
+    const std::uint64_t n = records.nevents.load(std::memory_order_acquire);
+    for (std::uint64_t k = n > capacity ? n - capacity : 0; k < n; ++k) {
+      const ThreadRecords::TraceEvent& event = trace->events[k % capacity];
+      output << ",\n{\"name\":";
+      write_json_string(output, perf_names[event.id]);
+      output << ",\"cat\":\"crocoddyl\",\"ph\":\"X\",\"ts\":" << std::fixed
+             << std::setprecision(3) << (event.begin - origin) * 1e-3L
+             << ",\"dur\":" << (event.end - event.begin) * 1e-3L
+             << ",\"pid\":1,\"tid\":" << records.index
+             << ",\"args\":{\"depth\":" << event.depth;
+      if (event.node >= 0) {
+        output << ",\"node\":" << event.node;
+      }
+      output << "}}";
+    }
+  }
+  output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
 
-  if (mode == CPU_TIME) lapse /= (double)CLOCKS_PER_SEC;
+void Stopwatch::export_chrome_trace(const string& filename) {
+  std::ofstream output(filename.c_str());
+  if (!output.is_open()) {
+    throw StopwatchException("Unable to open the file " + filename + ".");
+  }
+  export_chrome_trace(output);
+}
 
-  return lapse;
+long double Stopwatch::get_time_so_far(const string& perf_name) {
+  const std::size_t id = get_id(perf_name);
+  const PerformanceData* perf_info = get_thread_records().find(id);
+  if (perf_info == nullptr) return 0.;
+  return (take_time_ns() -
+          perf_info->clock_start.load(std::memory_order_relaxed)) *
+         1e-9L;
 }
 
 long double Stopwatch::get_total_time(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  return perf_info.total_time;
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return perf_info.total_time * 1e-9L;
 }
 
 long double Stopwatch::get_average_time(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  return (perf_info.total_time / (long double)perf_info.stops);
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return perf_info.total_time * 1e-9L / (long double)perf_info.stops;
 }
 
 long double Stopwatch::get_min_time(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  return perf_info.min_time;
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return perf_info.min_time * 1e-9L;
 }
 
 long double Stopwatch::get_max_time(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  return perf_info.max_time;
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return perf_info.max_time * 1e-9L;
 }
 
-long double Stopwatch::get_last_time(const string& perf_name) {
-  // Try to recover performance data
-  if (!performance_exists(perf_name))
-    throw StopwatchException("Performance not initialized.");
-
-  PerformanceData& perf_info = records_of->find(perf_name)->second;
-
-  return perf_info.last_time;
+long double Stopwatch::get_percentile_time(const string& perf_name,
+                                           const double percentile) {
+  if (percentile < 0. || percentile > 100.) {
+    throw StopwatchException("Percentile has to be in [0, 100].");
+  }
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  if (perf_info.stops == 0) return 0.;
+  const std::uint64_t rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(
+             std::ceil(percentile * 1e-2 * perf_info.stops)));
+  std::uint64_t count = 0;
+  std::size_t bucket = 0;
+  for (; bucket < kHistogramSize - 1; ++bucket) {
+    count += perf_info.histogram[bucket];
+    if (count >= rank) break;
+  }
+  const long double time = std::min<long double>(
+      std::max<long double>(histogram_value(bucket), perf_info.min_time),
+      perf_info.max_time);
+  return time * 1e-9L;
 }
 
-Stopwatch::Watcher Stopwatch::watcher(const string& perf_name) {
-  if (!active) return Watcher(*this, perf_name, nullptr);
-
-  const auto it = records_of->insert(make_pair(perf_name, PerformanceData()));
-
-  PerformanceData* perf_info = &(it.first->second);
-
-  return Watcher(*this, perf_name, perf_info);
+long double Stopwatch::get_last_time(const string& perf_name) {
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return perf_info.last_time * 1e-9L;
 }
 
-void Stopwatch::Watcher::_start() {
-  if (!w.profiler_active) return;
-
-  if (p == nullptr) {
-    p = &w.get_or_create_perf(n);
-  }
-
-  p->clock_start = w.take_time();
-  p->paused = false;
+std::size_t Stopwatch::get_nsamples(const string& perf_name) {
+  PerformanceSummary perf_info;
+  summarize(get_id(perf_name), perf_info);
+  return static_cast<std::size_t>(perf_info.stops);
 }
 
-void Stopwatch::Watcher::_stop() {
-  if (!w.profiler_active || (p == nullptr)) return;
-
-  long double clock_end = w.take_time();
-  w.stop_perf(*p, clock_end);
+Stopwatch::Watcher Stopwatch::watcher(const string& perf_name) {
+  return Watcher(*this, perf_name, intern(perf_name));
 }
 
 }  // end namespace crocoddyl
@@ -9,9 +9,26 @@
 #include "crocoddyl/multibody/utils/quadruped-gaits.hpp"
 
 #include "crocoddyl/core/costs/residual.hpp"
+#include "crocoddyl/core/utils/exception.hpp"
 
 namespace crocoddyl {
 
+namespace {
+
+// Return the residual of a task of the node's costs
+std::shared_ptr<ResidualModelAbstract> getTaskResidual(
+    const CostModelSum& cost_model, const std::string& name) {
+  const CostModelSum::CostModelContainer& costs = cost_model.get_costs();
+  CostModelSum::CostModelContainer::const_iterator it = costs.find(name);
+  if (it == costs.end()) {
+    throw_pretty("Invalid argument: " << "the task cost \"" << name
+                                      << "\" does not exist");
+  }
+  return it->second->cost->get_residual();
+}
+
+}  // namespace
+
 SimpleQuadrupedGaitProblem::SimpleQuadrupedGaitProblem(
     const pinocchio::Model& rmodel, const std::string& lf_foot,
     const std::string& rf_foot, const std::string& lh_foot,
@@ -51,7 +68,52 @@ SimpleQuadrupedGaitProblem::createWalkingProblem(
     const Eigen::VectorXd& x0, const double steplength, const double stepheight,
     const double timestep, const std::size_t stepknots,
     const std::size_t supportknots) {
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > loco3d_model;
+  createWalkingModels(x0, steplength, stepheight, timestep, stepknots,
+                      supportknots, false, loco3d_model);
+  return std::make_shared<crocoddyl::ShootingProblem>(x0, loco3d_model,
+                                                      loco3d_model.back());
+}
+
+void SimpleQuadrupedGaitProblem::updateWalkingProblem(
+    const std::shared_ptr<crocoddyl::ShootingProblem>& problem,
+    const Eigen::VectorXd& x0, const double steplength, const double stepheight,
+    const double timestep, const std::size_t stepknots,
+    const std::size_t supportknots) {
+  const std::size_t T = 2 * supportknots + 4 * (stepknots + 1);
+  if (problem->get_T() != T) {
+    throw_pretty("Invalid argument: "
+                 << "problem has wrong horizon (it should be " +
+                        std::to_string(T) + ")");
+  }
+  createWalkingModels(x0, steplength, stepheight, timestep, stepknots,
+                      supportknots, true, pooled_models_);
+
+  // Only the nodes that are not the pooled models allocate a new data
+  problem->set_x0(x0);
+  const std::vector<std::shared_ptr<ActionModelAbstract> >& models =
+      problem->get_runningModels();
+  for (std::size_t t = 0; t < T; ++t) {
+    if (models[t] != pooled_models_[t]) {
+      problem->updateModel(t, pooled_models_[t]);
+    }
+  }
+  if (problem->get_terminalModel() != pooled_models_.back()) {
+    problem->updateModel(T, pooled_models_.back());
+  }
+}
+
+void SimpleQuadrupedGaitProblem::createWalkingModels(
+    const Eigen::VectorXd& x0, const double steplength, const double stepheight,
+    const double timestep, const std::size_t stepknots,
+    const std::size_t supportknots, const bool pooled,
+    std::vector<std::shared_ptr<ActionModelAbstract> >& loco3d_model) {
   int nq = rmodel_.nq;
+  if (pooled) {
+    for (std::size_t i = 0; i < pool_.size(); ++i) {
+      pool_[i].next = 0;
+    }
+  }
 
   // Initial Condition
   const Eigen::VectorBlock<const Eigen::VectorXd> q0 = x0.head(nq);
@@ -73,7 +135,7 @@ SimpleQuadrupedGaitProblem::createWalkingProblem(
   comRef[2] = rdata_.com[0][2];
 
   // Defining the action models along the time instances
-  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > loco3d_model;
+  loco3d_model.clear();
   std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > rh_step,
       rf_step, lh_step, lf_step;
 
@@ -86,7 +148,11 @@ SimpleQuadrupedGaitProblem::createWalkingProblem(
   Eigen::Vector3d nullCoM =
       Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
   std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > doubleSupport(
-      supportknots, createSwingFootModel(timestep, support_feet, nullCoM));
+      supportknots,
+      pooled ? getPooledModel(SwingFootNode, timestep, support_feet, nullCoM,
+                              std::vector<pinocchio::FrameIndex>(),
+                              std::vector<pinocchio::SE3>())
+             : createSwingFootModel(timestep, support_feet, nullCoM));
 
   const pinocchio::FrameIndex rh_s[] = {lf_foot_id_, rf_foot_id_, lh_foot_id_};
   const pinocchio::FrameIndex rf_s[] = {lf_foot_id_, lh_foot_id_, rh_foot_id_};
@@ -112,23 +178,27 @@ SimpleQuadrupedGaitProblem::createWalkingProblem(
   std::vector<Eigen::Vector3d> rf_foot_pos0_v(1, rf_foot_pos0);
   std::vector<Eigen::Vector3d> lf_foot_pos0_v(1, lf_foot_pos0);
   if (firtstep_) {
-    rh_step =
-        createFootStepModels(timestep, comRef, rh_foot_pos0_v, 0.5 * steplength,
-                             stepheight, stepknots, rh_support, rh_foot);
-    rf_step =
-        createFootStepModels(timestep, comRef, rf_foot_pos0_v, 0.5 * steplength,
-                             stepheight, stepknots, rf_support, rf_foot);
+    rh_step = createFootStepModels(timestep, comRef, rh_foot_pos0_v,
+                                   0.5 * steplength, stepheight, stepknots,
+                                   rh_support, rh_foot, pooled);
+    rf_step = createFootStepModels(timestep, comRef, rf_foot_pos0_v,
+                                   0.5 * steplength, stepheight, stepknots,
+                                   rf_support, rf_foot, pooled);
     firtstep_ = false;
   } else {
     rh_step = createFootStepModels(timestep, comRef, rh_foot_pos0_v, steplength,
-                                   stepheight, stepknots, rh_support, rh_foot);
+                                   stepheight, stepknots, rh_support, rh_foot,
+                                   pooled);
     rf_step = createFootStepModels(timestep, comRef, rf_foot_pos0_v, steplength,
-                                   stepheight, stepknots, rf_support, rf_foot);
+                                   stepheight, stepknots, rf_support, rf_foot,
+                                   pooled);
   }
   lh_step = createFootStepModels(timestep, comRef, lh_foot_pos0_v, steplength,
-                                 stepheight, stepknots, lh_support, lh_foot);
+                                 stepheight, stepknots, lh_support, lh_foot,
+                                 pooled);
   lf_step = createFootStepModels(timestep, comRef, lf_foot_pos0_v, steplength,
-                                 stepheight, stepknots, lf_support, lf_foot);
+                                 stepheight, stepknots, lf_support, lf_foot,
+                                 pooled);
 
   loco3d_model.insert(loco3d_model.end(), doubleSupport.begin(),
                       doubleSupport.end());
@@ -138,9 +208,6 @@ SimpleQuadrupedGaitProblem::createWalkingProblem(
                       doubleSupport.end());
   loco3d_model.insert(loco3d_model.end(), lh_step.begin(), lh_step.end());
   loco3d_model.insert(loco3d_model.end(), lf_step.begin(), lf_step.end());
-
-  return std::make_shared<crocoddyl::ShootingProblem>(x0, loco3d_model,
-                                                      loco3d_model.back());
 }
 
 std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >
@@ -150,6 +217,19 @@ SimpleQuadrupedGaitProblem::createFootStepModels(
     double stepheight, std::size_t n_knots,
     const std::vector<pinocchio::FrameIndex>& support_foot_ids,
     const std::vector<pinocchio::FrameIndex>& swingFootIds) {
+  return createFootStepModels(timestep, com_pos0, feet_pos0, steplength,
+                              stepheight, n_knots, support_foot_ids,
+                              swingFootIds, false);
+}
+
+std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >
+SimpleQuadrupedGaitProblem::createFootStepModels(
+    double timestep, Eigen::Vector3d& com_pos0,
+    std::vector<Eigen::Vector3d>& feet_pos0, double steplength,
+    double stepheight, std::size_t n_knots,
+    const std::vector<pinocchio::FrameIndex>& support_foot_ids,
+    const std::vector<pinocchio::FrameIndex>& swingFootIds,
+    const bool pooled) {
   std::size_t n_legs =
       static_cast<std::size_t>(support_foot_ids.size() + swingFootIds.size());
   double com_percentage =
@@ -189,12 +269,21 @@ SimpleQuadrupedGaitProblem::createFootStepModels(
         Eigen::Vector3d(steplength * _kp1_n, 0., 0.) * com_percentage +
         com_pos0;
     foot_swing_model.push_back(
-        createSwingFootModel(timestep, support_foot_ids, com_task,
-                             id_foot_swing_task, ref_foot_swing_task));
+        pooled ? getPooledModel(SwingFootNode, timestep, support_foot_ids,
+                                com_task, id_foot_swing_task,
+                                ref_foot_swing_task)
+               : createSwingFootModel(timestep, support_foot_ids, com_task,
+                                      id_foot_swing_task, ref_foot_swing_task));
   }
   // Action model for the foot switch
-  foot_swing_model.push_back(createFootSwitchModel(
-      support_foot_ids, id_foot_swing_task, ref_foot_swing_task));
+  foot_swing_model.push_back(
+      pooled ? getPooledModel(
+                   ImpulseNode, 0., support_foot_ids,
+                   Eigen::Vector3d::Constant(
+                       std::numeric_limits<double>::infinity()),
+                   id_foot_swing_task, ref_foot_swing_task)
+             : createFootSwitchModel(support_foot_ids, id_foot_swing_task,
+                                     ref_foot_swing_task));
 
   // Updating the current foot position for next step
   com_pos0 += Eigen::Vector3d(steplength * com_percentage, 0., 0.);
@@ -417,8 +506,103 @@ SimpleQuadrupedGaitProblem::createImpulseModel(
       state_, impulse_model, cost_model);
 }
 
+std::shared_ptr<ActionModelAbstract> SimpleQuadrupedGaitProblem::getPooledModel(
+    const GaitNodeType type, const double timestep,
+    const std::vector<pinocchio::FrameIndex>& support_foot_ids,
+    const Eigen::Vector3d& com_task,
+    const std::vector<pinocchio::FrameIndex>& id_foot_swing_task,
+    const std::vector<pinocchio::SE3>& ref_foot_swing_task) {
+  // The foot tasks are defined only when their ids and references are given
+  const bool has_com_task =
+      type == SwingFootNode && com_task.array().allFinite();
+  const bool has_swing_task =
+      !id_foot_swing_task.empty() && !ref_foot_swing_task.empty();
+  GaitPhase* phase = NULL;
+  for (std::size_t i = 0; i < pool_.size(); ++i) {
+    GaitPhase& p = pool_[i];
+    if (p.type == type && p.com_task == has_com_task &&
+        p.support_ids == support_foot_ids &&
+        p.swing_ids.empty() == !has_swing_task &&
+        (!has_swing_task || p.swing_ids == id_foot_swing_task)) {
+      phase = &p;
+      break;
+    }
+  }
+  if (phase == NULL) {
+    pool_.push_back(GaitPhase());
+    phase = &pool_.back();
+    phase->type = type;
+    phase->support_ids = support_foot_ids;
+    if (has_swing_task) {
+      phase->swing_ids = id_foot_swing_task;
+    }
+    phase->com_task = has_com_task;
+    phase->next = 0;
+  }
+
+  if (phase->next < phase->nodes.size()) {
+    // Update the references of a pooled model
+    GaitNode& node = phase->nodes[phase->next++];
+    if (type == SwingFootNode) {
+      node.integrated->set_dt(timestep);
+    }
+    if (has_com_task) {
+      node.com_residual->set_reference(com_task);
+    }
+    for (std::size_t i = 0; i < node.foot_residuals.size(); ++i) {
+      node.foot_residuals[i]->set_reference(
+          ref_foot_swing_task[i].translation());
+    }
+    return node.model;
+  }
+
+  // Create a new model and keep the residuals of its tasks
+  GaitNode node;
+  std::shared_ptr<CostModelSum> cost_model;
+  if (type == ImpulseNode) {
+    node.model = createImpulseModel(support_foot_ids, id_foot_swing_task,
+                                    ref_foot_swing_task);
+    cost_model =
+        std::static_pointer_cast<ActionModelImpulseFwdDynamics>(node.model)
+            ->get_costs();
+  } else {
+    node.model = createSwingFootModel(timestep, support_foot_ids, com_task,
+                                      id_foot_swing_task, ref_foot_swing_task);
+    node.integrated =
+        std::static_pointer_cast<IntegratedActionModelAbstract>(node.model);
+    cost_model = std::static_pointer_cast<
+                     DifferentialActionModelContactFwdDynamics>(
+                     node.integrated->get_differential())
+                     ->get_costs();
+  }
+  if (has_com_task) {
+    node.com_residual = std::static_pointer_cast<ResidualModelCoMPosition>(
+        getTaskResidual(*cost_model, "comTrack"));
+  }
+  if (has_swing_task) {
+    for (std::size_t i = 0; i < id_foot_swing_task.size(); ++i) {
+      node.foot_residuals.push_back(
+          std::static_pointer_cast<ResidualModelFrameTranslation>(
+              getTaskResidual(*cost_model,
+                              rmodel_.frames[id_foot_swing_task[i]].name +
+                                  "_footTrack")));
+    }
+  }
+  phase->nodes.push_back(node);
+  ++phase->next;
+  return node.model;
+}
+
 const Eigen::VectorXd& SimpleQuadrupedGaitProblem::get_defaultState() const {
   return defaultstate_;
 }
 
+std::size_t SimpleQuadrupedGaitProblem::get_npooledModels() const {
+  std::size_t nmodels = 0;
+  for (std::size_t i = 0; i < pool_.size(); ++i) {
+    nmodels += pool_[i].nodes.size();
+  }
+  return nmodels;
+}
+
 }  // namespace crocoddyl
@@ -168,6 +168,52 @@ class ActionModelAbstractTestCase(unittest.TestCase):
             np.allclose(self.DATA.Lxx, self.DATA_DER.Lxx, atol=1e-9), "Wrong Lxx."
         )
 
+    def test_calcDiffBatch(self):
+        # Run calcDiffBatch for both action models
+        N = 5
+        state = self.MODEL.state
+        xs = np.vstack([state.rand() for _ in range(N)])
+        us = np.random.rand(N, self.MODEL.nu)
+        batch = self.MODEL.createBatchData(N)
+        batch_der = self.MODEL_DER.createBatchData(N)
+        self.MODEL.calcDiffBatch(batch, xs, us)
+        self.MODEL_DER.calcDiffBatch(batch_der, xs, us)
+        self.assertEqual(batch.cost.shape, (N,), "Wrong cost dimension.")
+        self.assertTrue(
+            np.allclose(batch.cost, batch_der.cost, atol=1e-9), "Wrong cost values."
+        )
+        self.assertTrue(np.allclose(batch.Fx, batch_der.Fx, atol=1e-9), "Wrong Fx.")
+        self.assertTrue(np.allclose(batch.Lxx, batch_der.Lxx, atol=1e-9), "Wrong Lxx.")
+        # Checking the samples against calcDiff
+        for k in range(N):
+            self.MODEL.calc(self.DATA, xs[k], us[k])
+            self.MODEL.calcDiff(self.DATA, xs[k], us[k])
+            self.assertAlmostEqual(
+                batch.cost[k], self.DATA.cost, 10, "Wrong cost value."
+            )
+            self.assertTrue(
+                np.allclose(
+                    batch.Fx[k].reshape(self.DATA.Fx.shape), self.DATA.Fx, atol=1e-9
+                ),
+                "Wrong Fx.",
+            )
+            self.assertTrue(
+                np.allclose(
+                    batch.Fu[k].reshape(self.DATA.Fu.shape), self.DATA.Fu, atol=1e-9
+                ),
+                "Wrong Fu.",
+            )
+            self.assertTrue(
+                np.allclose(batch.Lx[k], self.DATA.Lx, atol=1e-9), "Wrong Lx."
+            )
+        # Checking the terminal samples
+        self.MODEL.calcBatch(batch, xs)
+        for k in range(N):
+            self.MODEL.calc(self.DATA, xs[k])
+            self.assertAlmostEqual(
+                batch.cost[k], self.DATA.cost, 10, "Wrong cost value."
+            )
+
 
 class UnicycleTest(ActionModelAbstractTestCase):
     MODEL = crocoddyl.ActionModelUnicycle()
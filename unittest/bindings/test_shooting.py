@@ -78,6 +78,31 @@ class ShootingProblemTestCase(unittest.TestCase):
                 np.allclose(x1, x2, atol=1e-9), "The rollout state doesn't match."
             )
 
+    def test_rollouts(self):
+        state = self.MODEL.state
+        rng = np.random.default_rng()
+        uss = [[rng.random(self.MODEL.nu) for _ in range(self.T)] for _ in range(3)]
+        x0s = [state.rand() for _ in range(3)]
+        xss, costs = self.PROBLEM.rollouts(uss, x0s)
+        xssDer, costsDer = self.PROBLEM_DER.rollouts(uss, x0s)
+        self.assertEqual(len(xss), 3, "Wrong number of rollouts.")
+        for xs, xsDer, us, x0, cost, costDer in zip(
+            xss, xssDer, uss, x0s, costs, costsDer
+        ):
+            self.PROBLEM.x0 = x0
+            xsSeq = self.PROBLEM.rollout(us)
+            for x1, x2, x3 in zip(xs, xsDer, xsSeq):
+                self.assertTrue(
+                    np.allclose(x1, x2, atol=1e-9), "The rollout state doesn't match."
+                )
+                self.assertTrue(
+                    np.allclose(x1, x3, atol=1e-9), "The rollout state doesn't match."
+                )
+            self.assertAlmostEqual(
+                cost, self.PROBLEM.calc(xsSeq, us), 7, "The cost doesn't match."
+            )
+            self.assertAlmostEqual(cost, costDer, 7, "The cost doesn't match.")
+
 
 class UnicycleShootingTest(ShootingProblemTestCase):
     MODEL = crocoddyl.ActionModelUnicycle()
@@ -119,9 +144,90 @@ class TalosArmShootingTest(ShootingProblemTestCase):
     MODEL_DER = crocoddyl.IntegratedActionModelEuler(DIFF_MODEL_DER, 1e-3)
 
 
+class ProblemParametersTest(unittest.TestCase):
+    T = 5
+    ROBOT_MODEL = example_robot_data.load("talos_arm").model
+    STATE = crocoddyl.StateMultibody(ROBOT_MODEL)
+    FRAME_ID = ROBOT_MODEL.getFrameId("gripper_left_joint")
+
+    def setUp(self):
+        model = crocoddyl.ActionModelUnicycle()
+        self.problem = crocoddyl.ShootingProblem(
+            np.zeros(3), [model] * self.T, model
+        )
+        self.params = crocoddyl.ProblemParameters(self.problem)
+        self.params.addParameter("uref", np.zeros(self.STATE.nv))
+        self.params.addParameter("pose", np.array([0.0] * 6 + [1.0]))
+        self.uregs, self.poses = [], []
+        for t in range(self.T + 1):
+            self.uregs.append(crocoddyl.ResidualModelControl(self.STATE))
+            self.poses.append(
+                crocoddyl.ResidualModelFramePlacement(
+                    self.STATE, self.FRAME_ID, pinocchio.SE3.Random()
+                )
+            )
+            self.params.bindReference("uref", t, self.uregs[t])
+            self.params.bindReference("pose", t, self.poses[t])
+
+    def test_dimensions(self):
+        self.assertEqual(self.params.names, ["uref", "pose"])
+        self.assertEqual(self.params.nparams, self.STATE.nv + 7)
+        self.assertEqual(self.params.offset("pose"), self.STATE.nv)
+        self.assertEqual(self.params.dim("pose"), 7)
+        self.assertEqual(self.params.nbindings, 2 * (self.T + 1))
+        self.assertEqual(self.params.values.shape, (self.T + 1, self.STATE.nv + 7))
+
+    def test_update(self):
+        uref = np.random.rand(self.T + 1, self.STATE.nv)
+        self.params.set("uref", uref)
+        pose = pinocchio.SE3.Random()
+        self.params.set("pose", 2, pinocchio.SE3ToXYZQUAT(pose))
+        self.params.update()
+        for t in range(self.T + 1):
+            self.assertTrue(
+                np.allclose(self.uregs[t].reference, uref[t]),
+                "Wrong control reference.",
+            )
+        self.assertTrue(
+            self.poses[2].reference.isApprox(pose), "Wrong placement reference."
+        )
+        self.assertTrue(np.allclose(self.params.get("uref"), uref))
+
+    def test_bind_function(self):
+        q = np.zeros(self.T + 1)
+
+        def bind(problem, t, value):
+            q[t] = value[0]
+
+        self.params.addParameter("q", np.ones(1))
+        for t in range(self.T + 1):
+            self.params.bind("q", t, bind)
+        self.params.updateAll()
+        self.assertTrue(np.allclose(q, np.ones(self.T + 1)))
+        self.params.set("q", self.T, np.array([2.0]))
+        self.params.update()
+        self.assertEqual(q[self.T], 2.0)
+
+    def test_wrong_dimension(self):
+        with self.assertRaises(Exception):
+            self.params.set("uref", np.zeros((2, self.STATE.nv)))
+        with self.assertRaises(Exception):
+            self.params.bindReference(
+                "uref",
+                0,
+                crocoddyl.ResidualModelFrameTranslation(
+                    self.STATE, self.FRAME_ID, np.zeros(3)
+                ),
+            )
+
+
 if __name__ == "__main__":
     # test to be run
-    test_classes_to_run = [UnicycleShootingTest, TalosArmShootingTest]
+    test_classes_to_run = [
+        UnicycleShootingTest,
+        TalosArmShootingTest,
+        ProblemParametersTest,
+    ]
     loader = unittest.TestLoader()
     suites_list = []
     for test_class in test_classes_to_run:
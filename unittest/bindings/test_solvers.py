@@ -1,4 +1,6 @@
+import os
 import sys
+import threading
 import unittest
 from random import randint
 
@@ -194,6 +196,242 @@ class TalosArmFDDPTest(SolverAbstractTestCase):
     SOLVER_DER = FDDPDerived
 
 
+class ConcurrentSolversTest(unittest.TestCase):
+    NSOLVERS = 4
+
+    def createSolver(self):
+        model = crocoddyl.ActionModelUnicycle()
+        problem = crocoddyl.ShootingProblem(
+            np.array([1.0, 0.5, 0.3]), [model] * 50, model
+        )
+        return crocoddyl.SolverFDDP(problem)
+
+    def test_concurrent_solve(self):
+        # The solvers release the GIL, then they can run from Python threads
+        solvers = [self.createSolver() for _ in range(self.NSOLVERS)]
+        threads = [threading.Thread(target=s.solve) for s in solvers]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        solver = self.createSolver()
+        solver.solve()
+        for s in solvers:
+            self.assertEqual(s.iter, solver.iter, "Wrong number of iterations.")
+            self.assertAlmostEqual(s.cost, solver.cost, 10, "Wrong cost.")
+            for x, xref in zip(s.xs, solver.xs):
+                self.assertTrue(np.allclose(x, xref, atol=1e-9), "Wrong xs.")
+
+
+class UnicycleMPPITest(unittest.TestCase):
+    def setUp(self):
+        model = crocoddyl.ActionModelUnicycle()
+        self.problem = crocoddyl.ShootingProblem(
+            np.array([1.0, 0.5, 0.3]), [model] * 20, model
+        )
+        self.solver = crocoddyl.SolverMPPI(self.problem, 64, 0.2, 1.0, 3)
+
+    def test_solve(self):
+        self.solver.solve([], [], 0)
+        cost0 = self.solver.cost
+        self.solver.solve([], [], 10)
+        self.assertLessEqual(self.solver.cost, cost0, "Cost increased.")
+        self.assertEqual(len(self.solver.us_samples), 64, "Wrong number of samples.")
+        self.assertAlmostEqual(sum(self.solver.weights), 1.0, 10, "Wrong weights.")
+
+    def test_warm_start_fddp(self):
+        self.solver.solve([], [], 10)
+        fddp = crocoddyl.SolverFDDP(self.problem)
+        fddp.solve(self.solver.xs, self.solver.us, 100, True)
+        fddp_cold = crocoddyl.SolverFDDP(self.problem)
+        fddp_cold.solve()
+        self.assertAlmostEqual(fddp.cost, fddp_cold.cost, 6, "Wrong cost.")
+
+
+class SolverPoolTest(unittest.TestCase):
+    NPROBLEMS = 6
+
+    def setUp(self):
+        model = crocoddyl.ActionModelUnicycle()
+        self.problems = [
+            crocoddyl.ShootingProblem(np.random.rand(3), [model] * 20, model)
+            for _ in range(self.NPROBLEMS)
+        ]
+
+    def test_solve(self):
+        pool = crocoddyl.SolverPool(2)
+        results = pool.solve(self.problems)
+        self.assertEqual(len(results), self.NPROBLEMS, "Wrong number of results.")
+        for problem, result in zip(self.problems, results):
+            solver = crocoddyl.SolverFDDP(problem)
+            solver.solve()
+            self.assertEqual(result.iter, solver.iter, "Wrong number of iterations.")
+            self.assertAlmostEqual(result.cost, solver.cost, 10, "Wrong cost.")
+
+    def test_solver_factory(self):
+        def factory(problem):
+            solver = crocoddyl.SolverDDP(problem)
+            solver.th_stop = 1e-12
+            return solver
+
+        pool = crocoddyl.SolverPool(factory, 2)
+        us = [[np.random.rand(2)] * 20 for _ in range(self.NPROBLEMS)]
+        results = pool.solve(self.problems[:1], [], us)
+        self.assertEqual(len(results), self.NPROBLEMS, "Wrong number of results.")
+        for result in results:
+            self.assertAlmostEqual(result.cost, results[0].cost, 8, "Wrong cost.")
+
+
+class TrajectoryArrayTest(unittest.TestCase):
+    def setUp(self):
+        model = crocoddyl.ActionModelUnicycle()
+        self.problem = crocoddyl.ShootingProblem(
+            np.array([1.0, 0.5, 0.3]), [model] * 20, model
+        )
+        self.solver = crocoddyl.SolverFDDP(self.problem)
+        self.solver.solve()
+
+    def test_get(self):
+        xs, us = self.solver.xsArray, self.solver.usArray
+        self.assertEqual(xs.shape, (21, 3), "Wrong shape of xs.")
+        self.assertEqual(us.shape, (20, 2), "Wrong shape of us.")
+        self.assertTrue(np.array_equal(xs, np.array(self.solver.xs)), "Wrong xs.")
+        self.assertTrue(np.array_equal(us, np.array(self.solver.us)), "Wrong us.")
+        self.assertTrue(np.array_equal(self.solver.fsArray, np.array(self.solver.fs)))
+        K = self.solver.KArray.reshape(20, 2, 3)
+        for t in range(20):
+            self.assertTrue(np.array_equal(K[t], self.solver.K[t]), "Wrong K.")
+        self.assertTrue(np.array_equal(self.solver.kArray, np.array(self.solver.k)))
+
+    def test_read_only(self):
+        for array in [
+            self.solver.xsArray,
+            self.solver.usArray,
+            self.solver.fsArray,
+            self.solver.KArray,
+            self.solver.kArray,
+        ]:
+            self.assertFalse(array.flags.writeable, "Array has to be read-only.")
+            with self.assertRaises(ValueError):
+                array[0] = 0.0
+
+    def test_set(self):
+        xs = np.random.rand(21, 3)
+        us = np.random.rand(20, 2)
+        self.assertTrue(self.solver.isFeasible)
+        self.solver.xsArray = xs
+        self.assertFalse(self.solver.isFeasible, "Warm start has to be infeasible.")
+        self.solver.usArray = us
+        self.assertTrue(np.array_equal(np.array(self.solver.xs), xs), "Wrong xs.")
+        self.assertTrue(np.array_equal(np.array(self.solver.us), us), "Wrong us.")
+        with self.assertRaises(Exception):
+            self.solver.usArray = np.random.rand(20, 3)
+        with self.assertRaises(Exception):
+            self.solver.xsArray = np.random.rand(20, 3)
+
+
+class SnapshotTest(unittest.TestCase):
+    def setUp(self):
+        self.model = crocoddyl.ActionModelUnicycle()
+        self.problem = crocoddyl.ShootingProblem(
+            np.array([1.0, 0.5, 0.3]), [self.model] * 20, self.model
+        )
+        self.solver = crocoddyl.SolverFDDP(self.problem)
+        self.solver.solve([], [], 5)
+        self.filename = "test_unicycle.snapshot"
+        crocoddyl.saveSnapshot(self.filename, self.solver)
+
+    def tearDown(self):
+        os.remove(self.filename)
+
+    def test_read(self):
+        reader = crocoddyl.SnapshotReader(self.filename)
+        self.assertEqual(reader.T, 20, "Wrong horizon.")
+        self.assertEqual(reader.iter, self.solver.iter, "Wrong iteration.")
+        self.assertEqual(reader.cost, self.solver.cost, "Wrong cost.")
+        self.assertTrue(reader.hasGains, "Missing gains.")
+        self.assertTrue(np.array_equal(reader.x0, self.problem.x0), "Wrong x0.")
+        for x, xs in zip(reader.xs, self.solver.xs):
+            self.assertTrue(np.array_equal(x, xs), "Wrong state.")
+        for K, Ks in zip(reader.K, self.solver.K):
+            self.assertTrue(np.array_equal(K, Ks), "Wrong feedback gain.")
+
+    def test_restore(self):
+        problem = crocoddyl.ShootingProblem(np.zeros(3), [self.model] * 20, self.model)
+        solver = crocoddyl.SolverFDDP(problem)
+        reader = crocoddyl.SnapshotReader(self.filename)
+        self.assertTrue(reader.isCompatible(problem), "Wrong compatibility.")
+        reader.restore(solver)
+        self.assertTrue(np.array_equal(problem.x0, self.problem.x0), "Wrong x0.")
+        for u, us in zip(solver.us, self.solver.us):
+            self.assertTrue(np.array_equal(u, us), "Wrong control.")
+        for k, ks in zip(solver.k, self.solver.k):
+            self.assertTrue(np.array_equal(k, ks), "Wrong feed-forward term.")
+        other = crocoddyl.ShootingProblem(np.zeros(3), [self.model] * 10, self.model)
+        self.assertFalse(reader.isCompatible(other), "Wrong compatibility.")
+
+
+class SolutionSensitivityTest(unittest.TestCase):
+    T = 10
+    NX, NU = 4, 2
+
+    def setUp(self):
+        self.models = [
+            crocoddyl.ActionModelLQR.Random(self.NX, self.NU) for _ in range(self.T + 1)
+        ]
+        self.problem = crocoddyl.ShootingProblem(
+            np.random.rand(self.NX), self.models[:-1], self.models[-1]
+        )
+        self.params = crocoddyl.ProblemParameters(self.problem)
+        self.params.addParameter("q", np.zeros(self.NX))
+
+        def bind(problem, t, q):
+            m = self.models[t]
+            m.setLQR(m.A, m.B, m.Q, m.R, m.N, m.G, m.H, m.f, q, m.r, m.g, m.h)
+
+        for t in range(self.T + 1):
+            self.params.bind("q", t, bind)
+        self.params.update()
+        self.solver = crocoddyl.SolverDDP(self.problem)
+        self.solver.solve()
+        self.sensitivity = crocoddyl.SolutionSensitivity(self.solver, self.params)
+        self.sensitivity.compute()
+
+    def test_initial_state(self):
+        h = 1e-4
+        for i in range(self.NX):
+            x0 = self.problem.x0.copy()
+            x0[i] += h
+            solver = crocoddyl.SolverDDP(
+                crocoddyl.ShootingProblem(x0, self.models[:-1], self.models[-1])
+            )
+            solver.solve()
+            for t in range(self.T):
+                dus = (solver.us[t] - self.solver.us[t]) / h
+                self.assertTrue(
+                    np.allclose(dus, self.sensitivity.dus_dx0[t][:, i], atol=1e-5),
+                    "Wrong control sensitivity.",
+                )
+
+    def test_parameters(self):
+        h = 1e-4
+        values = self.params.values
+        xs = [x.copy() for x in self.solver.xs]
+        for j in range(self.NX):
+            values_h = values.copy()
+            values_h[:, j] += h
+            self.params.set_values(values_h)
+            self.params.update()
+            solver = crocoddyl.SolverDDP(self.problem)
+            solver.solve()
+            for t in range(self.T + 1):
+                dxs = (solver.xs[t] - xs[t]) / h
+                self.assertTrue(
+                    np.allclose(dxs, self.sensitivity.dxs_dp[t][:, j], atol=1e-5),
+                    "Wrong state sensitivity.",
+                )
+
+
 if __name__ == "__main__":
     # test to be run
     test_classes_to_run = [
@@ -201,6 +439,12 @@ if __name__ == "__main__":
         UnicycleFDDPTest,
         TalosArmDDPTest,
         TalosArmFDDPTest,
+        ConcurrentSolversTest,
+        UnicycleMPPITest,
+        SolverPoolTest,
+        TrajectoryArrayTest,
+        SnapshotTest,
+        SolutionSensitivityTest,
     ]
     loader = unittest.TestLoader()
     suites_list = []
@@ -8,6 +8,7 @@
 
 #include "control.hpp"
 
+#include "crocoddyl/core/controls/bspline.hpp"
 #include "crocoddyl/core/controls/poly-one.hpp"
 #include "crocoddyl/core/controls/poly-two-rk.hpp"
 #include "crocoddyl/core/controls/poly-zero.hpp"
@@ -33,6 +34,9 @@ std::ostream& operator<<(std::ostream& os, ControlTypes::Type type) {
     case ControlTypes::PolyTwoRK4:
       os << "PolyTwoRK4";
       break;
+    case ControlTypes::BSpline:
+      os << "BSpline";
+      break;
     case ControlTypes::NbControlTypes:
       os << "NbControlTypes";
       break;
@@ -68,6 +72,11 @@ ControlFactory::create(ControlTypes::Type control_type,
           std::make_shared<crocoddyl::ControlParametrizationModelPolyTwoRK>(
               nu, RKType::four);
       break;
+    case ControlTypes::BSpline:
+      control =
+          std::make_shared<crocoddyl::ControlParametrizationModelBSpline>(
+              nu, 5, 3, 0.25, 0.75);
+      break;
     default:
       throw_pretty(__FILE__ ": Wrong ControlTypes::Type given");
       break;
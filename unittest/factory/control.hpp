@@ -19,7 +19,14 @@ namespace crocoddyl {
 namespace unittest {
 
 struct ControlTypes {
-  enum Type { PolyZero, PolyOne, PolyTwoRK3, PolyTwoRK4, NbControlTypes };
+  enum Type {
+    PolyZero,
+    PolyOne,
+    PolyTwoRK3,
+    PolyTwoRK4,
+    BSpline,
+    NbControlTypes
+  };
   static std::vector<Type> init_all() {
     std::vector<Type> v;
     v.reserve(NbControlTypes);
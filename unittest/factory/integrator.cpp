@@ -9,6 +9,8 @@
 #include "integrator.hpp"
 
 #include "crocoddyl/core/integrator/euler.hpp"
+#include "crocoddyl/core/integrator/implicit-euler.hpp"
+#include "crocoddyl/core/integrator/multi-step.hpp"
 #include "crocoddyl/core/integrator/rk.hpp"
 #include "crocoddyl/core/utils/exception.hpp"
 
@@ -23,6 +25,12 @@ std::ostream& operator<<(std::ostream& os, IntegratorTypes::Type type) {
     case IntegratorTypes::IntegratorEuler:
       os << "IntegratorEuler";
       break;
+    case IntegratorTypes::IntegratorImplicitEuler:
+      os << "IntegratorImplicitEuler";
+      break;
+    case IntegratorTypes::IntegratorSemiImplicitEuler:
+      os << "IntegratorSemiImplicitEuler";
+      break;
     case IntegratorTypes::IntegratorRK2:
       os << "IntegratorRK2";
       break;
@@ -32,6 +40,9 @@ std::ostream& operator<<(std::ostream& os, IntegratorTypes::Type type) {
     case IntegratorTypes::IntegratorRK4:
       os << "IntegratorRK4";
       break;
+    case IntegratorTypes::IntegratorMultiStep:
+      os << "IntegratorMultiStep";
+      break;
     case IntegratorTypes::NbIntegratorTypes:
       os << "NbIntegratorTypes";
       break;
@@ -53,6 +64,14 @@ IntegratorFactory::create(
     case IntegratorTypes::IntegratorEuler:
       action = std::make_shared<crocoddyl::IntegratedActionModelEuler>(model);
       break;
+    case IntegratorTypes::IntegratorImplicitEuler:
+      action = std::make_shared<crocoddyl::IntegratedActionModelImplicitEuler>(
+          model, Implicit);
+      break;
+    case IntegratorTypes::IntegratorSemiImplicitEuler:
+      action = std::make_shared<crocoddyl::IntegratedActionModelImplicitEuler>(
+          model, SemiImplicit);
+      break;
     case IntegratorTypes::IntegratorRK2:
       action = std::make_shared<crocoddyl::IntegratedActionModelRK>(
           model, RKType::two);
@@ -65,6 +84,10 @@ IntegratorFactory::create(
       action = std::make_shared<crocoddyl::IntegratedActionModelRK>(
           model, RKType::four);
       break;
+    case IntegratorTypes::IntegratorMultiStep:
+      action = std::make_shared<crocoddyl::IntegratedActionModelMultiStep>(
+          model, 2, 4, 2, 2e-3);
+      break;
     default:
       throw_pretty(__FILE__ ": Wrong IntegratorTypes::Type given");
       break;
@@ -83,6 +106,14 @@ IntegratorFactory::create(
       action = std::make_shared<crocoddyl::IntegratedActionModelEuler>(model,
                                                                        control);
       break;
+    case IntegratorTypes::IntegratorImplicitEuler:
+      action = std::make_shared<crocoddyl::IntegratedActionModelImplicitEuler>(
+          model, control, Implicit);
+      break;
+    case IntegratorTypes::IntegratorSemiImplicitEuler:
+      action = std::make_shared<crocoddyl::IntegratedActionModelImplicitEuler>(
+          model, control, SemiImplicit);
+      break;
     case IntegratorTypes::IntegratorRK2:
       action = std::make_shared<crocoddyl::IntegratedActionModelRK>(
           model, control, RKType::two);
@@ -95,6 +126,17 @@ IntegratorFactory::create(
       action = std::make_shared<crocoddyl::IntegratedActionModelRK>(
           model, control, RKType::four);
       break;
+    case IntegratorTypes::IntegratorMultiStep: {
+      std::vector<std::shared_ptr<crocoddyl::IntegratedActionModelAbstract> >
+          steps(2);
+      steps[0] = std::make_shared<crocoddyl::IntegratedActionModelEuler>(
+          model, control);
+      steps[1] = std::make_shared<crocoddyl::IntegratedActionModelRK>(
+          model, control, RKType::two);
+      action = std::make_shared<crocoddyl::IntegratedActionModelMultiStep>(
+          steps, control);
+      break;
+    }
     default:
       throw_pretty(__FILE__ ": Wrong IntegratorTypes::Type given");
       break;
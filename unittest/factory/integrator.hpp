@@ -20,9 +20,12 @@ namespace unittest {
 struct IntegratorTypes {
   enum Type {
     IntegratorEuler,
+    IntegratorImplicitEuler,
+    IntegratorSemiImplicitEuler,
     IntegratorRK2,
     IntegratorRK3,
     IntegratorRK4,
+    IntegratorMultiStep,
     NbIntegratorTypes
   };
   static std::vector<Type> init_all() {
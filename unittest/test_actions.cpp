@@ -11,6 +11,7 @@
 #define BOOST_TEST_NO_MAIN
 #define BOOST_TEST_ALTERNATIVE_INIT_API
 
+#include "crocoddyl/core/integrator/rk.hpp"
 #include "factory/action.hpp"
 #include "factory/control.hpp"
 #include "factory/diff_action.hpp"
@@ -112,6 +113,115 @@ void test_partial_derivatives_against_numdiff(
   BOOST_CHECK((data->Gx - data_num_diff->Gx).isZero(tol));
 }
 
+void test_calc_and_diff_against_calc_and_calc_diff(
+    const std::shared_ptr<crocoddyl::ActionModelAbstract>& model) {
+  // create the corresponding data objects
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data =
+      model->createData();
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data_fused =
+      model->createData();
+
+  // Generating random values for the state and control
+  Eigen::VectorXd x = model->get_state()->rand();
+  const Eigen::VectorXd u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Computing the action and its derivatives
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  model->calcAndDiff(data_fused, x, u);
+  double tol = std::sqrt(2.0 * std::numeric_limits<double>::epsilon());
+  BOOST_CHECK(std::abs(data->cost - data_fused->cost) < tol);
+  BOOST_CHECK((data->xnext - data_fused->xnext).isZero(tol));
+  BOOST_CHECK((data->h - data_fused->h).isZero(tol));
+  BOOST_CHECK((data->g - data_fused->g).isZero(tol));
+  BOOST_CHECK((data->Fx - data_fused->Fx).isZero(tol));
+  BOOST_CHECK((data->Fu - data_fused->Fu).isZero(tol));
+  BOOST_CHECK((data->Lx - data_fused->Lx).isZero(tol));
+  BOOST_CHECK((data->Lu - data_fused->Lu).isZero(tol));
+  BOOST_CHECK((data->Lxx - data_fused->Lxx).isZero(tol));
+  BOOST_CHECK((data->Lxu - data_fused->Lxu).isZero(tol));
+  BOOST_CHECK((data->Luu - data_fused->Luu).isZero(tol));
+  BOOST_CHECK((data->Hx - data_fused->Hx).isZero(tol));
+  BOOST_CHECK((data->Hu - data_fused->Hu).isZero(tol));
+  BOOST_CHECK((data->Gx - data_fused->Gx).isZero(tol));
+  BOOST_CHECK((data->Gu - data_fused->Gu).isZero(tol));
+
+  // Computing the action and its derivatives for terminal nodes
+  x = model->get_state()->rand();
+  model->calc(data, x);
+  model->calcDiff(data, x);
+  model->calcAndDiff(data_fused, x);
+  BOOST_CHECK(std::abs(data->cost - data_fused->cost) < tol);
+  BOOST_CHECK((data->h - data_fused->h).isZero(tol));
+  BOOST_CHECK((data->g - data_fused->g).isZero(tol));
+  BOOST_CHECK((data->Lx - data_fused->Lx).isZero(tol));
+  BOOST_CHECK((data->Lxx - data_fused->Lxx).isZero(tol));
+  BOOST_CHECK((data->Hx - data_fused->Hx).isZero(tol));
+  BOOST_CHECK((data->Gx - data_fused->Gx).isZero(tol));
+}
+
+void test_calc_batch(
+    const std::shared_ptr<crocoddyl::ActionModelAbstract>& model) {
+  typedef crocoddyl::MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+  const std::size_t N = 7;
+  const std::size_t ndx = model->get_state()->get_ndx();
+  const std::size_t nu = model->get_nu();
+
+  // create the batch data and the data used to compute each sample
+  const std::shared_ptr<crocoddyl::ActionBatchData>& batch =
+      model->createBatchData(N);
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data =
+      model->createData();
+
+  // Generating random states and controls
+  MatrixXdRowMajor xs(N, model->get_state()->get_nx());
+  const MatrixXdRowMajor us = MatrixXdRowMajor::Random(N, nu);
+  for (std::size_t k = 0; k < N; ++k) {
+    xs.row(k) = model->get_state()->rand().transpose();
+  }
+
+  // Checking the batch evaluation against the evaluation of each sample
+  model->calcDiffBatch(batch, xs, us);
+  double tol = std::sqrt(2.0 * std::numeric_limits<double>::epsilon());
+  for (std::size_t k = 0; k < N; ++k) {
+    const Eigen::VectorXd x = xs.row(k).transpose();
+    const Eigen::VectorXd u = us.row(k).transpose();
+    model->calc(data, x, u);
+    model->calcDiff(data, x, u);
+    BOOST_CHECK(std::abs(batch->cost[k] - data->cost) < tol);
+    BOOST_CHECK((batch->xnext.row(k).transpose() - data->xnext).isZero(tol));
+    BOOST_CHECK((Eigen::Map<MatrixXdRowMajor>(batch->Fx.row(k).data(), ndx,
+                                              ndx) -
+                 data->Fx)
+                    .isZero(tol));
+    BOOST_CHECK(
+        (Eigen::Map<MatrixXdRowMajor>(batch->Fu.row(k).data(), ndx, nu) -
+         data->Fu)
+            .isZero(tol));
+    BOOST_CHECK((batch->Lx.row(k).transpose() - data->Lx).isZero(tol));
+    BOOST_CHECK((batch->Lu.row(k).transpose() - data->Lu).isZero(tol));
+    BOOST_CHECK((Eigen::Map<MatrixXdRowMajor>(batch->Lxx.row(k).data(), ndx,
+                                              ndx) -
+                 data->Lxx)
+                    .isZero(tol));
+    BOOST_CHECK(
+        (Eigen::Map<MatrixXdRowMajor>(batch->Luu.row(k).data(), nu, nu) -
+         data->Luu)
+            .isZero(tol));
+  }
+
+  // Checking the batch evaluation for terminal nodes
+  model->calcBatch(batch, xs, MatrixXdRowMajor());
+  for (std::size_t k = 0; k < N; ++k) {
+    model->calc(data, xs.row(k).transpose());
+    BOOST_CHECK(std::abs(batch->cost[k] - data->cost) < tol);
+  }
+
+  // Checking that wrong dimensions are detected
+  BOOST_CHECK_THROW(model->calcBatch(batch, xs.topRows(N - 1), us),
+                    crocoddyl::Exception);
+}
+
 void test_check_action_data(ActionModelTypes::Type action_model_type) {
   // create the model
   ActionModelFactory factory;
@@ -146,6 +256,14 @@ void test_calc_action_model(ActionModelTypes::Type action_model_type) {
   test_calc(model);
 }
 
+void test_calc_batch_action_model(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory.create(action_model_type);
+  test_calc_batch(model);
+}
+
 void test_calc_integrated_action_model(
     DifferentialActionModelTypes::Type dam_type,
     IntegratorTypes::Type integrator_type, ControlTypes::Type control_type) {
@@ -191,6 +309,81 @@ void test_partial_derivatives_integrated_action_model(
   test_partial_derivatives_against_numdiff(model);
 }
 
+void test_calc_and_diff_action_model(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory.create(action_model_type);
+  test_calc_and_diff_against_calc_and_calc_diff(model);
+}
+
+void test_calc_and_diff_integrated_action_model(
+    DifferentialActionModelTypes::Type dam_type,
+    IntegratorTypes::Type integrator_type, ControlTypes::Type control_type) {
+  // create the differential action model
+  DifferentialActionModelFactory factory_dam;
+  const std::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& dam =
+      factory_dam.create(dam_type);
+  // create the control discretization
+  ControlFactory factory_ctrl;
+  const std::shared_ptr<crocoddyl::ControlParametrizationModelAbstract>& ctrl =
+      factory_ctrl.create(control_type, dam->get_nu());
+  // create the integrator
+  IntegratorFactory factory_int;
+  const std::shared_ptr<crocoddyl::IntegratedActionModelAbstract>& model =
+      factory_int.create(integrator_type, dam, ctrl);
+  test_calc_and_diff_against_calc_and_calc_diff(model);
+}
+
+void test_parallel_stage_derivatives_integrated_action_model(
+    DifferentialActionModelTypes::Type dam_type,
+    IntegratorTypes::Type integrator_type, ControlTypes::Type control_type) {
+  // create the differential action model
+  DifferentialActionModelFactory factory_dam;
+  const std::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& dam =
+      factory_dam.create(dam_type);
+  // create the control discretization
+  ControlFactory factory_ctrl;
+  const std::shared_ptr<crocoddyl::ControlParametrizationModelAbstract>& ctrl =
+      factory_ctrl.create(control_type, dam->get_nu());
+  // create the integrator
+  IntegratorFactory factory_int;
+  std::shared_ptr<crocoddyl::IntegratedActionModelRK> model =
+      std::static_pointer_cast<crocoddyl::IntegratedActionModelRK>(
+          factory_int.create(integrator_type, dam, ctrl));
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data =
+      model->createData();
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data_par =
+      model->createData();
+  const std::shared_ptr<crocoddyl::ActionDataAbstract>& data_fused =
+      model->createData();
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd x = model->get_state()->rand();
+  const Eigen::VectorXd u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Computing the derivatives with sequential and concurrent stages
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  model->set_nthreads(static_cast<int>(model->get_ni()));
+  model->calc(data_par, x, u);
+  model->calcDiff(data_par, x, u);
+  model->calcAndDiff(data_fused, x, u);
+  const std::vector<std::shared_ptr<crocoddyl::ActionDataAbstract> > datas = {
+      data_par, data_fused};
+  for (std::size_t i = 0; i < datas.size(); ++i) {
+    const std::shared_ptr<crocoddyl::ActionDataAbstract>& d = datas[i];
+    BOOST_CHECK((data->xnext - d->xnext).isZero(1e-9));
+    BOOST_CHECK((data->Fx - d->Fx).isZero(1e-9));
+    BOOST_CHECK((data->Fu - d->Fu).isZero(1e-9));
+    BOOST_CHECK((data->Lx - d->Lx).isZero(1e-9));
+    BOOST_CHECK((data->Lu - d->Lu).isZero(1e-9));
+    BOOST_CHECK((data->Lxx - d->Lxx).isZero(1e-9));
+    BOOST_CHECK((data->Lxu - d->Lxu).isZero(1e-9));
+    BOOST_CHECK((data->Luu - d->Luu).isZero(1e-9));
+  }
+}
+
 /**
  * Test two action models that should provide the same result when calling calc
  * if the first part of the control input u of model2 is equal to the control
@@ -270,6 +463,10 @@ void register_action_model_unit_tests(
       BOOST_TEST_CASE(boost::bind(&test_calc_action_model, action_model_type)));
   ts->add(BOOST_TEST_CASE(
       boost::bind(&test_partial_derivatives_action_model, action_model_type)));
+  ts->add(BOOST_TEST_CASE(
+      boost::bind(&test_calc_and_diff_action_model, action_model_type)));
+  ts->add(BOOST_TEST_CASE(
+      boost::bind(&test_calc_batch_action_model, action_model_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -290,6 +487,16 @@ void register_integrated_action_model_unit_tests(
   ts->add(BOOST_TEST_CASE(
       boost::bind(&test_partial_derivatives_integrated_action_model, dam_type,
                   integrator_type, control_type)));
+  ts->add(
+      BOOST_TEST_CASE(boost::bind(&test_calc_and_diff_integrated_action_model,
+                                  dam_type, integrator_type, control_type)));
+  if (integrator_type == IntegratorTypes::IntegratorRK2 ||
+      integrator_type == IntegratorTypes::IntegratorRK3 ||
+      integrator_type == IntegratorTypes::IntegratorRK4) {
+    ts->add(BOOST_TEST_CASE(
+        boost::bind(&test_parallel_stage_derivatives_integrated_action_model,
+                    dam_type, integrator_type, control_type)));
+  }
   framework::master_test_suite().add(ts);
 }
 
@@ -302,6 +509,12 @@ bool init_function() {
     register_integrated_action_model_unit_tests(
         DifferentialActionModelTypes::all[i], IntegratorTypes::IntegratorEuler,
         ControlTypes::PolyZero);
+    register_integrated_action_model_unit_tests(
+        DifferentialActionModelTypes::all[i],
+        IntegratorTypes::IntegratorImplicitEuler, ControlTypes::PolyZero);
+    register_integrated_action_model_unit_tests(
+        DifferentialActionModelTypes::all[i],
+        IntegratorTypes::IntegratorSemiImplicitEuler, ControlTypes::PolyZero);
     register_integrated_action_model_unit_tests(
         DifferentialActionModelTypes::all[i], IntegratorTypes::IntegratorRK2,
         ControlTypes::PolyZero);
@@ -326,6 +539,12 @@ bool init_function() {
     register_integrated_action_model_unit_tests(
         DifferentialActionModelTypes::all[i], IntegratorTypes::IntegratorRK4,
         ControlTypes::PolyTwoRK4);
+    register_integrated_action_model_unit_tests(
+        DifferentialActionModelTypes::all[i],
+        IntegratorTypes::IntegratorMultiStep, ControlTypes::PolyZero);
+    register_integrated_action_model_unit_tests(
+        DifferentialActionModelTypes::all[i],
+        IntegratorTypes::IntegratorMultiStep, ControlTypes::BSpline);
   }
 
   for (size_t i = 0; i < DifferentialActionModelTypes::all.size(); ++i) {
@@ -190,6 +190,54 @@ void test_torqueTransform(ActuationModelTypes::Type actuation_type,
   BOOST_CHECK((data->Mtau - data_num_diff->Mtau).isZero(tol));
 }
 
+void test_multiply_by_jacobians(ActuationModelTypes::Type actuation_type,
+                                StateModelTypes::Type state_type) {
+  // create the model
+  ActuationModelFactory factory;
+  const std::shared_ptr<crocoddyl::ActuationModelAbstract>& model =
+      factory.create(actuation_type, state_type);
+
+  // create the corresponding data object
+  const std::shared_ptr<crocoddyl::ActuationDataAbstract>& data =
+      model->createData();
+
+  // Generating random values for the state and control
+  const Eigen::VectorXd x = model->get_state()->rand();
+  const Eigen::VectorXd u = Eigen::VectorXd::Random(model->get_nu());
+  const std::size_t nv = model->get_state()->get_nv();
+  const std::size_t ndx = model->get_state()->get_ndx();
+  const std::size_t nu = model->get_nu();
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Random(nv + 2, nv);
+
+  // Computing the Jacobians
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+
+  // Checking the structured products against the dense ones
+  Eigen::MatrixXd Ax = Eigen::MatrixXd::Random(nv + 2, ndx);
+  Eigen::MatrixXd Au = Eigen::MatrixXd::Random(nv + 2, nu);
+  Eigen::MatrixXd Ax_dense = Ax;
+  Eigen::MatrixXd Au_dense = Au;
+  model->multiplyByStateJacobian(data, A, Ax);
+  model->multiplyByControlJacobian(data, A, Au);
+  Ax_dense = A * data->dtau_dx;
+  Au_dense = A * data->dtau_du;
+  BOOST_CHECK((Ax - Ax_dense).isZero(1e-9));
+  BOOST_CHECK((Au - Au_dense).isZero(1e-9));
+  model->multiplyByStateJacobian(data, A, Ax, crocoddyl::addto);
+  model->multiplyByControlJacobian(data, A, Au, crocoddyl::addto);
+  Ax_dense += A * data->dtau_dx;
+  Au_dense += A * data->dtau_du;
+  BOOST_CHECK((Ax - Ax_dense).isZero(1e-9));
+  BOOST_CHECK((Au - Au_dense).isZero(1e-9));
+  model->multiplyByStateJacobian(data, A, Ax, crocoddyl::rmfrom);
+  model->multiplyByControlJacobian(data, A, Au, crocoddyl::rmfrom);
+  Ax_dense -= A * data->dtau_dx;
+  Au_dense -= A * data->dtau_du;
+  BOOST_CHECK((Ax - Ax_dense).isZero(1e-9));
+  BOOST_CHECK((Au - Au_dense).isZero(1e-9));
+}
+
 //----------------------------------------------------------------------------//
 
 void register_actuation_model_unit_tests(
@@ -211,6 +259,8 @@ void register_actuation_model_unit_tests(
       BOOST_TEST_CASE(boost::bind(&test_commands, actuation_type, state_type)));
   ts->add(BOOST_TEST_CASE(
       boost::bind(&test_torqueTransform, actuation_type, state_type)));
+  ts->add(BOOST_TEST_CASE(
+      boost::bind(&test_multiply_by_jacobians, actuation_type, state_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -145,6 +145,65 @@ void test_box_qp_with_identity_hessian() {
   BOOST_CHECK(sol_reg.clamped_idx.size() == nc_reg);
 }
 
+void test_box_qp_with_random_hessian() {
+  std::size_t nx = random_int_in_range(2, 10);
+  crocoddyl::BoxQP boxqp(nx);
+
+  Eigen::MatrixXd H = Eigen::MatrixXd::Random(nx, nx);
+  Eigen::MatrixXd hessian =
+      H.transpose() * H + 0.1 * Eigen::MatrixXd::Identity(nx, nx);
+  Eigen::VectorXd gradient = 3. * Eigen::VectorXd::Random(nx);
+  Eigen::VectorXd lb = -Eigen::VectorXd::Random(nx).cwiseAbs();
+  Eigen::VectorXd ub = Eigen::VectorXd::Random(nx).cwiseAbs();
+  Eigen::VectorXd xinit = 2. * Eigen::VectorXd::Random(nx);
+  crocoddyl::BoxQPSolution sol = boxqp.solve(hessian, gradient, lb, ub, xinit);
+
+  // Checking the KKT conditions of the problem
+  Eigen::MatrixXd hessian_reg =
+      hessian + boxqp.get_reg() * Eigen::MatrixXd::Identity(nx, nx);
+  Eigen::VectorXd g = gradient + hessian_reg * sol.x;
+  const std::size_t nf = sol.free_idx.size();
+  for (std::size_t i = 0; i < nf; ++i) {
+    BOOST_CHECK(std::abs(g(sol.free_idx[i])) <= 1e-7);
+  }
+  for (std::size_t i = 0; i < sol.clamped_idx.size(); ++i) {
+    const std::size_t ci = sol.clamped_idx[i];
+    BOOST_CHECK((sol.x(ci) == lb(ci) && g(ci) > 0.) ||
+                (sol.x(ci) == ub(ci) && g(ci) < 0.));
+  }
+  BOOST_CHECK(nf + sol.clamped_idx.size() == nx);
+
+  // Checking the inverse of the free Hessian
+  Eigen::MatrixXd Hff(nf, nf);
+  for (std::size_t i = 0; i < nf; ++i) {
+    for (std::size_t j = 0; j < nf; ++j) {
+      Hff(i, j) = hessian_reg(sol.free_idx[i], sol.free_idx[j]);
+    }
+  }
+  BOOST_CHECK((sol.Hff_inv * Hff - Eigen::MatrixXd::Identity(nf, nf))
+                  .isZero(1e-7));
+
+  // Checking the product with the inverse of the free Hessian
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(nx, 3);
+  crocoddyl::BoxQP::MatrixXdRowMajor X = B;
+  boxqp.solveFreeInPlace(X);
+  Eigen::MatrixXd X_inv = Eigen::MatrixXd::Zero(nx, 3);
+  for (std::size_t i = 0; i < nf; ++i) {
+    for (std::size_t j = 0; j < nf; ++j) {
+      X_inv.row(sol.free_idx[i]) += sol.Hff_inv(i, j) * B.row(sol.free_idx[j]);
+    }
+  }
+  BOOST_CHECK((X - X_inv).isZero(1e-9));
+
+  // Checking that a warm-started solution is the same
+  boxqp.set_with_inverse(false);
+  crocoddyl::BoxQPSolution sol_warm =
+      boxqp.solve(hessian, gradient, lb, ub, sol.x);
+  BOOST_CHECK((sol_warm.x - sol.x).isZero(1e-9));
+  BOOST_CHECK(sol_warm.free_idx == sol.free_idx);
+  BOOST_CHECK(sol_warm.clamped_idx == sol.clamped_idx);
+}
+
 void register_unit_tests() {
   framework::master_test_suite().add(
       BOOST_TEST_CASE(boost::bind(&test_constructor)));
@@ -154,6 +213,8 @@ void register_unit_tests() {
       BOOST_TEST_CASE(boost::bind(&test_unconstrained_qp)));
   framework::master_test_suite().add(
       BOOST_TEST_CASE(boost::bind(&test_box_qp_with_identity_hessian)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_box_qp_with_random_hessian)));
 }
 
 bool init_function() {
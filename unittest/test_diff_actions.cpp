@@ -192,6 +192,120 @@ void test_partial_derivatives_against_numdiff(
   BOOST_CHECK((data->Gx - data_num_diff->Gx).isZero(tol));
 }
 
+void test_calc_and_diff_against_calc_and_calc_diff(
+    DifferentialActionModelTypes::Type action_type) {
+  // create the model
+  DifferentialActionModelFactory factory;
+  std::shared_ptr<crocoddyl::DifferentialActionModelAbstract> model =
+      factory.create(action_type);
+
+  // create the corresponding data objects
+  std::shared_ptr<crocoddyl::DifferentialActionDataAbstract> data =
+      model->createData();
+  std::shared_ptr<crocoddyl::DifferentialActionDataAbstract> data_fused =
+      model->createData();
+
+  // Generating random values for the state and control
+  Eigen::VectorXd x = model->get_state()->rand();
+  const Eigen::VectorXd u = Eigen::VectorXd::Random(model->get_nu());
+
+  // Computing the action and its derivatives
+  model->calc(data, x, u);
+  model->calcDiff(data, x, u);
+  model->calcAndDiff(data_fused, x, u);
+  double tol = std::sqrt(2.0 * std::numeric_limits<double>::epsilon());
+  BOOST_CHECK(std::abs(data->cost - data_fused->cost) < tol);
+  BOOST_CHECK((data->xout - data_fused->xout).isZero(tol));
+  BOOST_CHECK((data->h - data_fused->h).isZero(tol));
+  BOOST_CHECK((data->g - data_fused->g).isZero(tol));
+  BOOST_CHECK((data->Fx - data_fused->Fx).isZero(tol));
+  BOOST_CHECK((data->Fu - data_fused->Fu).isZero(tol));
+  BOOST_CHECK((data->Lx - data_fused->Lx).isZero(tol));
+  BOOST_CHECK((data->Lu - data_fused->Lu).isZero(tol));
+  BOOST_CHECK((data->Lxx - data_fused->Lxx).isZero(tol));
+  BOOST_CHECK((data->Lxu - data_fused->Lxu).isZero(tol));
+  BOOST_CHECK((data->Luu - data_fused->Luu).isZero(tol));
+  BOOST_CHECK((data->Hx - data_fused->Hx).isZero(tol));
+  BOOST_CHECK((data->Hu - data_fused->Hu).isZero(tol));
+  BOOST_CHECK((data->Gx - data_fused->Gx).isZero(tol));
+  BOOST_CHECK((data->Gu - data_fused->Gu).isZero(tol));
+
+  // Computing the action and its derivatives for terminal nodes
+  x = model->get_state()->rand();
+  model->calc(data, x);
+  model->calcDiff(data, x);
+  model->calcAndDiff(data_fused, x);
+  BOOST_CHECK(std::abs(data->cost - data_fused->cost) < tol);
+  BOOST_CHECK((data->h - data_fused->h).isZero(tol));
+  BOOST_CHECK((data->g - data_fused->g).isZero(tol));
+  BOOST_CHECK((data->Lx - data_fused->Lx).isZero(tol));
+  BOOST_CHECK((data->Lxx - data_fused->Lxx).isZero(tol));
+  BOOST_CHECK((data->Hx - data_fused->Hx).isZero(tol));
+  BOOST_CHECK((data->Gx - data_fused->Gx).isZero(tol));
+}
+
+void test_calc_batch(DifferentialActionModelTypes::Type action_type) {
+  typedef crocoddyl::MathBaseTpl<double>::MatrixXsRowMajor MatrixXdRowMajor;
+  // create the model
+  DifferentialActionModelFactory factory;
+  std::shared_ptr<crocoddyl::DifferentialActionModelAbstract> model =
+      factory.create(action_type);
+  const std::size_t N = 7;
+  const std::size_t nv = model->get_state()->get_nv();
+  const std::size_t ndx = model->get_state()->get_ndx();
+  const std::size_t nu = model->get_nu();
+
+  // create the batch data and the data used to compute each sample
+  std::shared_ptr<crocoddyl::DifferentialActionBatchData> batch =
+      model->createBatchData(N);
+  std::shared_ptr<crocoddyl::DifferentialActionDataAbstract> data =
+      model->createData();
+
+  // Generating random states and controls
+  MatrixXdRowMajor xs(N, model->get_state()->get_nx());
+  const MatrixXdRowMajor us = MatrixXdRowMajor::Random(N, nu);
+  for (std::size_t k = 0; k < N; ++k) {
+    xs.row(k) = model->get_state()->rand().transpose();
+  }
+
+  // Checking the batch evaluation against the evaluation of each sample
+  model->calcDiffBatch(batch, xs, us);
+  double tol = std::sqrt(2.0 * std::numeric_limits<double>::epsilon());
+  for (std::size_t k = 0; k < N; ++k) {
+    const Eigen::VectorXd x = xs.row(k).transpose();
+    const Eigen::VectorXd u = us.row(k).transpose();
+    model->calc(data, x, u);
+    model->calcDiff(data, x, u);
+    BOOST_CHECK(std::abs(batch->cost[k] - data->cost) < tol);
+    BOOST_CHECK((batch->xout.row(k).transpose() - data->xout).isZero(tol));
+    BOOST_CHECK(
+        (Eigen::Map<MatrixXdRowMajor>(batch->Fx.row(k).data(), nv, ndx) -
+         data->Fx)
+            .isZero(tol));
+    BOOST_CHECK(
+        (Eigen::Map<MatrixXdRowMajor>(batch->Fu.row(k).data(), nv, nu) -
+         data->Fu)
+            .isZero(tol));
+    BOOST_CHECK((batch->Lx.row(k).transpose() - data->Lx).isZero(tol));
+    BOOST_CHECK((batch->Lu.row(k).transpose() - data->Lu).isZero(tol));
+    BOOST_CHECK((Eigen::Map<MatrixXdRowMajor>(batch->Lxx.row(k).data(), ndx,
+                                              ndx) -
+                 data->Lxx)
+                    .isZero(tol));
+  }
+
+  // Checking the batch evaluation for terminal nodes
+  model->calcBatch(batch, xs, MatrixXdRowMajor());
+  for (std::size_t k = 0; k < N; ++k) {
+    model->calc(data, xs.row(k).transpose());
+    BOOST_CHECK(std::abs(batch->cost[k] - data->cost) < tol);
+  }
+
+  // Checking that wrong dimensions are detected
+  BOOST_CHECK_THROW(model->calcBatch(batch, xs.topRows(N - 1), us),
+                    crocoddyl::Exception);
+}
+
 //----------------------------------------------------------------------------//
 
 void register_action_model_unit_tests(
@@ -205,7 +319,10 @@ void register_action_model_unit_tests(
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_returns_a_cost, action_type)));
   ts->add(BOOST_TEST_CASE(
       boost::bind(&test_partial_derivatives_against_numdiff, action_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(
+      &test_calc_and_diff_against_calc_and_calc_diff, action_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasi_static, action_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_calc_batch, action_type)));
   framework::master_test_suite().add(ts);
 }
 
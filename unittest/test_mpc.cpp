@@ -0,0 +1,589 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <chrono>
+#include <thread>
+
+#include "crocoddyl/core/actions/diff-lqr.hpp"
+#include "crocoddyl/core/actions/lqr.hpp"
+#include "crocoddyl/core/actions/unicycle.hpp"
+#include "crocoddyl/core/integrator/rk.hpp"
+#include "crocoddyl/core/mpc/horizon.hpp"
+#include "crocoddyl/core/mpc/parameters.hpp"
+#include "crocoddyl/core/mpc/runtime.hpp"
+#include "crocoddyl/core/residuals/control.hpp"
+#include "crocoddyl/core/solvers/box-ddp.hpp"
+#include "crocoddyl/core/solvers/box-fddp.hpp"
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/core/solvers/intro.hpp"
+#include "crocoddyl/core/states/euclidean.hpp"
+#include "crocoddyl/core/utils/triple-buffer.hpp"
+#include "unittest_common.hpp"
+
+using namespace boost::unit_test;
+using namespace crocoddyl::unittest;
+
+std::shared_ptr<crocoddyl::SolverFDDP> create_unicycle_solver(
+    const std::size_t T) {
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      std::make_shared<crocoddyl::ActionModelUnicycle>();
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models(T,
+                                                                       model);
+  const Eigen::VectorXd x0 = model->get_state()->rand();
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(x0, models, model);
+  return std::make_shared<crocoddyl::SolverFDDP>(problem);
+}
+
+void test_triple_buffer() {
+  crocoddyl::TripleBuffer<int> buffer(0);
+  // Nothing is received before publishing
+  BOOST_CHECK(!buffer.update());
+  BOOST_CHECK(buffer.front() == 0);
+
+  // The reader receives the published value only once
+  buffer.back() = 1;
+  buffer.publish();
+  BOOST_CHECK(buffer.update());
+  BOOST_CHECK(buffer.front() == 1);
+  BOOST_CHECK(!buffer.update());
+  BOOST_CHECK(buffer.front() == 1);
+
+  // The reader receives the latest published value
+  buffer.back() = 2;
+  buffer.publish();
+  buffer.back() = 3;
+  buffer.publish();
+  BOOST_CHECK(buffer.update());
+  BOOST_CHECK(buffer.front() == 3);
+}
+
+void test_problem_shift() {
+  const std::size_t T = 10;
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(T);
+  const std::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      solver->get_problem();
+  const std::vector<std::shared_ptr<crocoddyl::ActionDataAbstract> > datas =
+      problem->get_runningDatas();
+
+  // The datas are rotated without allocating new ones
+  problem->shift(3);
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK(problem->get_runningDatas()[i] == datas[(i + 3) % T]);
+  }
+  BOOST_CHECK_THROW(problem->shift(T + 1), std::exception);
+}
+
+void test_solver_shift(const crocoddyl::ShiftPolicy policy) {
+  const std::size_t T = 20;
+  const std::size_t n = 5;
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(T);
+  const std::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      solver->get_problem();
+  const std::shared_ptr<crocoddyl::StateAbstract>& state =
+      problem->get_terminalModel()->get_state();
+  solver->solve();
+  if (policy == crocoddyl::QuasiStatic) {
+    // Quasi-static controls are defined for states with zero velocity
+    std::vector<Eigen::VectorXd> xs = solver->get_xs();
+    for (std::size_t i = 0; i < T + 1; ++i) {
+      xs[i].tail(state->get_nv()).setZero();
+    }
+    solver->setCandidate(xs, solver->get_us());
+  }
+  const std::vector<Eigen::VectorXd> xs = solver->get_xs();
+  const std::vector<Eigen::VectorXd> us = solver->get_us();
+  const std::vector<crocoddyl::SolverDDP::MatrixXdRowMajor> K =
+      solver->get_K();
+  const std::vector<Eigen::MatrixXd> Vxx = solver->get_Vxx();
+
+  // The shifted nodes keep their solution and Riccati gains
+  solver->shift(n, policy);
+  const std::size_t m = T - n;
+  for (std::size_t i = 0; i < m; ++i) {
+    BOOST_CHECK((solver->get_xs()[i] - xs[i + n]).isZero(1e-9));
+    BOOST_CHECK((solver->get_us()[i] - us[i + n]).isZero(1e-9));
+    BOOST_CHECK((solver->get_K()[i] - K[i + n]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Vxx()[i] - Vxx[i + n]).isZero(1e-9));
+  }
+
+  // The appended nodes are initialized by the shift policy
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      problem->get_runningModels().back();
+  std::shared_ptr<crocoddyl::ActionDataAbstract> data = model->createData();
+  Eigen::VectorXd u(2), dx(3);
+  for (std::size_t i = m; i < T; ++i) {
+    BOOST_CHECK((solver->get_K()[i] - K[T - 1]).isZero(1e-9));
+    BOOST_CHECK((solver->get_Vxx()[i + 1] - Vxx[T]).isZero(1e-9));
+    const Eigen::VectorXd& x = solver->get_xs()[i];
+    switch (policy) {
+      case crocoddyl::RepeatLast:
+        BOOST_CHECK((solver->get_us()[i] - us[T - 1]).isZero(1e-9));
+        BOOST_CHECK((solver->get_xs()[i + 1] - xs[T]).isZero(1e-9));
+        break;
+      case crocoddyl::QuasiStatic:
+        u = us[T - 1];
+        model->quasiStatic(data, u, x);
+        BOOST_CHECK((solver->get_us()[i] - u).isZero(1e-9));
+        BOOST_CHECK((solver->get_xs()[i + 1] - xs[T]).isZero(1e-9));
+        break;
+      case crocoddyl::TerminalRollout:
+        state->diff(xs[T - 1], x, dx);
+        u = us[T - 1] - K[T - 1] * dx;
+        BOOST_CHECK((solver->get_us()[i] - u).isZero(1e-9));
+        model->calc(data, x, u);
+        BOOST_CHECK((solver->get_xs()[i + 1] - data->xnext).isZero(1e-9));
+        break;
+    }
+  }
+
+  // The shifted solution warm-starts the next solve
+  problem->set_x0(solver->get_xs()[0]);
+  BOOST_CHECK(solver->solve(solver->get_xs(), solver->get_us()));
+}
+
+// Solvers that check the dimensions of their own per-node buffers
+template <class Solver>
+class SolverBoxTest : public Solver {
+ public:
+  explicit SolverBoxTest(std::shared_ptr<crocoddyl::ShootingProblem> problem)
+      : Solver(problem) {}
+
+  bool checkNodeBuffers() const {
+    const std::size_t T = this->problem_->get_T();
+    for (std::size_t t = 0; t < T; ++t) {
+      const Eigen::Index nu = static_cast<Eigen::Index>(
+          this->problem_->get_runningModels()[t]->get_nu());
+      if (this->du_lb_[t].size() != nu || this->du_ub_[t].size() != nu) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+class SolverIntroTest : public crocoddyl::SolverIntro {
+ public:
+  explicit SolverIntroTest(std::shared_ptr<crocoddyl::ShootingProblem> problem)
+      : crocoddyl::SolverIntro(problem) {}
+
+  bool checkNodeBuffers() const {
+    const std::size_t T = problem_->get_T();
+    for (std::size_t t = 0; t < T; ++t) {
+      const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+          problem_->get_runningModels()[t];
+      const Eigen::Index nu = static_cast<Eigen::Index>(model->get_nu());
+      const Eigen::Index nh = static_cast<Eigen::Index>(model->get_nh());
+      if (YZ_[t].rows() != nu || YZ_[t].cols() != nu ||
+          Hu_cache_[t].rows() != nh || Hu_cache_[t].cols() != nu) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+template <class Solver>
+void test_solver_shift_node_buffers() {
+  // Nodes with different control and equality-constraint dimensions
+  const std::size_t T = 10;
+  const std::size_t n = 3;
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models;
+  for (std::size_t t = 0; t < T; ++t) {
+    models.push_back(std::make_shared<crocoddyl::ActionModelLQR>(
+        crocoddyl::ActionModelLQR::Random(4, t % 2 == 0 ? 2 : 3, 0,
+                                          t % 2 == 0 ? 0 : 1)));
+  }
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(
+          Eigen::VectorXd::Random(4), models,
+          std::make_shared<crocoddyl::ActionModelLQR>(
+              crocoddyl::ActionModelLQR::Random(4, 2)));
+  std::shared_ptr<Solver> solver = std::make_shared<Solver>(problem);
+  solver->solve();
+
+  // The per-node buffers follow their nodes
+  solver->shift(n);
+  BOOST_CHECK(solver->checkNodeBuffers());
+  for (std::size_t t = 0; t < T - n; ++t) {
+    BOOST_CHECK(problem->get_runningModels()[t] == models[t + n]);
+  }
+  BOOST_CHECK(solver->solve(solver->get_xs(), solver->get_us()));
+  BOOST_CHECK(solver->checkNodeBuffers());
+}
+
+void test_real_time_iteration() {
+  const std::size_t T = 20;
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(T);
+  std::shared_ptr<crocoddyl::SolverFDDP> rti = create_unicycle_solver(T);
+  const std::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      rti->get_problem();
+  const std::shared_ptr<crocoddyl::StateAbstract>& state =
+      problem->get_terminalModel()->get_state();
+  // A close initial state ensures that FDDP accepts the full step
+  const Eigen::VectorXd x0 = Eigen::Vector3d(0.1, -0.1, 0.05);
+  solver->get_problem()->set_x0(x0);
+  problem->set_x0(x0);
+
+  // A real-time iteration matches a full-step iteration of FDDP
+  solver->solve(solver->get_xs(), solver->get_us(), 1);
+  BOOST_CHECK(solver->get_steplength() == 1.);
+  BOOST_CHECK(rti->prepareRTI());
+  BOOST_CHECK(rti->feedbackRTI(x0));
+  for (std::size_t i = 0; i < T; ++i) {
+    BOOST_CHECK((rti->get_xs()[i] - solver->get_xs()[i]).isZero(1e-9));
+    BOOST_CHECK((rti->get_us()[i] - solver->get_us()[i]).isZero(1e-9));
+  }
+  BOOST_CHECK(std::abs(rti->get_cost() - solver->get_cost()) < 1e-9);
+  BOOST_CHECK(rti->get_is_feasible());
+
+  // The feedback phase applies the stored gains on the measured state
+  BOOST_CHECK(rti->prepareRTI());
+  const std::vector<Eigen::VectorXd> xs = rti->get_xs();
+  const std::vector<Eigen::VectorXd> us = rti->get_us();
+  const Eigen::VectorXd x0_measured = x0 + Eigen::VectorXd::Constant(3, 1e-2);
+  const Eigen::VectorXd u0 =
+      us[0] - rti->get_k()[0] -
+      rti->get_K()[0] * state->diff_dx(xs[0], x0_measured);
+  BOOST_CHECK(rti->feedbackRTI(x0_measured));
+  BOOST_CHECK((rti->get_xs()[0] - x0_measured).isZero(1e-9));
+  BOOST_CHECK((rti->get_us()[0] - u0).isZero(1e-9));
+}
+
+void test_step_publishes_policy() {
+  const std::size_t T = 20;
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(T);
+  crocoddyl::MPCRuntime mpc(solver, 0.1, 100);
+  const Eigen::VectorXd x0 = solver->get_problem()->get_x0();
+  Eigen::VectorXd u(2);
+
+  // No policy is available before solving
+  BOOST_CHECK(!mpc.step());
+  BOOST_CHECK(!mpc.computeControl(0., x0, u));
+
+  // A new state triggers a single solve
+  mpc.setState(x0, 0.);
+  BOOST_CHECK(mpc.step());
+  BOOST_CHECK(!mpc.step());
+  BOOST_CHECK(mpc.get_nsolves() == 1);
+
+  // The policy matches the solver solution
+  BOOST_CHECK(mpc.computeControl(0., x0, u));
+  const crocoddyl::MPCPolicy& policy = mpc.get_policy();
+  BOOST_CHECK(policy.id == 1);
+  BOOST_CHECK(policy.xs.size() == T + 1);
+  BOOST_CHECK(policy.us.size() == T);
+  BOOST_CHECK(policy.K.size() == T);
+  BOOST_CHECK(std::abs(policy.ts.back() - 0.1 * static_cast<double>(T)) <
+              1e-9);
+  BOOST_CHECK((u - solver->get_us()[0]).isZero(1e-9));
+
+  // The feedback gains correct the state deviations
+  const Eigen::VectorXd dx = Eigen::VectorXd::Random(3) * 1e-3;
+  Eigen::VectorXd x(3);
+  solver->get_problem()->get_terminalModel()->get_state()->integrate(x0, dx,
+                                                                     x);
+  BOOST_CHECK(mpc.computeControl(0., x, u));
+  BOOST_CHECK((u - (solver->get_us()[0] - solver->get_K()[0] * dx))
+                  .isZero(1e-9));
+}
+
+void test_reference_interpolation() {
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(10);
+  crocoddyl::MPCRuntime mpc(solver, 0.1, 100);
+  mpc.setState(solver->get_problem()->get_x0(), 1.);
+  BOOST_CHECK(mpc.step());
+
+  Eigen::VectorXd xref(3), uref(2);
+  BOOST_CHECK(mpc.computeReference(1.05, xref, uref));
+  const std::vector<Eigen::VectorXd>& us = solver->get_us();
+  BOOST_CHECK((uref - 0.5 * (us[0] + us[1])).isZero(1e-9));
+
+  // Times outside the horizon are clamped
+  BOOST_CHECK(mpc.computeReference(0., xref, uref));
+  BOOST_CHECK((xref - solver->get_xs()[0]).isZero(1e-9));
+  BOOST_CHECK((uref - us[0]).isZero(1e-9));
+  BOOST_CHECK(mpc.computeReference(10., xref, uref));
+  BOOST_CHECK((xref - solver->get_xs().back()).isZero(1e-9));
+  BOOST_CHECK((uref - us.back()).isZero(1e-9));
+}
+
+void test_horizon_shift() {
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(20);
+  crocoddyl::MPCRuntime mpc(solver, 0.1, 100);
+  std::size_t nshift = 100;
+  mpc.set_problemUpdate(
+      [&nshift](const std::shared_ptr<crocoddyl::ShootingProblem>&,
+                const std::size_t n, const double) { nshift = n; });
+
+  mpc.setState(solver->get_problem()->get_x0(), 0.);
+  BOOST_CHECK(mpc.step());
+  BOOST_CHECK(nshift == 0);
+
+  // The horizon is shifted by the number of elapsed nodes
+  const Eigen::VectorXd x2 = solver->get_xs()[2];
+  mpc.setState(x2, 0.2);
+  BOOST_CHECK(mpc.step());
+  BOOST_CHECK(nshift == 2);
+  BOOST_CHECK((solver->get_problem()->get_x0() - x2).isZero(1e-9));
+  Eigen::VectorXd u(2);
+  BOOST_CHECK(mpc.computeControl(0.2, x2, u));
+  BOOST_CHECK(std::abs(mpc.get_policy().t0 - 0.2) < 1e-9);
+}
+
+void test_horizon_builder() {
+  std::shared_ptr<crocoddyl::DifferentialActionModelAbstract> dam =
+      std::make_shared<crocoddyl::DifferentialActionModelLQR>(2, 2);
+  crocoddyl::HorizonBuilder horizon(dam, dam);
+  horizon.addUniformSegment(10, 0.01);
+  horizon.addGradedSegment(1.4, 0.01, 1.2, crocoddyl::HorizonRK4, 0.1);
+  const std::size_t T = horizon.get_T();
+  BOOST_CHECK(T < 40);
+  BOOST_CHECK(std::abs(horizon.get_duration() - 1.5) < 1e-9);
+  BOOST_CHECK(horizon.get_ts().size() == T + 1);
+  BOOST_CHECK(horizon.get_dts()[T - 1] > horizon.get_dts()[10]);
+
+  // The problem follows the grid, and uniform nodes share their model
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      horizon.build(dam->get_state()->zero());
+  BOOST_CHECK(problem->get_T() == T);
+  const std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >&
+      models = problem->get_runningModels();
+  BOOST_CHECK(models[0] == models[9]);
+  BOOST_CHECK(models[9] != models[10]);
+  BOOST_CHECK(std::dynamic_pointer_cast<crocoddyl::IntegratedActionModelRK>(
+                  models[T - 1]) != nullptr);
+  for (std::size_t i = 0; i < T; ++i) {
+    const double dt =
+        std::static_pointer_cast<crocoddyl::IntegratedActionModelAbstract>(
+            models[i])
+            ->get_dt();
+    BOOST_CHECK(std::abs(dt - horizon.get_dts()[i]) < 1e-12);
+  }
+}
+
+void test_interpolate_trajectory() {
+  std::shared_ptr<crocoddyl::StateAbstract> state =
+      std::make_shared<crocoddyl::StateVector>(2);
+  const Eigen::Vector2d v(1., -2.);
+  std::vector<double> ts(5);
+  std::vector<Eigen::VectorXd> xs(5), us(4);
+  for (std::size_t i = 0; i < 5; ++i) {
+    ts[i] = 0.1 * static_cast<double>(i);
+    xs[i] = ts[i] * v;
+    if (i < 4) {
+      us[i] = Eigen::VectorXd::Constant(1, static_cast<double>(i));
+    }
+  }
+
+  // A coarser grid shifted in time
+  std::vector<double> ts_new(3);
+  ts_new[0] = 0.05;
+  ts_new[1] = 0.25;
+  ts_new[2] = 0.5;
+  std::vector<Eigen::VectorXd> xs_new(3), us_new(2, Eigen::VectorXd(1));
+  crocoddyl::interpolateTrajectory(state, ts, xs, us, ts_new, xs_new, us_new);
+  BOOST_CHECK((xs_new[0] - 0.05 * v).isZero(1e-12));
+  BOOST_CHECK((xs_new[1] - 0.25 * v).isZero(1e-12));
+  BOOST_CHECK((xs_new[2] - xs.back()).isZero(1e-12));
+  // The controls are the time average over each interval
+  BOOST_CHECK(std::abs(us_new[0][0] - (0.05 * 0. + 0.1 * 1. + 0.05 * 2.) /
+                                          0.2) < 1e-12);
+  BOOST_CHECK(std::abs(us_new[1][0] - (0.05 * 2. + 0.2 * 3.) / 0.25) < 1e-12);
+}
+
+void test_interpolated_warm_start() {
+  std::shared_ptr<crocoddyl::DifferentialActionModelAbstract> dam =
+      std::make_shared<crocoddyl::DifferentialActionModelLQR>(2, 2);
+  crocoddyl::HorizonBuilder horizon(dam, dam);
+  horizon.addUniformSegment(5, 0.01);
+  horizon.addGradedSegment(0.5, 0.01, 1.5);
+  const Eigen::VectorXd x0 = dam->get_state()->rand();
+  std::shared_ptr<crocoddyl::SolverFDDP> solver =
+      std::make_shared<crocoddyl::SolverFDDP>(horizon.build(x0));
+  crocoddyl::MPCRuntime mpc(solver, 0.01, 10);
+  mpc.set_warmStart(crocoddyl::InterpolateTime);
+  std::size_t nshift = 100;
+  mpc.set_problemUpdate(
+      [&nshift](const std::shared_ptr<crocoddyl::ShootingProblem>&,
+                const std::size_t n, const double) { nshift = n; });
+
+  mpc.setState(x0, 0.);
+  BOOST_CHECK(mpc.step());
+  const std::vector<Eigen::VectorXd> xs = solver->get_xs();
+
+  // The grid stays anchored to the initial time
+  mpc.setState(xs[2], 0.02);
+  BOOST_CHECK(mpc.step());
+  BOOST_CHECK(nshift == 0);
+  BOOST_CHECK(solver->get_problem()->get_T() == horizon.get_T());
+  Eigen::VectorXd u(2);
+  BOOST_CHECK(mpc.computeControl(0.02, xs[2], u));
+  const crocoddyl::MPCPolicy& policy = mpc.get_policy();
+  for (std::size_t i = 0; i <= horizon.get_T(); ++i) {
+    BOOST_CHECK(std::abs(policy.ts[i] - 0.02 - horizon.get_ts()[i]) < 1e-9);
+  }
+}
+
+void test_asynchronous_solve() {
+  std::shared_ptr<crocoddyl::SolverFDDP> solver = create_unicycle_solver(20);
+  crocoddyl::MPCRuntime mpc(solver, 0.1, 10);
+  const Eigen::VectorXd x0 = solver->get_problem()->get_x0();
+  Eigen::VectorXd u(2);
+
+  mpc.start();
+  BOOST_CHECK(mpc.is_running());
+  mpc.setState(x0, 0.);
+  for (std::size_t i = 0; i < 2000 && mpc.get_nsolves() == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  BOOST_CHECK(mpc.get_nsolves() > 0);
+  BOOST_CHECK(mpc.computeControl(0., x0, u));
+  mpc.stop();
+  BOOST_CHECK(!mpc.is_running());
+}
+
+// Environment vector with the interface of the code-generated action models
+struct EnvironmentModel {
+  explicit EnvironmentModel(const std::size_t nenv) : nenv(nenv) {}
+  std::size_t get_nenv() const { return nenv; }
+  void set_env(const std::shared_ptr<crocoddyl::ActionDataAbstract>& data,
+               const Eigen::Ref<const Eigen::VectorXd>& env) const {
+    data->cost = env.sum();
+  }
+  std::size_t nenv;
+};
+
+void test_problem_parameters() {
+  typedef crocoddyl::ProblemParameters::MatrixXdRowMajor MatrixXdRowMajor;
+  const std::size_t T = 10;
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models;
+  for (std::size_t t = 0; t < T; ++t) {
+    models.push_back(std::make_shared<crocoddyl::ActionModelLQR>(
+        crocoddyl::ActionModelLQR::Random(3, 2)));
+  }
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(
+          Eigen::VectorXd::Zero(3), models,
+          std::make_shared<crocoddyl::ActionModelLQR>(
+              crocoddyl::ActionModelLQR::Random(3, 2)));
+  std::shared_ptr<crocoddyl::StateVector> state =
+      std::make_shared<crocoddyl::StateVector>(3);
+
+  // Register the parameters and bind them to the nodes
+  crocoddyl::ProblemParameters params(problem);
+  BOOST_CHECK(params.addParameter("uref", Eigen::VectorXd::Zero(2)) == 0);
+  BOOST_CHECK(params.addParameter("q", Eigen::VectorXd::Ones(3)) == 2);
+  BOOST_CHECK(params.get_nparams() == 5);
+  std::vector<std::shared_ptr<crocoddyl::ResidualModelControl> > residuals;
+  for (std::size_t t = 0; t < T; ++t) {
+    residuals.push_back(std::make_shared<crocoddyl::ResidualModelControl>(
+        state, Eigen::VectorXd::Zero(2)));
+    params.bindReference("uref", t, residuals[t]);
+    params.bind("q", t,
+                [](const std::shared_ptr<crocoddyl::ShootingProblem>& p,
+                   const std::size_t k,
+                   const Eigen::Ref<const Eigen::VectorXd>& q) {
+                  crocoddyl::ActionModelLQR* m =
+                      static_cast<crocoddyl::ActionModelLQR*>(
+                          p->get_runningModels()[k].get());
+                  m->set_LQR(m->get_A(), m->get_B(), m->get_Q(), m->get_R(),
+                             m->get_N(), m->get_G(), m->get_H(), m->get_f(),
+                             q, m->get_r(), m->get_g(), m->get_h());
+                });
+  }
+  params.bindEnvironment(T, std::make_shared<EnvironmentModel>(5));
+  BOOST_CHECK(params.get_nbindings() == 2 * T + 1);
+
+  // Update the references of the whole horizon
+  MatrixXdRowMajor uref(T + 1, 2);
+  for (std::size_t t = 0; t <= T; ++t) {
+    uref.row(t) << static_cast<double>(t), -static_cast<double>(t);
+  }
+  params.set("uref", uref);
+  params.set("q", 2, Eigen::Vector3d(1., 2., 3.));
+  params.update();
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((residuals[t]->get_reference() - uref.row(t).transpose())
+                    .isZero(1e-9));
+  }
+  BOOST_CHECK((static_cast<crocoddyl::ActionModelLQR*>(models[2].get())
+                   ->get_q() -
+               Eigen::Vector3d(1., 2., 3.))
+                  .isZero(1e-9));
+  BOOST_CHECK(std::abs(problem->get_terminalData()->cost -
+                       (uref.row(T).sum() + 3.)) < 1e-9);
+  BOOST_CHECK((params.get("uref") - uref).isZero(1e-9));
+
+  // A single value is broadcast to all the nodes
+  params.set("uref", MatrixXdRowMajor::Ones(1, 2));
+  params.update();
+  BOOST_CHECK(residuals[T - 1]->get_reference().isOnes(1e-9));
+
+  // Wrong dimensions are detected
+  BOOST_CHECK_THROW(params.set("uref", MatrixXdRowMajor::Zero(3, 2)),
+                    crocoddyl::Exception);
+  BOOST_CHECK_THROW(params.bindReference("q", 0, residuals[0]),
+                    crocoddyl::Exception);
+  BOOST_CHECK_THROW(
+      params.bindEnvironment(0, std::make_shared<EnvironmentModel>(4)),
+      crocoddyl::Exception);
+  BOOST_CHECK_THROW(params.addParameter("x", Eigen::VectorXd::Ones(1)),
+                    crocoddyl::Exception);
+}
+
+void register_unit_tests() {
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_triple_buffer)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_problem_shift)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_solver_shift, crocoddyl::RepeatLast)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_solver_shift, crocoddyl::QuasiStatic)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_solver_shift, crocoddyl::TerminalRollout)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(
+      &test_solver_shift_node_buffers<
+          SolverBoxTest<crocoddyl::SolverBoxDDP> >)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(boost::bind(
+      &test_solver_shift_node_buffers<
+          SolverBoxTest<crocoddyl::SolverBoxFDDP> >)));
+  framework::master_test_suite().add(BOOST_TEST_CASE(
+      boost::bind(&test_solver_shift_node_buffers<SolverIntroTest>)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_real_time_iteration)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_step_publishes_policy)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_reference_interpolation)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_horizon_shift)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_horizon_builder)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_interpolate_trajectory)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_interpolated_warm_start)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_asynchronous_solve)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_problem_parameters)));
+}
+
+bool init_function() {
+  register_unit_tests();
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  return ::boost::unit_test::unit_test_main(&init_function, argc, argv);
+}
@@ -11,9 +11,11 @@
 
 #include "crocoddyl/core/integrator/euler.hpp"
 #include "crocoddyl/core/optctrl/shooting.hpp"
+#include "crocoddyl/multibody/utils/quadruped-gaits.hpp"
 #include "factory/action.hpp"
 #include "factory/diff_action.hpp"
 #include "factory/integrator.hpp"
+#include "factory/pinocchio_model.hpp"
 #include "unittest_common.hpp"
 
 using namespace boost::unit_test;
@@ -266,6 +268,73 @@ void test_calcDiff_diffAction(
   BOOST_CHECK((problem2.get_terminalData()->Lxx - data->Lxx).isZero(1e-7));
 }
 
+void test_calcAndDiff_against_calcDiff(
+    const std::shared_ptr<crocoddyl::ActionModelAbstract>& model) {
+  // create two shooting problems
+  std::size_t T = 20;
+  const Eigen::VectorXd& x0 = model->get_state()->rand();
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models(T,
+                                                                       model);
+  crocoddyl::ShootingProblem problem1(x0, models, model);
+  crocoddyl::ShootingProblem problem2(x0, models, model);
+
+  // create random trajectory
+  std::vector<Eigen::VectorXd> xs(T + 1);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t i = 0; i < T; ++i) {
+    xs[i] = model->get_state()->rand();
+    us[i] = Eigen::VectorXd::Random(model->get_nu());
+  }
+  xs.back() = model->get_state()->rand();
+
+  // check the cost, next state and derivatives in each node
+  const double cost1 = problem1.calc(xs, us);
+  problem1.calcDiff(xs, us);
+  const double cost2 = problem2.calcAndDiff(xs, us);
+  BOOST_CHECK(std::abs(cost1 - cost2) < 1e-9);
+  for (std::size_t i = 0; i < T; ++i) {
+    const std::shared_ptr<crocoddyl::ActionDataAbstract>& data1 =
+        problem1.get_runningDatas()[i];
+    const std::shared_ptr<crocoddyl::ActionDataAbstract>& data2 =
+        problem2.get_runningDatas()[i];
+    BOOST_CHECK((data1->xnext - data2->xnext).isZero(1e-9));
+    BOOST_CHECK((data1->Fx - data2->Fx).isZero(1e-9));
+    BOOST_CHECK((data1->Fu - data2->Fu).isZero(1e-9));
+    BOOST_CHECK((data1->Lx - data2->Lx).isZero(1e-9));
+    BOOST_CHECK((data1->Lu - data2->Lu).isZero(1e-9));
+    BOOST_CHECK((data1->Lxx - data2->Lxx).isZero(1e-9));
+    BOOST_CHECK((data1->Lxu - data2->Lxu).isZero(1e-9));
+    BOOST_CHECK((data1->Luu - data2->Luu).isZero(1e-9));
+  }
+  BOOST_CHECK(
+      (problem1.get_terminalData()->Lx - problem2.get_terminalData()->Lx)
+          .isZero(1e-9));
+  BOOST_CHECK(
+      (problem1.get_terminalData()->Lxx - problem2.get_terminalData()->Lxx)
+          .isZero(1e-9));
+}
+
+void test_calcAndDiff(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory.create(action_model_type);
+  test_calcAndDiff_against_calcDiff(model);
+}
+
+void test_calcAndDiff_diffAction(
+    DifferentialActionModelTypes::Type action_model_type,
+    IntegratorTypes::Type integrator_type) {
+  // create the model
+  DifferentialActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& diffModel =
+      factory.create(action_model_type);
+  IntegratorFactory factory_int;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory_int.create(integrator_type, diffModel);
+  test_calcAndDiff_against_calcDiff(model);
+}
+
 void test_rollout(ActionModelTypes::Type action_model_type) {
   // create the model
   ActionModelFactory factory;
@@ -335,6 +404,75 @@ void test_rollout_diffAction(
   }
 }
 
+void test_rollouts_against_rollout(
+    const std::shared_ptr<crocoddyl::ActionModelAbstract>& model) {
+  // create the shooting problem
+  std::size_t T = 20;
+  const Eigen::VectorXd& x0 = model->get_state()->rand();
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models(T,
+                                                                       model);
+  crocoddyl::ShootingProblem problem(x0, models, model);
+
+  // create a batch of random control sequences and initial states
+  const std::size_t K = 5;
+  std::vector<std::vector<Eigen::VectorXd> > uss(K);
+  std::vector<Eigen::VectorXd> x0s(K);
+  for (std::size_t k = 0; k < K; ++k) {
+    uss[k].resize(T);
+    for (std::size_t i = 0; i < T; ++i) {
+      uss[k][i] = Eigen::VectorXd::Random(model->get_nu());
+    }
+    x0s[k] = model->get_state()->rand();
+  }
+
+  // check the batch against the sequential rollouts
+  std::vector<std::vector<Eigen::VectorXd> > xss;
+  std::vector<double> costs;
+  problem.rollouts(uss, x0s, xss, costs);
+  BOOST_CHECK(xss.size() == K);
+  BOOST_CHECK(costs.size() == K);
+  std::vector<Eigen::VectorXd> xs(T + 1);
+  for (std::size_t k = 0; k < K; ++k) {
+    problem.set_x0(x0s[k]);
+    problem.rollout(uss[k], xs);
+    const double cost = problem.calc(xs, uss[k]);
+    for (std::size_t i = 0; i < T + 1; ++i) {
+      BOOST_CHECK((xss[k][i] - xs[i]).isZero(1e-7));
+    }
+    BOOST_CHECK(std::abs(costs[k] - cost) < 1e-7);
+  }
+
+  // check a single control sequence shared by the batch
+  problem.rollouts(std::vector<std::vector<Eigen::VectorXd> >(1, uss[0]),
+                   std::vector<Eigen::VectorXd>(), xss, costs);
+  BOOST_CHECK(xss.size() == 1);
+  problem.rollout(uss[0], xs);
+  for (std::size_t i = 0; i < T + 1; ++i) {
+    BOOST_CHECK((xss[0][i] - xs[i]).isZero(1e-7));
+  }
+}
+
+void test_rollouts(ActionModelTypes::Type action_model_type) {
+  // create the model
+  ActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory.create(action_model_type);
+  test_rollouts_against_rollout(model);
+}
+
+void test_rollouts_diffAction(
+    DifferentialActionModelTypes::Type action_model_type,
+    IntegratorTypes::Type integrator_type) {
+  // create the model
+  DifferentialActionModelFactory factory;
+  const std::shared_ptr<crocoddyl::DifferentialActionModelAbstract>& diffModel =
+      factory.create(action_model_type);
+  IntegratorFactory factory_int;
+  const std::shared_ptr<crocoddyl::ActionModelAbstract>& model =
+      factory_int.create(integrator_type, diffModel);
+  test_rollouts_against_rollout(model);
+}
+
 void test_quasiStatic(ActionModelTypes::Type action_model_type) {
   // create the model
   ActionModelFactory factory;
@@ -436,6 +574,66 @@ void test_quasiStatic_diffAction(
 
 //----------------------------------------------------------------------------//
 
+void test_update_walking_problem() {
+  const std::shared_ptr<pinocchio::Model> model =
+      PinocchioModelFactory(PinocchioModelTypes::HyQ).create();
+  crocoddyl::SimpleQuadrupedGaitProblem gait(*model, "lf_foot", "rf_foot",
+                                             "lh_foot", "rh_foot");
+  const Eigen::VectorXd& x0 = gait.get_defaultState();
+  const double step_height = 0.15, timestep = 1e-2;
+  const std::size_t step_knots = 10, support_knots = 2;
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      gait.createWalkingProblem(x0, 0.25, step_height, timestep, step_knots,
+                                support_knots);
+  const std::size_t T = problem->get_T();
+
+  // The first update replaces the nodes by the pooled models
+  gait.updateWalkingProblem(problem, x0, 0.25, step_height, timestep,
+                            step_knots, support_knots);
+  const std::size_t npooled = gait.get_npooledModels();
+  const std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models =
+      problem->get_runningModels();
+  const std::vector<std::shared_ptr<crocoddyl::ActionDataAbstract> > datas =
+      problem->get_runningDatas();
+  const std::shared_ptr<crocoddyl::ActionDataAbstract> terminal_data =
+      problem->get_terminalData();
+
+  // Replanning another step length reuses the pooled models and datas
+  const double step_length = 0.1;
+  gait.updateWalkingProblem(problem, x0, step_length, step_height, timestep,
+                            step_knots, support_knots);
+  BOOST_CHECK_EQUAL(gait.get_npooledModels(), npooled);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK(problem->get_runningModels()[t] == models[t]);
+    BOOST_CHECK(problem->get_runningDatas()[t] == datas[t]);
+  }
+  BOOST_CHECK(problem->get_terminalData() == terminal_data);
+
+  // The references of the pooled models match a new walking problem
+  std::shared_ptr<crocoddyl::ShootingProblem> expected =
+      gait.createWalkingProblem(x0, step_length, step_height, timestep,
+                                step_knots, support_knots);
+  const std::shared_ptr<crocoddyl::StateAbstract>& state =
+      problem->get_terminalModel()->get_state();
+  std::vector<Eigen::VectorXd> xs(T + 1);
+  std::vector<Eigen::VectorXd> us(T);
+  for (std::size_t t = 0; t < T; ++t) {
+    xs[t] = state->rand();
+    us[t] = Eigen::VectorXd::Random(problem->get_runningModels()[t]->get_nu());
+  }
+  xs.back() = state->rand();
+  problem->calc(xs, us);
+  expected->calc(xs, us);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK(std::abs(problem->get_runningDatas()[t]->cost -
+                         expected->get_runningDatas()[t]->cost) < 1e-9);
+  }
+  BOOST_CHECK(std::abs(problem->get_terminalData()->cost -
+                       expected->get_terminalData()->cost) < 1e-9);
+}
+
+//----------------------------------------------------------------------------//
+
 void register_action_model_unit_tests(
     ActionModelTypes::Type action_model_type) {
   boost::test_tools::output_test_stream test_name;
@@ -444,8 +642,10 @@ void register_action_model_unit_tests(
   test_suite* ts = BOOST_TEST_SUITE(test_name.str());
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calc, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calcDiff, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_calcAndDiff, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasiStatic, action_model_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_rollout, action_model_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_rollouts, action_model_type)));
   framework::master_test_suite().add(ts);
 }
 
@@ -460,10 +660,23 @@ void register_diff_action_model_unit_tests(
       boost::bind(&test_calc_diffAction, action_model_type, integrator_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_calcDiff_diffAction,
                                       action_model_type, integrator_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_calcAndDiff_diffAction,
+                                      action_model_type, integrator_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_quasiStatic_diffAction,
                                       action_model_type, integrator_type)));
   ts->add(BOOST_TEST_CASE(boost::bind(&test_rollout_diffAction,
                                       action_model_type, integrator_type)));
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_rollouts_diffAction,
+                                      action_model_type, integrator_type)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_quadruped_gait_unit_tests() {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_SimpleQuadrupedGaitProblem";
+  std::cout << "Running " << test_name.str() << std::endl;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_update_walking_problem)));
   framework::master_test_suite().add(ts);
 }
 
@@ -477,6 +690,7 @@ bool init_function() {
           DifferentialActionModelTypes::all[i], IntegratorTypes::all[j]);
     }
   }
+  register_quadruped_gait_unit_tests();
   return true;
 }
 
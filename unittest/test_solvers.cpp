@@ -11,7 +11,20 @@
 #define BOOST_TEST_NO_MAIN
 #define BOOST_TEST_ALTERNATIVE_INIT_API
 
+#include <cstdio>
+#include <limits>
+
+#include "crocoddyl/core/utils/binary-log.hpp"
+#include "crocoddyl/core/solvers/box-ddp.hpp"
+#include "crocoddyl/core/solvers/box-fddp.hpp"
+#include "crocoddyl/core/solvers/fddp.hpp"
+#include "crocoddyl/core/solvers/intro.hpp"
+#include "crocoddyl/core/solvers/mppi.hpp"
+#include "crocoddyl/core/actions/lqr.hpp"
 #include "crocoddyl/core/utils/callbacks.hpp"
+#include "crocoddyl/core/utils/snapshot.hpp"
+#include "crocoddyl/core/utils/sensitivity.hpp"
+#include "crocoddyl/core/utils/solver-pool.hpp"
 #include "factory/solver.hpp"
 #include "unittest_common.hpp"
 
@@ -173,6 +186,551 @@ void test_solver_against_kkt_solver(SolverTypes::Type solver_type,
 
 //____________________________________________________________________________//
 
+void test_solver_time_budget(SolverTypes::Type solver_type,
+                             ActionModelTypes::Type action_type, size_t T) {
+  // Create action models
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model2 =
+      ActionModelFactory().create(action_type, ActionModelFactory::Second);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+
+  // Create the solvers
+  SolverFactory solver_factory;
+  std::shared_ptr<crocoddyl::SolverAbstract> solver =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  std::shared_ptr<crocoddyl::SolverAbstract> solver_budget =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  BOOST_CHECK(std::isinf(solver->get_time_budget()));
+  BOOST_CHECK_THROW(solver->set_time_budget(0.), std::exception);
+
+  // A budget that is already exhausted returns the initial guess
+  const std::vector<Eigen::VectorXd> xs = solver->get_xs();
+  const std::vector<Eigen::VectorXd> us = solver->get_us();
+  solver_budget->set_time_budget(1e-12);
+  BOOST_CHECK(!solver_budget->solve(xs, us, 100));
+  BOOST_CHECK(solver_budget->get_deadline_status() ==
+              crocoddyl::DeadlineIteration);
+  BOOST_CHECK(solver_budget->get_iter() == 0);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((solver_budget->get_us()[t] - us[t]).isZero(1e-9));
+  }
+
+  // A large budget does not change the solution
+  solver->solve(xs, us, 100);
+  solver_budget->set_time_budget(1e3);
+  solver_budget->solve(xs, us, 100);
+  BOOST_CHECK(solver_budget->get_deadline_status() == crocoddyl::DeadlineNone);
+  BOOST_CHECK_EQUAL(solver_budget->get_iter(), solver->get_iter());
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK(
+        (solver_budget->get_us()[t] - solver->get_us()[t]).isZero(1e-9));
+  }
+}
+
+//____________________________________________________________________________//
+
+void test_solver_iteration_stats(SolverTypes::Type solver_type,
+                                 ActionModelTypes::Type action_type, size_t T) {
+  // Create action models
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model2 =
+      ActionModelFactory().create(action_type, ActionModelFactory::Second);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+
+  // Create the solver
+  SolverFactory solver_factory;
+  std::shared_ptr<crocoddyl::SolverAbstract> solver =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  BOOST_CHECK_EQUAL(solver->get_stats_capacity(), 100);
+  BOOST_CHECK_EQUAL(solver->get_nstats(), 0);
+
+  // Each iteration is recorded, including the one that converges
+  const std::vector<Eigen::VectorXd> xs = solver->get_xs();
+  const std::vector<Eigen::VectorXd> us = solver->get_us();
+  const bool converged = solver->solve(xs, us, 100);
+  const std::size_t nstats = solver->get_nstats();
+  BOOST_CHECK_EQUAL(nstats, solver->get_iter() + (converged ? 1 : 0));
+  for (std::size_t i = 0; i < nstats; ++i) {
+    const crocoddyl::SolverIterationStats& stats = solver->get_stats(i);
+    BOOST_CHECK_EQUAL(stats.solve, solver->get_stats(0).solve);
+    BOOST_CHECK_EQUAL(stats.iter, i);
+    BOOST_CHECK(!stats.trial_times.empty());
+    double phases_time = stats.calc_time + stats.backward_time;
+    for (std::size_t j = 0; j < stats.trial_times.size(); ++j) {
+      BOOST_CHECK(stats.trial_times[j] >= 0.);
+      phases_time += stats.trial_times[j];
+    }
+    BOOST_CHECK(stats.calc_time >= 0.);
+    BOOST_CHECK(stats.backward_time > 0.);
+    BOOST_CHECK(phases_time <= stats.iteration_time + 1e-12);
+    BOOST_CHECK(stats.deadline_status == crocoddyl::DeadlineNone);
+  }
+  // Copy the stats, as resizing the ring buffer invalidates its elements
+  const crocoddyl::SolverIterationStats last = solver->get_stats(nstats - 1);
+  BOOST_CHECK_EQUAL(last.cost, solver->get_cost());
+  BOOST_CHECK_EQUAL(last.stop, solver->get_stop());
+  BOOST_CHECK_EQUAL(last.steplength, solver->get_steplength());
+  BOOST_CHECK_THROW(solver->get_stats(nstats), std::exception);
+
+  // The ring buffer keeps the latest iterations
+  solver->set_stats_capacity(1);
+  BOOST_CHECK_EQUAL(solver->get_nstats(), 0);
+  solver->solve(xs, us, 100);
+  BOOST_CHECK_EQUAL(solver->get_nstats(), 1);
+  BOOST_CHECK_EQUAL(solver->get_stats(0).solve, last.solve + 1);
+  BOOST_CHECK_EQUAL(solver->get_stats(0).cost, solver->get_cost());
+  solver->clearStats();
+  BOOST_CHECK_EQUAL(solver->get_nstats(), 0);
+
+  // A zero capacity disables the recording
+  solver->set_stats_capacity(0);
+  solver->solve(xs, us, 100);
+  BOOST_CHECK_EQUAL(solver->get_nstats(), 0);
+}
+
+//____________________________________________________________________________//
+
+void test_solver_binary_log(SolverTypes::Type solver_type,
+                            ActionModelTypes::Type action_type, size_t T) {
+  // Create action models
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model2 =
+      ActionModelFactory().create(action_type, ActionModelFactory::Second);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+
+  // Create the solver and the logger, whose queue cannot be full as it is
+  // larger than the number of iterations
+  SolverFactory solver_factory;
+  std::shared_ptr<crocoddyl::SolverAbstract> solver =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  boost::test_tools::output_test_stream filename;
+  filename << "test_" << solver_type << "_binary_log_" << action_type
+           << ".log";
+  std::remove(filename.str().c_str());
+  std::shared_ptr<crocoddyl::CallbackBinaryLogger> logger =
+      std::make_shared<crocoddyl::CallbackBinaryLogger>(filename.str(), 128);
+  std::vector<std::shared_ptr<crocoddyl::CallbackAbstract> > callbacks;
+  callbacks.push_back(logger);
+  solver->setCallbacks(callbacks);
+  solver->solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 100);
+  logger->flush();
+  const std::size_t nrecords = logger->get_nrecords();
+  BOOST_CHECK(nrecords > 0);
+  BOOST_CHECK_EQUAL(logger->get_ndropped(), 0);
+
+  // The last record contains the solver iterate
+  crocoddyl::BinaryLogReader reader(filename.str());
+  BOOST_CHECK_EQUAL(reader.get_nrecords(), nrecords);
+  crocoddyl::BinaryLogRecord record = reader.read(nrecords - 1);
+  BOOST_CHECK_EQUAL(record.sequence, nrecords - 1);
+  BOOST_CHECK_EQUAL(record.iter, solver->get_iter());
+  BOOST_CHECK_EQUAL(record.cost, solver->get_cost());
+  BOOST_CHECK_EQUAL(record.xs.size(), T + 1);
+  BOOST_CHECK_EQUAL(record.us.size(), T);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((record.xs[t] - solver->get_xs()[t]).isZero(0.));
+    BOOST_CHECK((record.us[t] - solver->get_us()[t]).isZero(0.));
+  }
+  crocoddyl::SolverDDP* ddp =
+      dynamic_cast<crocoddyl::SolverDDP*>(solver.get());
+  if (ddp != NULL) {
+    BOOST_CHECK_EQUAL(record.Ks.size(), T);
+    for (std::size_t t = 0; t < T; ++t) {
+      BOOST_CHECK((record.Ks[t] - ddp->get_K()[t]).isZero(0.));
+    }
+  }
+  BOOST_CHECK_THROW(reader.read(nrecords), std::exception);
+
+  // A new logger appends its records, and a truncated record is ignored
+  callbacks.clear();
+  solver->setCallbacks(callbacks);
+  logger.reset();
+  std::FILE* file = std::fopen(filename.str().c_str(), "ab");
+  std::fwrite(&nrecords, sizeof(nrecords), 1, file);
+  std::fclose(file);
+  reader.reload();
+  BOOST_CHECK_EQUAL(reader.get_nrecords(), nrecords);
+  {
+    crocoddyl::CallbackBinaryLogger appender(filename.str(), 8, false);
+    appender(*solver.get());
+    appender.flush();
+  }
+  reader.reload();
+  BOOST_CHECK_EQUAL(reader.get_nrecords(), nrecords + 1);
+  reader.read(nrecords, record);
+  BOOST_CHECK_EQUAL(record.sequence, 0);
+  BOOST_CHECK(record.Ks.empty());
+  std::remove(filename.str().c_str());
+
+  // The written and dropped records add up to the logged iterations, even if
+  // the queue is full
+  {
+    crocoddyl::CallbackBinaryLogger small_logger(filename.str(), 1, false);
+    for (std::size_t i = 0; i < 50; ++i) {
+      small_logger(*solver.get());
+    }
+    small_logger.flush();
+    BOOST_CHECK_EQUAL(
+        small_logger.get_nrecords() + small_logger.get_ndropped(), 50);
+    reader.reload();
+    BOOST_CHECK_EQUAL(reader.get_nrecords(), small_logger.get_nrecords());
+  }
+  std::remove(filename.str().c_str());
+}
+
+//____________________________________________________________________________//
+
+void test_solver_snapshot(SolverTypes::Type solver_type,
+                          ActionModelTypes::Type action_type, size_t T) {
+  // Create action models
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model2 =
+      ActionModelFactory().create(action_type, ActionModelFactory::Second);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+
+  // Save the snapshot of a solved problem
+  SolverFactory solver_factory;
+  std::shared_ptr<crocoddyl::SolverAbstract> solver =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  solver->solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 5);
+  boost::test_tools::output_test_stream filename;
+  filename << "test_" << solver_type << "_snapshot_" << action_type
+           << ".snapshot";
+  crocoddyl::saveSnapshot(filename.str(), *solver.get());
+
+  // The reader returns the saved values
+  crocoddyl::SnapshotReader reader(filename.str());
+  const std::shared_ptr<crocoddyl::ShootingProblem>& problem =
+      solver->get_problem();
+  crocoddyl::SolverDDP* ddp =
+      dynamic_cast<crocoddyl::SolverDDP*>(solver.get());
+  BOOST_CHECK_EQUAL(reader.get_T(), T);
+  BOOST_CHECK_EQUAL(reader.get_header().iter, solver->get_iter());
+  BOOST_CHECK_EQUAL(reader.get_header().cost, solver->get_cost());
+  BOOST_CHECK_EQUAL(reader.get_is_feasible(), solver->get_is_feasible());
+  BOOST_CHECK_EQUAL(reader.get_has_gains(), ddp != NULL);
+  BOOST_CHECK((reader.get_x0() - problem->get_x0()).isZero(0.));
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((reader.get_x(t) - solver->get_xs()[t]).isZero(0.));
+    BOOST_CHECK((reader.get_u(t) - solver->get_us()[t]).isZero(0.));
+    if (ddp != NULL) {
+      BOOST_CHECK((reader.get_K(t) - ddp->get_K()[t]).isZero(0.));
+      BOOST_CHECK((reader.get_k(t) - ddp->get_k()[t]).isZero(0.));
+    }
+  }
+  BOOST_CHECK((reader.get_x(T) - solver->get_xs()[T]).isZero(0.));
+  BOOST_CHECK_THROW(reader.get_u(T), std::exception);
+
+  // The snapshot is restored in a solver of an equivalent problem
+  std::shared_ptr<crocoddyl::SolverAbstract> restored =
+      solver_factory.create(solver_type, model, model2, modelT, T);
+  BOOST_CHECK(reader.is_compatible(*restored->get_problem()));
+  reader.restore(*restored.get());
+  BOOST_CHECK((restored->get_problem()->get_x0() - problem->get_x0())
+                  .isZero(0.));
+  BOOST_CHECK_EQUAL(restored->get_is_feasible(), solver->get_is_feasible());
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((restored->get_xs()[t] - solver->get_xs()[t]).isZero(0.));
+    BOOST_CHECK((restored->get_us()[t] - solver->get_us()[t]).isZero(0.));
+    if (ddp != NULL) {
+      crocoddyl::SolverDDP* restored_ddp =
+          dynamic_cast<crocoddyl::SolverDDP*>(restored.get());
+      BOOST_CHECK((restored_ddp->get_K()[t] - ddp->get_K()[t]).isZero(0.));
+      BOOST_CHECK((restored_ddp->get_k()[t] - ddp->get_k()[t]).isZero(0.));
+    }
+  }
+
+  // A problem with a different horizon is not compatible
+  std::shared_ptr<crocoddyl::SolverAbstract> other =
+      solver_factory.create(solver_type, model, model2, modelT, T + 1);
+  BOOST_CHECK(!reader.is_compatible(*other->get_problem()));
+  BOOST_CHECK_THROW(reader.restore(*other.get()), std::exception);
+  std::remove(filename.str().c_str());
+}
+
+//____________________________________________________________________________//
+
+void test_mppi_solver(ActionModelTypes::Type action_type, size_t T) {
+  // Create the shooting problem
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(
+          model->get_state()->rand(),
+          std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >(T,
+                                                                       model),
+          modelT);
+  BOOST_CHECK_THROW(crocoddyl::SolverMPPI(problem, 0), std::exception);
+  BOOST_CHECK_THROW(crocoddyl::SolverMPPI(problem, 8, -1.), std::exception);
+  BOOST_CHECK_THROW(crocoddyl::SolverMPPI(problem, 8, 0.1, 0.),
+                    std::exception);
+
+  // The cost of the initial guess never increases
+  crocoddyl::SolverMPPI mppi(problem, 64, 0.1, 1., 7);
+  mppi.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 0);
+  const double cost0 = mppi.get_cost();
+  mppi.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 10);
+  BOOST_CHECK(mppi.get_cost() <= cost0);
+  BOOST_CHECK(mppi.get_is_feasible());
+  BOOST_CHECK_EQUAL(mppi.get_us_samples().size(), 64);
+  BOOST_CHECK_EQUAL(mppi.get_costs().size(), 64);
+  double weight_sum = 0.;
+  for (std::size_t k = 0; k < mppi.get_weights().size(); ++k) {
+    weight_sum += mppi.get_weights()[k];
+  }
+  BOOST_CHECK_CLOSE(weight_sum, 1., 1e-9);
+
+  // The state trajectory is the rollout of the control sequence
+  std::vector<Eigen::VectorXd> xs = mppi.get_xs();
+  problem->rollout(mppi.get_us(), xs);
+  for (std::size_t t = 0; t < T + 1; ++t) {
+    BOOST_CHECK((xs[t] - mppi.get_xs()[t]).isZero(1e-9));
+  }
+
+  // The samples are reproducible from the seed
+  crocoddyl::SolverMPPI mppi2(problem, 64, 0.1, 1., 7);
+  mppi2.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 10);
+  BOOST_CHECK_EQUAL(mppi2.get_cost(), mppi.get_cost());
+
+  // Its solution warm-starts a derivative-based solver
+  crocoddyl::SolverFDDP fddp(problem);
+  crocoddyl::SolverFDDP fddp_cold(problem);
+  fddp.solve(mppi.get_xs(), mppi.get_us(), 100, true);
+  fddp_cold.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR, 100);
+  BOOST_CHECK_CLOSE(fddp.get_cost(), fddp_cold.get_cost(), 1e-4);
+}
+
+//____________________________________________________________________________//
+
+class ActionModelDivergingLQR : public crocoddyl::ActionModelLQR {
+ public:
+  ActionModelDivergingLQR() : crocoddyl::ActionModelLQR(2, 2) {}
+
+  using crocoddyl::ActionModelLQR::calc;
+  virtual void calc(const std::shared_ptr<crocoddyl::ActionDataAbstract>& data,
+                    const Eigen::Ref<const Eigen::VectorXd>& x,
+                    const Eigen::Ref<const Eigen::VectorXd>& u) {
+    crocoddyl::ActionModelLQR::calc(data, x, u);
+    // Any perturbation of the (zero) nominal controls diverges
+    if (!u.isZero()) {
+      data->cost = std::numeric_limits<double>::infinity();
+    }
+  }
+};
+
+void test_mppi_solver_diverged_samples(size_t T) {
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      std::make_shared<ActionModelDivergingLQR>();
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(
+          model->get_state()->rand(),
+          std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> >(T,
+                                                                       model),
+          model);
+  crocoddyl::SolverMPPI mppi(problem, 16, 0.1, 1., 7);
+  BOOST_CHECK_THROW(mppi.computeDirection(), std::exception);
+
+  // Every iteration fails, so the solver never reports convergence and it
+  // keeps the initial guess
+  const std::size_t maxiter = 5;
+  BOOST_CHECK(!mppi.solve(crocoddyl::DEFAULT_VECTOR, crocoddyl::DEFAULT_VECTOR,
+                          maxiter));
+  BOOST_CHECK(std::isinf(mppi.get_stop()));
+  BOOST_CHECK(std::isfinite(mppi.get_cost()));
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK(mppi.get_us()[t].isZero());
+  }
+  BOOST_CHECK_EQUAL(mppi.get_nstats(), maxiter);
+}
+
+//____________________________________________________________________________//
+
+void test_solver_pool(ActionModelTypes::Type action_type, size_t T) {
+  // Create a batch of problems with different initial states
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model =
+      ActionModelFactory().create(action_type);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> model2 =
+      ActionModelFactory().create(action_type, ActionModelFactory::Second);
+  std::shared_ptr<crocoddyl::ActionModelAbstract> modelT =
+      ActionModelFactory().create(action_type, ActionModelFactory::Terminal);
+  const std::size_t K = 6;
+  std::vector<std::shared_ptr<crocoddyl::ShootingProblem> > problems;
+  for (std::size_t k = 0; k < K; ++k) {
+    std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models(
+        T, k % 2 == 0 ? model : model2);
+    problems.push_back(std::make_shared<crocoddyl::ShootingProblem>(
+        model->get_state()->rand(), models, modelT));
+  }
+
+  // The pool gives the solutions of the solvers run one at a time
+  crocoddyl::SolverPool pool(
+      [](std::shared_ptr<crocoddyl::ShootingProblem> problem) {
+        return std::make_shared<crocoddyl::SolverDDP>(problem);
+      },
+      3);
+  pool.solve(problems);
+  const std::size_t nsolvers = pool.get_nsolvers();
+  pool.solve(problems);
+  BOOST_CHECK_EQUAL(pool.get_nsolvers(), nsolvers);
+  BOOST_CHECK_EQUAL(pool.get_results().size(), K);
+  for (std::size_t k = 0; k < K; ++k) {
+    crocoddyl::SolverDDP solver(problems[k]);
+    const bool converged = solver.solve();
+    const crocoddyl::SolverPoolResult& result = pool.get_results()[k];
+    BOOST_CHECK_EQUAL(result.converged, converged);
+    BOOST_CHECK_EQUAL(result.iter, solver.get_iter());
+    BOOST_CHECK_CLOSE(result.cost, solver.get_cost(), 1e-7);
+    BOOST_CHECK(result.worker < pool.get_nworkers());
+    for (std::size_t t = 0; t < T; ++t) {
+      BOOST_CHECK((result.us[t] - solver.get_us()[t]).isZero(1e-9));
+    }
+  }
+
+  // A single problem is shared by the initial guesses
+  std::vector<std::vector<Eigen::VectorXd> > init_us(K);
+  for (std::size_t k = 0; k < K; ++k) {
+    init_us[k] = std::vector<Eigen::VectorXd>(
+        T, Eigen::VectorXd::Random(model->get_nu()));
+  }
+  pool.solve(std::vector<std::shared_ptr<crocoddyl::ShootingProblem> >(
+                 1, problems[0]),
+             std::vector<std::vector<Eigen::VectorXd> >(), init_us);
+  BOOST_CHECK_EQUAL(pool.get_nsolvers(), nsolvers);
+  for (std::size_t k = 0; k < K; ++k) {
+    crocoddyl::SolverDDP solver(problems[0]);
+    solver.solve(crocoddyl::DEFAULT_VECTOR, init_us[k]);
+    BOOST_CHECK_CLOSE(pool.get_results()[k].cost, solver.get_cost(), 1e-7);
+  }
+
+  // The batch sizes have to be consistent
+  BOOST_CHECK_THROW(
+      pool.solve(std::vector<std::shared_ptr<crocoddyl::ShootingProblem> >()),
+      std::exception);
+  BOOST_CHECK_THROW(
+      pool.solve(std::vector<std::shared_ptr<crocoddyl::ShootingProblem> >(
+                     2, problems[0]),
+                 std::vector<std::vector<Eigen::VectorXd> >(), init_us),
+      std::exception);
+}
+
+//____________________________________________________________________________//
+
+void test_solution_sensitivity(size_t T) {
+  // Create a LQR problem whose cost gradients are parameters
+  const std::size_t nx = 4, nu = 2;
+  std::vector<std::shared_ptr<crocoddyl::ActionModelAbstract> > models;
+  for (std::size_t t = 0; t < T; ++t) {
+    models.push_back(std::make_shared<crocoddyl::ActionModelLQR>(
+        crocoddyl::ActionModelLQR::Random(nx, nu)));
+  }
+  std::shared_ptr<crocoddyl::ShootingProblem> problem =
+      std::make_shared<crocoddyl::ShootingProblem>(
+          Eigen::VectorXd::Random(nx), models,
+          std::make_shared<crocoddyl::ActionModelLQR>(
+              crocoddyl::ActionModelLQR::Random(nx, nu)));
+  std::shared_ptr<crocoddyl::ProblemParameters> params =
+      std::make_shared<crocoddyl::ProblemParameters>(problem);
+  params->addParameter("q", Eigen::VectorXd::Zero(nx));
+  for (std::size_t t = 0; t <= T; ++t) {
+    params->bind("q", t,
+                 [](const std::shared_ptr<crocoddyl::ShootingProblem>& p,
+                    const std::size_t k,
+                    const Eigen::Ref<const Eigen::VectorXd>& q) {
+                   crocoddyl::ActionModelLQR* m =
+                       static_cast<crocoddyl::ActionModelLQR*>(
+                           k < p->get_T() ? p->get_runningModels()[k].get()
+                                          : p->get_terminalModel().get());
+                   m->set_LQR(m->get_A(), m->get_B(), m->get_Q(), m->get_R(),
+                              m->get_N(), m->get_G(), m->get_H(), m->get_f(),
+                              q, m->get_r(), m->get_g(), m->get_h());
+                 });
+  }
+  params->update();
+
+  // Compute the sensitivities of the solution
+  std::shared_ptr<crocoddyl::SolverDDP> solver =
+      std::make_shared<crocoddyl::SolverDDP>(problem);
+  solver->solve();
+  crocoddyl::SolutionSensitivity sensitivity(solver, params);
+  sensitivity.compute();
+  BOOST_CHECK_EQUAL(sensitivity.get_dxs_dx0().size(), T + 1);
+  BOOST_CHECK_EQUAL(sensitivity.get_dus_dp().size(), T);
+
+  // The sensitivities match the finite differences of the solutions, as the
+  // problem is linear-quadratic
+  const double h = 1e-4;
+  const double tol = 1e-5;
+  const std::vector<Eigen::VectorXd> xs = solver->get_xs();
+  const std::vector<Eigen::VectorXd> us = solver->get_us();
+  for (std::size_t i = 0; i < nx; ++i) {
+    crocoddyl::SolverDDP solver_h(std::make_shared<crocoddyl::ShootingProblem>(
+        problem->get_x0() + h * Eigen::VectorXd::Unit(nx, i), models,
+        problem->get_terminalModel()));
+    solver_h.solve();
+    for (std::size_t t = 0; t < T; ++t) {
+      BOOST_CHECK(((solver_h.get_xs()[t] - xs[t]) / h -
+                   sensitivity.get_dxs_dx0()[t].col(i))
+                      .isZero(tol));
+      BOOST_CHECK(((solver_h.get_us()[t] - us[t]) / h -
+                   sensitivity.get_dus_dx0()[t].col(i))
+                      .isZero(tol));
+    }
+  }
+  const crocoddyl::ProblemParameters::MatrixXdRowMajor values =
+      params->get_values();
+  for (std::size_t j = 0; j < nx; ++j) {
+    crocoddyl::ProblemParameters::MatrixXdRowMajor values_h = values;
+    values_h.col(j).array() += h;
+    params->set_values(values_h);
+    params->update();
+    crocoddyl::SolverDDP solver_h(problem);
+    solver_h.solve();
+    for (std::size_t t = 0; t < T; ++t) {
+      BOOST_CHECK(((solver_h.get_xs()[t + 1] - xs[t + 1]) / h -
+                   sensitivity.get_dxs_dp()[t + 1].col(j))
+                      .isZero(tol));
+      BOOST_CHECK(((solver_h.get_us()[t] - us[t]) / h -
+                   sensitivity.get_dus_dp()[t].col(j))
+                      .isZero(tol));
+    }
+  }
+  params->set_values(values);
+  params->update();
+
+  // The factorization at the solution gives the same sensitivities
+  const std::vector<Eigen::MatrixXd> dus_dp = sensitivity.get_dus_dp();
+  sensitivity.compute(true);
+  for (std::size_t t = 0; t < T; ++t) {
+    BOOST_CHECK((sensitivity.get_dus_dp()[t] - dus_dp[t]).isZero(1e-7));
+  }
+
+  // The box and intro solvers are not supported, as their gains are not the
+  // ones of the unconstrained Quu
+  BOOST_CHECK_THROW(crocoddyl::SolutionSensitivity(
+                        std::make_shared<crocoddyl::SolverBoxDDP>(problem)),
+                    std::exception);
+  BOOST_CHECK_THROW(crocoddyl::SolutionSensitivity(
+                        std::make_shared<crocoddyl::SolverBoxFDDP>(problem)),
+                    std::exception);
+  BOOST_CHECK_THROW(crocoddyl::SolutionSensitivity(
+                        std::make_shared<crocoddyl::SolverIntro>(problem)),
+                    std::exception);
+  BOOST_CHECK_NO_THROW(crocoddyl::SolutionSensitivity(
+      std::make_shared<crocoddyl::SolverFDDP>(problem)));
+}
+
+//____________________________________________________________________________//
+
 void register_kkt_solver_unit_tests(ActionModelTypes::Type action_type,
                                     const std::size_t T) {
   boost::test_tools::output_test_stream test_name;
@@ -197,6 +755,94 @@ void register_solvers_againt_kkt_unit_tests(SolverTypes::Type solver_type,
   framework::master_test_suite().add(ts);
 }
 
+void register_solver_time_budget_unit_tests(SolverTypes::Type solver_type,
+                                            ActionModelTypes::Type action_type,
+                                            const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_" << solver_type << "_time_budget_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_solver_time_budget, solver_type,
+                                      action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_solver_iteration_stats_unit_tests(
+    SolverTypes::Type solver_type, ActionModelTypes::Type action_type,
+    const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_" << solver_type << "_iteration_stats_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_solver_iteration_stats,
+                                      solver_type, action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_solver_binary_log_unit_tests(SolverTypes::Type solver_type,
+                                           ActionModelTypes::Type action_type,
+                                           const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_" << solver_type << "_binary_log_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_solver_binary_log, solver_type,
+                                      action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_solver_snapshot_unit_tests(SolverTypes::Type solver_type,
+                                         ActionModelTypes::Type action_type,
+                                         const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_" << solver_type << "_snapshot_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(
+      boost::bind(&test_solver_snapshot, solver_type, action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_mppi_solver_unit_tests(ActionModelTypes::Type action_type,
+                                     const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_SolverMPPI_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_mppi_solver, action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_mppi_solver_diverged_samples_unit_tests(const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_SolverMPPI_diverged_samples";
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_mppi_solver_diverged_samples, T)));
+  framework::master_test_suite().add(ts);
+}
+
+void register_solver_pool_unit_tests(ActionModelTypes::Type action_type,
+                                     const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_SolverPool_" << action_type;
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_solver_pool, action_type, T)));
+  framework::master_test_suite().add(ts);
+}
+
+//____________________________________________________________________________//
+
+void register_solution_sensitivity_unit_tests(const std::size_t T) {
+  boost::test_tools::output_test_stream test_name;
+  test_name << "test_SolutionSensitivity";
+  test_suite* ts = BOOST_TEST_SUITE(test_name.str());
+  std::cout << "Running " << test_name.str() << std::endl;
+  ts->add(BOOST_TEST_CASE(boost::bind(&test_solution_sensitivity, T)));
+  framework::master_test_suite().add(ts);
+}
+
 //____________________________________________________________________________//
 
 bool init_function() {
@@ -214,6 +860,32 @@ bool init_function() {
                                              ActionModelTypes::all[i], T);
     }
   }
+
+  // The time budget and the iteration statistics are only handled by the
+  // DDP-based solvers
+  for (size_t s = 0; s < SolverTypes::all.size(); ++s) {
+    if (SolverTypes::all[s] == SolverTypes::SolverKKT ||
+        SolverTypes::all[s] == SolverTypes::SolverIpopt) {
+      continue;
+    }
+    register_solver_time_budget_unit_tests(
+        SolverTypes::all[s], ActionModelTypes::ActionModelLQR, T);
+    register_solver_iteration_stats_unit_tests(
+        SolverTypes::all[s], ActionModelTypes::ActionModelLQR, T);
+  }
+  register_solver_binary_log_unit_tests(
+      SolverTypes::SolverFDDP, ActionModelTypes::ActionModelLQR, T);
+  register_solver_snapshot_unit_tests(
+      SolverTypes::SolverFDDP, ActionModelTypes::ActionModelUnicycle, T);
+  register_solver_snapshot_unit_tests(
+      SolverTypes::SolverDDP,
+      ActionModelTypes::ActionModelImpulseFwdDynamics_HyQ, T);
+  register_mppi_solver_unit_tests(ActionModelTypes::ActionModelUnicycle, T);
+  register_mppi_solver_unit_tests(ActionModelTypes::ActionModelLQR, T);
+  register_mppi_solver_diverged_samples_unit_tests(T);
+  register_solver_pool_unit_tests(ActionModelTypes::ActionModelUnicycle, T);
+  register_solver_pool_unit_tests(ActionModelTypes::ActionModelLQR, T);
+  register_solution_sensitivity_unit_tests(T);
   return true;
 }
 
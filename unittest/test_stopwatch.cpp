@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (C) 2025, Heriot-Watt University
+// Copyright note valid unless otherwise stated in individual files.
+// All rights reserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include "crocoddyl/core/utils/stop-watch.hpp"
+#include "unittest_common.hpp"
+
+using namespace boost::unit_test;
+using namespace crocoddyl::unittest;
+
+void busy_wait(const std::uint64_t ns) {
+  const std::uint64_t start = crocoddyl::Stopwatch::take_time_ns();
+  while (crocoddyl::Stopwatch::take_time_ns() - start < ns) {
+  }
+}
+
+void test_concurrent_regions() {
+  crocoddyl::Stopwatch& profiler = crocoddyl::getProfiler();
+  profiler.enable_profiler();
+  const int N = 200;
+#ifdef CROCODDYL_WITH_MULTITHREADING
+#pragma omp parallel for num_threads(CROCODDYL_WITH_NTHREADS)
+#endif
+  for (int i = 0; i < N; ++i) {
+    // The trace capacity can be changed while other threads record events
+    if (i % 20 == 0) {
+      profiler.enable_trace(8 + i % 40);
+    }
+    START_PROFILER("test_stopwatch::concurrent_outer");
+    for (std::size_t j = 0; j < 2; ++j) {
+      START_PROFILER("test_stopwatch::concurrent_inner");
+      busy_wait(1000);
+      STOP_PROFILER("test_stopwatch::concurrent_inner");
+    }
+    STOP_PROFILER("test_stopwatch::concurrent_outer");
+  }
+  profiler.disable_profiler();
+  profiler.disable_trace();
+
+  // Each thread records its own measurements, which are merged per region
+  BOOST_CHECK_EQUAL(profiler.get_nsamples("test_stopwatch::concurrent_outer"),
+                    N);
+  BOOST_CHECK_EQUAL(profiler.get_nsamples("test_stopwatch::concurrent_inner"),
+                    2 * N);
+  BOOST_CHECK(profiler.get_min_time("test_stopwatch::concurrent_inner") >=
+              1e-6L);
+  BOOST_CHECK(profiler.get_total_time("test_stopwatch::concurrent_outer") >=
+              profiler.get_total_time("test_stopwatch::concurrent_inner"));
+
+  // The disabled profiler does not record measurements
+  START_PROFILER("test_stopwatch::concurrent_outer");
+  STOP_PROFILER("test_stopwatch::concurrent_outer");
+  BOOST_CHECK_EQUAL(profiler.get_nsamples("test_stopwatch::concurrent_outer"),
+                    N);
+}
+
+void test_nested_regions() {
+  crocoddyl::Stopwatch swatch(crocoddyl::REAL_TIME);
+  swatch.start("outer");
+  swatch.start("inner");
+  busy_wait(100000);
+  swatch.stop("inner");
+  swatch.stop("outer");
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("outer"), 1);
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("inner"), 1);
+  BOOST_CHECK(swatch.get_total_time("inner") >= 1e-4L);
+  BOOST_CHECK(swatch.get_total_time("outer") >= swatch.get_total_time("inner"));
+
+  // Stopping a region closes the regions opened inside it, which are not
+  // recorded
+  swatch.start("outer");
+  swatch.start("inner");
+  swatch.stop("outer");
+  swatch.stop("inner");
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("outer"), 2);
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("inner"), 1);
+
+  // Restarting an open region closes it together with its nested regions
+  swatch.start("outer");
+  swatch.start("inner");
+  swatch.start("outer");
+  swatch.stop("inner");
+  swatch.stop("outer");
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("outer"), 3);
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("inner"), 1);
+
+  swatch.reset_all();
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("outer"), 0);
+  BOOST_CHECK_EQUAL(swatch.get_nsamples("inner"), 0);
+}
+
+void test_percentile_time() {
+  crocoddyl::Stopwatch swatch(crocoddyl::REAL_TIME);
+  for (std::size_t i = 0; i < 100; ++i) {
+    swatch.start("region");
+    busy_wait(1000 * (1 + i % 10));
+    swatch.stop("region");
+  }
+  const long double min_time = swatch.get_min_time("region");
+  const long double max_time = swatch.get_max_time("region");
+  BOOST_CHECK(min_time >= 1e-6L);
+  BOOST_CHECK(min_time <= max_time);
+  long double previous = 0.;
+  for (std::size_t i = 0; i <= 20; ++i) {
+    const long double time = swatch.get_percentile_time("region", 5. * i);
+    BOOST_CHECK(time >= min_time);
+    BOOST_CHECK(time <= max_time);
+    BOOST_CHECK(time >= previous);
+    previous = time;
+  }
+  BOOST_CHECK_THROW(swatch.get_percentile_time("region", -1.),
+                    crocoddyl::StopwatchException);
+  BOOST_CHECK_THROW(swatch.get_percentile_time("region", 101.),
+                    crocoddyl::StopwatchException);
+  BOOST_CHECK_THROW(swatch.get_percentile_time("unknown", 50.),
+                    crocoddyl::StopwatchException);
+}
+
+void check_chrome_trace(crocoddyl::Stopwatch& swatch,
+                        const std::size_t nregions) {
+  std::stringstream trace;
+  swatch.export_chrome_trace(trace);
+  boost::property_tree::ptree root;
+  BOOST_REQUIRE_NO_THROW(boost::property_tree::read_json(trace, root));
+
+  // Each stopped region is a complete event, and the inner regions are within
+  // their outer regions
+  std::map<std::string, std::size_t> nevents;
+  std::vector<std::pair<double, double> > outer, inner;
+  for (const auto& item : root.get_child("traceEvents")) {
+    const boost::property_tree::ptree& event = item.second;
+    const std::string ph = event.get<std::string>("ph");
+    if (ph == "M") continue;
+    BOOST_CHECK_EQUAL(ph, "X");
+    const std::string name = event.get<std::string>("name");
+    const double ts = event.get<double>("ts");
+    const double dur = event.get<double>("dur");
+    BOOST_CHECK(dur >= 0.);
+    ++nevents[name];
+    if (name == "outer") {
+      BOOST_CHECK_EQUAL(event.get<std::size_t>("args.depth"), 0);
+      BOOST_CHECK(!event.get_optional<long>("args.node"));
+      outer.push_back(std::make_pair(ts, ts + dur));
+    } else {
+      BOOST_CHECK_EQUAL(name, "inner");
+      BOOST_CHECK_EQUAL(event.get<std::size_t>("args.depth"), 1);
+      BOOST_CHECK_EQUAL(event.get<long>("args.node"),
+                        static_cast<long>(inner.size() % 2));
+      inner.push_back(std::make_pair(ts, ts + dur));
+    }
+  }
+  BOOST_REQUIRE_EQUAL(nevents["outer"], nregions);
+  BOOST_REQUIRE_EQUAL(nevents["inner"], 2 * nregions);
+  for (std::size_t i = 0; i < inner.size(); ++i) {
+    const std::pair<double, double>& region = outer[i / 2];
+    BOOST_CHECK(inner[i].first >= region.first);
+    BOOST_CHECK(inner[i].second <= region.second + 1e-3);
+  }
+}
+
+void test_chrome_trace() {
+  crocoddyl::Stopwatch swatch(crocoddyl::REAL_TIME);
+  const std::size_t outer_id = swatch.intern("outer");
+  const std::size_t inner_id = swatch.intern("inner");
+  swatch.enable_trace(64);
+  for (std::size_t i = 0; i < 5; ++i) {
+    swatch.start(outer_id);
+    for (long node = 0; node < 2; ++node) {
+      swatch.start(inner_id, node);
+      busy_wait(1000);
+      swatch.stop(inner_id);
+    }
+    swatch.stop(outer_id);
+  }
+  check_chrome_trace(swatch, 5);
+
+  // A new capacity discards the recorded events, and the ring buffer keeps
+  // the latest ones
+  swatch.enable_trace(3);
+  for (std::size_t i = 0; i < 5; ++i) {
+    swatch.start(outer_id);
+    for (long node = 0; node < 2; ++node) {
+      swatch.start(inner_id, node);
+      swatch.stop(inner_id);
+    }
+    swatch.stop(outer_id);
+  }
+  std::stringstream trace;
+  swatch.export_chrome_trace(trace);
+  boost::property_tree::ptree root;
+  BOOST_REQUIRE_NO_THROW(boost::property_tree::read_json(trace, root));
+  std::size_t nevents = 0;
+  for (const auto& item : root.get_child("traceEvents")) {
+    if (item.second.get<std::string>("ph") == "X") ++nevents;
+  }
+  BOOST_CHECK_EQUAL(nevents, 3);
+
+  // A disabled trace does not record events
+  swatch.reset_all();
+  swatch.disable_trace();
+  swatch.start(outer_id);
+  swatch.stop(outer_id);
+  check_chrome_trace(swatch, 0);
+}
+
+void register_unit_tests() {
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_concurrent_regions)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_nested_regions)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_percentile_time)));
+  framework::master_test_suite().add(
+      BOOST_TEST_CASE(boost::bind(&test_chrome_trace)));
+}
+
+bool init_function() {
+  register_unit_tests();
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  return ::boost::unit_test::unit_test_main(&init_function, argc, argv);
+}